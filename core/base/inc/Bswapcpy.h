@@ -18,12 +18,16 @@
 //                                                                      //
 // A set of inline byte swapping routines for arrays.                   //
 //                                                                      //
-// The bswapcpy16() and bswapcpy32() routines are used for packing      //
-// arrays of basic types into a buffer in a byte swapped order. Use     //
-// of asm and the `bswap' opcode (available on i486 and up) reduces     //
-// byte swapping overhead on linux.                                     //
+// The bswapcpy16(), bswapcpy32() and bswapcpy64() routines are used    //
+// for packing arrays of basic types into a buffer in a byte swapped    //
+// order and for unpacking them again. The bulk of the array is         //
+// swapped with vector byte shuffles (AVX2 or SSSE3 pshufb on x86, the  //
+// vrev instructions on ARM NEON), the remainder and builds without     //
+// SIMD support fall back to the scalar Rbswap_* primitives. On x86,    //
+// the instruction set is selected at run time from the CPU features.   //
 //                                                                      //
-// Use of routines is similar to that of memcpy.                        //
+// Use of routines is similar to that of memcpy. Source and destination //
+// need not be aligned; they must not overlap unless they are equal.    //
 //                                                                      //
 // ATTENTION:                                                           //
 //                                                                      //
@@ -32,50 +36,43 @@
 //                                                                      //
 // For arrays of short type (2 bytes in size) use bswapcpy16().         //
 // For arrays of of 4-byte types (int, float) use bswapcpy32().         //
+// For arrays of of 8-byte types (long long, double) use bswapcpy64().  //
 //                                                                      //
 //                                                                      //
 // Author: Alexandre V. Vaniachine <AVVaniachine@lbl.gov>               //
 //                                                                      //
 //////////////////////////////////////////////////////////////////////////
 
-#if !defined(__CINT__)
-#include <sys/types.h>
-#endif
+#include <cstddef>
+
+namespace ROOT {
+namespace Internal {
+
+/// Byte swap n elements of 2, 4 or 8 bytes each from `from` into `to`. The kernel is selected at run time, on first
+/// use, from the instruction sets supported by the CPU.
+void Bswapcpy16(void *to, const void *from, std::size_t n);
+void Bswapcpy32(void *to, const void *from, std::size_t n);
+void Bswapcpy64(void *to, const void *from, std::size_t n);
 
-extern inline void * bswapcpy16(void * to, const void * from, size_t n)
+} // namespace Internal
+} // namespace ROOT
+
+inline void *bswapcpy16(void *to, const void *from, size_t n)
 {
-int d0, d1, d2, d3;
-__asm__ __volatile__(
-        "cld\n"
-        "1:\tlodsw\n\t"
-        "rorw $8, %%ax\n\t"
-        "stosw\n\t"
-        "loop 1b\n\t"
-        :"=&c" (d0), "=&D" (d1), "=&S" (d2), "=&a" (d3)
-        :"0" (n), "1" ((long) to),"2" ((long) from)
-        :"memory");
-return (to);
+   ROOT::Internal::Bswapcpy16(to, from, n);
+   return to;
 }
 
-extern inline void * bswapcpy32(void * to, const void * from, size_t n)
+inline void *bswapcpy32(void *to, const void *from, size_t n)
 {
-int d0, d1, d2, d3;
-__asm__ __volatile__(
-        "cld\n"
-        "1:\tlodsl\n\t"
-#if !defined __i486__ && !defined __pentium__ && !defined __pentiumpro__ && \
-    !defined __pentium4__ && !defined __x86_64__
-        "rorw $8, %%ax\n\t"
-        "rorl $16, %%eax\n\t"
-        "rorw $8, %%ax\n\t"
-#else
-        "bswap %%eax\n\t"
-#endif
-        "stosl\n\t"
-        "loop 1b\n\t"
-        :"=&c" (d0), "=&D" (d1), "=&S" (d2), "=&a" (d3)
-        :"0" (n), "1" ((long) to),"2" ((long) from)
-        :"memory");
-return (to);
+   ROOT::Internal::Bswapcpy32(to, from, n);
+   return to;
 }
+
+inline void *bswapcpy64(void *to, const void *from, size_t n)
+{
+   ROOT::Internal::Bswapcpy64(to, from, n);
+   return to;
+}
+
 #endif
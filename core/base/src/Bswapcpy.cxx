@@ -0,0 +1,161 @@
+// @(#)root/base:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \file Bswapcpy.cxx
+Byte swapping copies of arrays, see Bswapcpy.h.
+
+On x86, the AVX2 and SSSE3 kernels are compiled with the corresponding target attributes, independently of the
+instruction set the rest of ROOT is compiled for, and the kernel is chosen at run time with a CPUID check. On ARM,
+NEON is part of the baseline instruction set of the 64 bit architecture and is selected at compile time.
+*/
+
+#include "Bswapcpy.h"
+#include "Byteswap.h"
+
+#include <cstddef>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define R__BSWAPCPY_X86
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define R__BSWAPCPY_NEON
+#endif
+
+namespace {
+
+using BswapcpyFunc_t = void (*)(unsigned char *to, const unsigned char *from, std::size_t n);
+
+/// Byte swaps n elements of N bytes each from `from` into `to` with the scalar primitives, one element at a time.
+template <unsigned N>
+void BswapcpyScalar(unsigned char *to, const unsigned char *from, std::size_t n)
+{
+   using value_type = typename RByteSwap<N>::value_type;
+   for (std::size_t i = 0; i < n; ++i) {
+      value_type x;
+      std::memcpy(&x, from + i * N, N);
+      x = RByteSwap<N>::bswap(x);
+      std::memcpy(to + i * N, &x, N);
+   }
+}
+
+#if defined(R__BSWAPCPY_X86)
+/// The pshufb control mask that reverses the bytes of every N byte element of a 16 byte lane
+template <unsigned N>
+__attribute__((target("ssse3"))) inline __m128i BswapcpyMask128()
+{
+   if (N == 2)
+      return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+   if (N == 4)
+      return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+   return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+}
+
+template <unsigned N>
+__attribute__((target("avx2"))) void BswapcpyAVX2(unsigned char *to, const unsigned char *from, std::size_t n)
+{
+   const std::size_t nbytes = n * N;
+   std::size_t i = 0;
+   const __m128i mask128 = BswapcpyMask128<N>();
+   // vpshufb shuffles within each 128 bit lane, so the same mask is used for both halves
+   const __m256i mask256 = _mm256_broadcastsi128_si256(mask128);
+   for (; i + 64 <= nbytes; i += 64) {
+      __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(from + i));
+      __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(from + i + 32));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(to + i), _mm256_shuffle_epi8(v0, mask256));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(to + i + 32), _mm256_shuffle_epi8(v1, mask256));
+   }
+   for (; i + 16 <= nbytes; i += 16) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(to + i), _mm_shuffle_epi8(v, mask128));
+   }
+   BswapcpyScalar<N>(to + i, from + i, n - i / N);
+}
+
+template <unsigned N>
+__attribute__((target("ssse3"))) void BswapcpySSSE3(unsigned char *to, const unsigned char *from, std::size_t n)
+{
+   const std::size_t nbytes = n * N;
+   std::size_t i = 0;
+   const __m128i mask128 = BswapcpyMask128<N>();
+   for (; i + 32 <= nbytes; i += 32) {
+      __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from + i));
+      __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from + i + 16));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(to + i), _mm_shuffle_epi8(v0, mask128));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(to + i + 16), _mm_shuffle_epi8(v1, mask128));
+   }
+   for (; i + 16 <= nbytes; i += 16) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(to + i), _mm_shuffle_epi8(v, mask128));
+   }
+   BswapcpyScalar<N>(to + i, from + i, n - i / N);
+}
+#endif
+
+#if defined(R__BSWAPCPY_NEON)
+template <unsigned N>
+void BswapcpyNEON(unsigned char *to, const unsigned char *from, std::size_t n)
+{
+   const std::size_t nbytes = n * N;
+   std::size_t i = 0;
+   for (; i + 16 <= nbytes; i += 16) {
+      uint8x16_t v = vld1q_u8(from + i);
+      if (N == 2)
+         v = vrev16q_u8(v);
+      else if (N == 4)
+         v = vrev32q_u8(v);
+      else
+         v = vrev64q_u8(v);
+      vst1q_u8(to + i, v);
+   }
+   BswapcpyScalar<N>(to + i, from + i, n - i / N);
+}
+#endif
+
+/// Returns the widest kernel supported by the CPU
+template <unsigned N>
+BswapcpyFunc_t SelectBswapcpy()
+{
+#if defined(R__BSWAPCPY_X86)
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx2"))
+      return BswapcpyAVX2<N>;
+   if (__builtin_cpu_supports("ssse3"))
+      return BswapcpySSSE3<N>;
+#elif defined(R__BSWAPCPY_NEON)
+   return BswapcpyNEON<N>;
+#endif
+   return BswapcpyScalar<N>;
+}
+
+template <unsigned N>
+void Bswapcpy(void *to, const void *from, std::size_t n)
+{
+   static const BswapcpyFunc_t kernel = SelectBswapcpy<N>();
+   kernel(static_cast<unsigned char *>(to), static_cast<const unsigned char *>(from), n);
+}
+
+} // anonymous namespace
+
+void ROOT::Internal::Bswapcpy16(void *to, const void *from, std::size_t n)
+{
+   Bswapcpy<2>(to, from, n);
+}
+
+void ROOT::Internal::Bswapcpy32(void *to, const void *from, std::size_t n)
+{
+   Bswapcpy<4>(to, from, n);
+}
+
+void ROOT::Internal::Bswapcpy64(void *to, const void *from, std::size_t n)
+{
+   Bswapcpy<8>(to, from, n);
+}
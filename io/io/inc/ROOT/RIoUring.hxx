@@ -9,10 +9,14 @@
 #ifndef ROOT_RIoUring
 #define ROOT_RIoUring
 
+#include <algorithm>
+#include <cerrno>
 #include <cstdint>
 #include <cstring>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <liburing.h>
 #include <liburing/io_uring.h>
@@ -23,9 +27,33 @@ namespace ROOT {
 namespace Internal {
 
 class RIoUring {
+public:
+   struct RReadEvent;
+   struct RReadBatch;
+
 private:
    struct io_uring fRing;
    std::uint32_t fDepth = 0;
+   /// The number of read events that are submitted to the kernel and whose completion has not yet been reaped
+   std::uint32_t fNInFlight = 0;
+   /// The number of read events in the submission queue that the kernel did not take yet. They go with the next
+   /// submission: once in the submission queue, read events cannot be taken back.
+   std::uint32_t fNQueued = 0;
+   /// Set when a submission failed for good; the ring is not used anymore after that
+   bool fFailed = false;
+   /// Batches with unsubmitted or in-flight read events, in submission order
+   std::vector<RReadBatch *> fPending;
+   /// The identifier given to the next submitted batch
+   std::uint32_t fNextBatchId = 0;
+
+   /// Hands over as many of the unsubmitted read events as the submission queue can take to the kernel.
+   /// Does not block.
+   void SubmitPending();
+   /// Reaps a single completion; returns false if `wait` is false and no completion is available.
+   bool ReapOne(bool wait);
+   /// Waits for the read events that the kernel took, so that it does not write into their buffers later, and
+   /// completes all pending batches with the given error. Used when the ring cannot take submissions anymore.
+   void Abandon(int error);
 
 public:
    // Create an io_uring instance. The ring selects an appropriate queue depth. which can be queried
@@ -67,10 +95,34 @@ public:
    RIoUring& operator=(const RIoUring&) = delete;
 
    ~RIoUring() {
-      // todo(max) try submitting any pending events before exiting
+      // The kernel must not write into the read buffers after the ring is gone
+      while (fNInFlight > 0) {
+         struct io_uring_cqe *cqe;
+         if (io_uring_wait_cqe(&fRing, &cqe) < 0)
+            break;
+         io_uring_cqe_seen(&fRing, cqe);
+         --fNInFlight;
+      }
       io_uring_queue_exit(&fRing);
    }
 
+   /// Returns the ring of the calling thread, which is created on first use and lives until the thread exits.
+   /// Returns nullptr if io_uring is not available, in which case the failure is reported once per thread.
+   static RIoUring *GetThreadLocal() {
+      thread_local std::unique_ptr<RIoUring> ring;
+      thread_local bool failed = false;
+      if (!ring && !failed) {
+         try {
+            ring = std::make_unique<RIoUring>();
+         } catch (const std::runtime_error &e) {
+            Warning("RIoUring", "io_uring is unexpectedly not available because:\n%s", e.what());
+            failed = true;
+         }
+      }
+      // A failed ring stays alive: the handles of its abandoned batches still refer to it
+      return (ring && !ring->fFailed) ? ring.get() : nullptr;
+   }
+
    std::uint32_t GetQueueDepth() {
       return fDepth;
    }
@@ -94,81 +146,178 @@ public:
       int fFileDes = -1;
    };
 
-   /// Submit a number of read events and wait for completion. Events are submitted in batches if
-   /// the number of events is larger than the submission queue depth.
-   void SubmitReadsAndWait(RReadEvent* readEvents, unsigned int nReads) {
-      unsigned int batch = 0;
-      unsigned int batchSize = fDepth;
-      unsigned int readPos = 0;
+   /// A group of read events that is submitted at once and completes once all its reads are done.
+   /// The batch and its read events must stay alive and in place until the batch is complete.
+   struct RReadBatch {
+      RReadEvent *fReadEvents = nullptr;
+      unsigned int fNReads = 0;
+      /// The number of read events handed over to the kernel so far
+      unsigned int fNSubmitted = 0;
+      /// The number of read events whose completion has been reaped
+      unsigned int fNCompleted = 0;
+      /// The error code (errno) of the first failed read, zero if all reads succeeded
+      int fError = 0;
+      /// Set by the ring on submission; together with the index of a read event, it forms the user data of the
+      /// event's submission and completion queue entries
+      std::uint32_t fId = 0;
 
-      while (readPos < nReads) {
-         if (readPos + batchSize > nReads) {
-            batchSize = nReads - readPos;
-         }
-         // prep reads
-         struct io_uring_sqe *sqe;
-         for (std::size_t i = readPos; i < readPos + batchSize; ++i) {
-            sqe = io_uring_get_sqe(&fRing);
-            if (!sqe) {
-               throw std::runtime_error("batch " + std::to_string(batch) + ": "
-                  + "get SQE failed for read request '" + std::to_string(i)
-                  + "', error: " + std::string(strerror(errno)));
-            }
-            if (readEvents[i].fFileDes == -1) {
-               throw std::runtime_error("batch " + std::to_string(batch) + ": "
-                  + "bad fd (-1) for read request '" + std::to_string(i) + "'");
-            }
-            if (readEvents[i].fBuffer == nullptr) {
-               throw std::runtime_error("batch " + std::to_string(batch) + ": "
-                  + "null read buffer for read request '" + std::to_string(i) + "'");
-            }
-            io_uring_prep_read(sqe,
-               readEvents[i].fFileDes,
-               readEvents[i].fBuffer,
-               readEvents[i].fSize,
-               readEvents[i].fOffset
-            );
-            sqe->flags |= IOSQE_ASYNC; // maximize read event throughput
-            sqe->user_data = i;
-         }
+      bool IsComplete() const { return fNCompleted == fNReads; }
+   };
 
-         // todo(max) check for any difference between submit vs. submit and wait for large nReq
-         int submitted = io_uring_submit_and_wait(&fRing, batchSize);
-         if (submitted <= 0) {
-            throw std::runtime_error("batch " + std::to_string(batch) + ": "
-               "ring submit failed, error: " + std::string(strerror(errno)));
-         }
-         if (submitted != static_cast<int>(batchSize)) {
-            throw std::runtime_error("ring submitted " + std::to_string(submitted) +
-               " events but requested " + std::to_string(batchSize));
+   /// Enqueues the reads of the batch and submits as many of them as the ring can take. Does not wait for
+   /// any completion. Reads that do not fit in the ring are submitted by later calls to PollReads() or
+   /// WaitReads(), for this or for any other batch. Throws an exception on invalid read events, or if the ring
+   /// failed before.
+   void SubmitReads(RReadBatch &batch) {
+      if (fFailed) {
+         throw std::runtime_error("io_uring is not usable after a failed submission");
+      }
+      for (unsigned int i = 0; i < batch.fNReads; ++i) {
+         if (batch.fReadEvents[i].fFileDes == -1) {
+            throw std::runtime_error("bad fd (-1) for read request '" + std::to_string(i) + "'");
          }
-         // reap reads
-         struct io_uring_cqe *cqe;
-         int ret;
-         for (int i = 0; i < submitted; ++i) {
-            ret = io_uring_wait_cqe(&fRing, &cqe);
-            if (ret < 0) {
-               throw std::runtime_error("wait cqe failed, error: " + std::string(std::strerror(-ret)));
-            }
-            auto index = reinterpret_cast<std::size_t>(io_uring_cqe_get_data(cqe));
-            if (index >= nReads) {
-               throw std::runtime_error("bad cqe user data: " + std::to_string(index));
-            }
-            if (cqe->res < 0) {
-               throw std::runtime_error("batch " + std::to_string(batch) + ": "
-                  + "read failed for ReadEvent[" + std::to_string(index) + "], "
-                  "error: " + std::string(std::strerror(-cqe->res)));
-            }
-            readEvents[index].fOutBytes = static_cast<std::size_t>(cqe->res);
-            io_uring_cqe_seen(&fRing, cqe);
+         if (batch.fReadEvents[i].fBuffer == nullptr) {
+            throw std::runtime_error("null read buffer for read request '" + std::to_string(i) + "'");
          }
-         readPos += batchSize;
-         batch += 1;
       }
-      return;
+      batch.fNSubmitted = batch.fNCompleted = 0;
+      batch.fError = 0;
+      batch.fId = fNextBatchId++;
+      if (batch.fNReads == 0)
+         return;
+      fPending.emplace_back(&batch);
+      SubmitPending();
+   }
+
+   /// Reaps the available completions without blocking. Returns true if the batch is complete.
+   bool PollReads(RReadBatch &batch) {
+      SubmitPending();
+      while (!batch.IsComplete() && ReapOne(false /* wait */)) {
+         SubmitPending();
+      }
+      return batch.IsComplete();
+   }
+
+   /// Blocks until all the reads of the batch are completed. Completions of other batches reaped in the meantime
+   /// are recorded in their batches. Throws an exception if any of the batch's reads failed, or if the ring failed
+   /// before all of them were submitted; the batch is complete in any case.
+   void WaitReads(RReadBatch &batch) {
+      while (!batch.IsComplete()) {
+         SubmitPending();
+         ReapOne(true /* wait */);
+      }
+      if (batch.fError != 0) {
+         throw std::runtime_error("read failed, error: " + std::string(std::strerror(batch.fError)));
+      }
+   }
+
+   /// Submit a number of read events and wait for completion. Events are submitted in batches if
+   /// the number of events is larger than the submission queue depth.
+   void SubmitReadsAndWait(RReadEvent* readEvents, unsigned int nReads) {
+      RReadBatch batch;
+      batch.fReadEvents = readEvents;
+      batch.fNReads = nReads;
+      SubmitReads(batch);
+      WaitReads(batch);
    }
 };
 
+inline void RIoUring::SubmitPending() {
+   if (fFailed)
+      return;
+   unsigned int nPrepared = 0;
+   for (auto batch : fPending) {
+      while ((batch->fNSubmitted < batch->fNReads) && (fNInFlight + fNQueued + nPrepared < fDepth)) {
+         struct io_uring_sqe *sqe = io_uring_get_sqe(&fRing);
+         if (!sqe)
+            break;
+         auto &ev = batch->fReadEvents[batch->fNSubmitted];
+         io_uring_prep_read(sqe, ev.fFileDes, ev.fBuffer, ev.fSize, ev.fOffset);
+         sqe->flags |= IOSQE_ASYNC; // maximize read event throughput
+         sqe->user_data = (static_cast<std::uint64_t>(batch->fId) << 32) | batch->fNSubmitted;
+         ++batch->fNSubmitted;
+         ++nPrepared;
+      }
+   }
+   if (nPrepared == 0 && fNQueued == 0)
+      return;
+
+   // The prepared read events are in the submission queue from now on, whether the kernel takes them or not
+   fNQueued += nPrepared;
+   int submitted = io_uring_submit(&fRing);
+   if (submitted == -EAGAIN || submitted == -EBUSY)
+      return; // out of resources for now, retried by the next submission
+   if (submitted < 0) {
+      Abandon(-submitted);
+      return;
+   }
+   fNInFlight += submitted;
+   fNQueued -= std::min(fNQueued, static_cast<std::uint32_t>(submitted));
+}
+
+inline void RIoUring::Abandon(int error) {
+   fFailed = true;
+   while (fNInFlight > 0) {
+      struct io_uring_cqe *cqe;
+      if (io_uring_wait_cqe(&fRing, &cqe) < 0)
+         break;
+      io_uring_cqe_seen(&fRing, cqe);
+      --fNInFlight;
+   }
+   for (auto batch : fPending) {
+      if (batch->fError == 0)
+         batch->fError = error;
+      batch->fNSubmitted = batch->fNCompleted = batch->fNReads;
+   }
+   fPending.clear();
+}
+
+inline bool RIoUring::ReapOne(bool wait) {
+   if (fNInFlight == 0) {
+      if (wait) {
+         if (fNQueued == 0)
+            throw std::runtime_error("waiting for io_uring completion without reads in flight");
+         // nothing in flight that would free resources for the queued read events
+         Abandon(EAGAIN);
+      }
+      return false;
+   }
+
+   struct io_uring_cqe *cqe;
+   int ret = wait ? io_uring_wait_cqe(&fRing, &cqe) : io_uring_peek_cqe(&fRing, &cqe);
+   if ((ret == -EAGAIN && !wait) || ret == -EINTR)
+      return false;
+   if (ret < 0) {
+      Abandon(-ret);
+      return false;
+   }
+   const auto batchId = static_cast<std::uint32_t>(cqe->user_data >> 32);
+   const auto idx = static_cast<std::uint32_t>(cqe->user_data & 0xffffffff);
+   const int res = cqe->res;
+   io_uring_cqe_seen(&fRing, cqe);
+   --fNInFlight;
+
+   auto itr = std::find_if(fPending.begin(), fPending.end(), [batchId](const RReadBatch *b) {
+      return b->fId == batchId;
+   });
+   if (itr == fPending.end() || idx >= (*itr)->fNSubmitted) {
+      throw std::runtime_error("bad cqe user data");
+   }
+   auto batch = *itr;
+   auto ev = &batch->fReadEvents[idx];
+   if (res < 0) {
+      if (batch->fError == 0)
+         batch->fError = -res;
+      ev->fOutBytes = 0;
+   } else {
+      ev->fOutBytes = static_cast<std::size_t>(res);
+   }
+   ++batch->fNCompleted;
+   if (batch->IsComplete())
+      fPending.erase(itr);
+   return true;
+}
+
 } // namespace Internal
 } // namespace ROOT
 
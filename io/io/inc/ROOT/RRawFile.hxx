@@ -79,6 +79,24 @@ public:
       std::size_t fOutBytes = 0;
    };
 
+   /// Handle of a vector read that is in flight, see SubmitReadV(). The read requests and their buffers must stay
+   /// valid until the handle is complete. The handle must be polled, waited for, and destructed on the thread that
+   /// submitted the requests. Destructing an incomplete handle blocks until the requests are done.
+   struct RAsyncReadV {
+      /// Derived classes keep the state of their in-flight requests in a subclass of RState. Its destructor must not
+      /// return while the underlying I/O layer can still write into the request buffers.
+      struct RState {
+         virtual ~RState() = default;
+      };
+
+      RIOVec *fIoVec = nullptr;
+      unsigned int fNReq = 0;
+      bool fIsComplete = true;
+      std::unique_ptr<RState> fState;
+
+      bool IsComplete() const { return fIsComplete; }
+   };
+
 private:
    /// Don't change without adapting ReadAt()
    static constexpr unsigned int kNumBlockBuffers = 2;
@@ -137,6 +155,13 @@ protected:
 
    /// By default implemented as a loop of ReadAt calls but can be overwritten, e.g. XRootD or DAVIX implementations
    virtual void ReadVImpl(RIOVec *ioVec, unsigned int nReq);
+   /// Derived classes with kFeatureHasAsyncIo start the reads and return immediately.  The default implementation
+   /// calls ReadVImpl() and marks the handle as complete.
+   virtual void SubmitReadVImpl(RAsyncReadV &handle);
+   /// Called for incomplete handles only; returns true if the reads are done. Must not block.
+   virtual bool PollReadVImpl(RAsyncReadV &handle);
+   /// Called for incomplete handles only; blocks until the reads are done.
+   virtual void WaitReadVImpl(RAsyncReadV &handle);
 
 public:
    RRawFile(std::string_view url, ROptions options);
@@ -172,6 +197,14 @@ public:
 
    /// Opens the file if necessary and calls ReadVImpl
    void ReadV(RIOVec *ioVec, unsigned int nReq);
+   /// Opens the file if necessary and starts a vector read that is tracked by `handle`. If the file supports
+   /// asynchronous I/O (kFeatureHasAsyncIo), the call returns before the data is read, otherwise the reads are
+   /// done synchronously. Many handles can be in flight at the same time.
+   void SubmitReadV(RIOVec *ioVec, unsigned int nReq, RAsyncReadV &handle);
+   /// Returns true if all the reads of the handle are done. Does not block.
+   bool PollReadV(RAsyncReadV &handle);
+   /// Blocks until all the reads of the handle are done and the fOutBytes members of the requests are set
+   void WaitReadV(RAsyncReadV &handle);
 
    /// Memory mapping according to POSIX standard; in particular, new mappings of the same range replace older ones.
    /// Mappings need to be aligned at page boundaries, therefore the real offset can be smaller than the desired value.
@@ -36,6 +36,9 @@ protected:
    void OpenImpl() final;
    size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
    void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
+   void SubmitReadVImpl(RAsyncReadV &handle) final;
+   bool PollReadVImpl(RAsyncReadV &handle) final;
+   void WaitReadVImpl(RAsyncReadV &handle) final;
    std::uint64_t GetSizeImpl() final;
    void *MapImpl(size_t nbytes, std::uint64_t offset, std::uint64_t &mapdOffset) final;
    void UnmapImpl(void *region, size_t nbytes) final;
@@ -15,6 +15,7 @@
 #include "TFileMerger.h"
 #include "TMemFile.h"
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -76,9 +77,34 @@ public:
       return fBuffered;
    }
 
+   /** Returns the largest number of buffers that were in the queue at the same time. */
+   size_t GetPeakQueueSize() const;
+
+   /** Returns the largest number of bytes that were buffered in the queue at the same time. */
+   size_t GetPeakBuffered() const;
+
+   /** Returns the number of partial merges into the output file done so far. */
+   size_t GetNMerges() const
+   {
+      return fNMerges;
+   }
+
+   /** Returns how many times a TBufferMergerFile::Write had to wait for the queue
+    *  to be merged because the limit set with SetMaxBuffered() was exceeded. */
+   size_t GetNStalls() const
+   {
+      return fNStalls;
+   }
+
    /** Returns the current value of the auto save setting in bytes (default = 0). */
    size_t GetAutoSave() const;
 
+   /** Returns the maximum number of bytes allowed in the queue (default = 0, no limit). */
+   size_t GetMaxBuffered() const
+   {
+      return fMaxBuffered;
+   }
+
    /** Returns the current merge options. */
    const char* GetMergeOptions();
 
@@ -92,6 +118,20 @@ public:
     */
    void SetAutoSave(size_t size);
 
+   /** Limits the amount of memory held by the merge queue. When a
+    *  TBufferMergerFile::Write pushes the queue above size bytes, the writing
+    *  thread waits for the merge in progress and then merges the queue into
+    *  the output file itself, instead of leaving it to grow. This bounds the
+    *  memory to about size bytes plus one buffer per writing thread and
+    *  throttles the writers to the speed of the merge. A value of 0 (the
+    *  default) disables the limit. The limit takes precedence over the auto
+    *  save setting.
+    */
+   void SetMaxBuffered(size_t size)
+   {
+      fMaxBuffered = size;
+   }
+
    /** Sets the merge options. SetMergeOptions("fast") will disable
     * recompression of input data into the output if they have different
     * compression settings.
@@ -159,7 +199,12 @@ private:
 
    bool fCompressTemporaryKeys{false};                           //< Enable compression of the TKeys in the TMemFile (save memory at the expense of time, end result is unchanged)
    size_t fAutoSave{0};                                          //< AutoSave only every fAutoSave bytes
+   size_t fMaxBuffered{0};                                       //< Max bytes queued (0 = no limit)
    std::atomic<size_t> fBuffered{0};                             //< Number of bytes currently buffered
+   size_t fPeakQueueSize{0};                                     //< Largest number of buffers in the queue
+   size_t fPeakBuffered{0};                                      //< Largest number of bytes in the queue
+   std::atomic<size_t> fNMerges{0};                              //< Number of partial merges done
+   std::atomic<size_t> fNStalls{0};                              //< Number of writes that waited for a merge
    TFileMerger fMerger{false, false};                            //< TFileMerger used to merge all buffers
    std::mutex fMergeMutex;                                       //< Mutex used to lock fMerger
    mutable std::mutex fQueueMutex;                               //< Mutex used to lock fQueue
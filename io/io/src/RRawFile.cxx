@@ -109,6 +109,21 @@ void ROOT::Internal::RRawFile::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
    }
 }
 
+void ROOT::Internal::RRawFile::SubmitReadVImpl(RAsyncReadV &handle)
+{
+   ReadVImpl(handle.fIoVec, handle.fNReq);
+   handle.fIsComplete = true;
+}
+
+bool ROOT::Internal::RRawFile::PollReadVImpl(RAsyncReadV & /* handle */)
+{
+   return true;
+}
+
+void ROOT::Internal::RRawFile::WaitReadVImpl(RAsyncReadV & /* handle */)
+{
+}
+
 void ROOT::Internal::RRawFile::UnmapImpl(void * /* region */, size_t /* nbytes */)
 {
    throw std::runtime_error("Memory mapping unsupported");
@@ -216,6 +231,35 @@ void ROOT::Internal::RRawFile::ReadV(RIOVec *ioVec, unsigned int nReq)
    ReadVImpl(ioVec, nReq);
 }
 
+void ROOT::Internal::RRawFile::SubmitReadV(RIOVec *ioVec, unsigned int nReq, RAsyncReadV &handle)
+{
+   if (!handle.IsComplete())
+      throw std::runtime_error("the read handle is already in flight");
+   if (!fIsOpen)
+      OpenImpl();
+   fIsOpen = true;
+   handle.fState.reset();
+   handle.fIoVec = ioVec;
+   handle.fNReq = nReq;
+   handle.fIsComplete = false;
+   SubmitReadVImpl(handle);
+}
+
+bool ROOT::Internal::RRawFile::PollReadV(RAsyncReadV &handle)
+{
+   if (!handle.IsComplete())
+      handle.fIsComplete = PollReadVImpl(handle);
+   return handle.IsComplete();
+}
+
+void ROOT::Internal::RRawFile::WaitReadV(RAsyncReadV &handle)
+{
+   if (handle.IsComplete())
+      return;
+   WaitReadVImpl(handle);
+   handle.fIsComplete = true;
+}
+
 bool ROOT::Internal::RRawFile::Readln(std::string &line)
 {
    if (fOptions.fLineBreak == ELineBreaks::kAuto) {
@@ -33,6 +33,28 @@
 
 namespace {
 constexpr int kDefaultBlockSize = 4096; // If fstat() does not provide a block size hint, use this value instead
+
+#ifdef R__HAS_URING
+using RIoUring = ROOT::Internal::RIoUring;
+
+/// The in-flight reads of an RAsyncReadV handle on the persistent io_uring of the submitting thread
+struct RUringReadV : public ROOT::Internal::RRawFile::RAsyncReadV::RState {
+   RIoUring *fRing = nullptr;
+   std::vector<RIoUring::RReadEvent> fReadEvents;
+   RIoUring::RReadBatch fBatch;
+
+   ~RUringReadV() override
+   {
+      if (fBatch.IsComplete())
+         return;
+      try {
+         fRing->WaitReads(fBatch);
+      } catch (const std::runtime_error &) {
+         // The handle was abandoned, the read errors are of no interest anymore
+      }
+   }
+};
+#endif
 } // anonymous namespace
 
 ROOT::Internal::RRawFileUnix::RRawFileUnix(std::string_view url, ROptions options)
@@ -52,7 +74,11 @@ std::unique_ptr<ROOT::Internal::RRawFile> ROOT::Internal::RRawFileUnix::Clone()
 }
 
 int ROOT::Internal::RRawFileUnix::GetFeatures() const {
+#ifdef R__HAS_URING
+   return kFeatureHasSize | kFeatureHasMmap | kFeatureHasAsyncIo;
+#else
    return kFeatureHasSize | kFeatureHasMmap;
+#endif
 }
 
 std::uint64_t ROOT::Internal::RRawFileUnix::GetSizeImpl()
@@ -113,37 +139,78 @@ void ROOT::Internal::RRawFileUnix::OpenImpl()
 }
 
 void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   RAsyncReadV handle;
+   handle.fIoVec = ioVec;
+   handle.fNReq = nReq;
+   handle.fIsComplete = false;
+   SubmitReadVImpl(handle);
+   if (!handle.IsComplete())
+      WaitReadVImpl(handle); // falls back to blocking I/O on errors
+}
+
+void ROOT::Internal::RRawFileUnix::SubmitReadVImpl(RAsyncReadV &handle)
 {
 #ifdef R__HAS_URING
-   thread_local bool uring_failed = false;
-   if (!uring_failed) {
+   // The ring is kept for the lifetime of the thread, so that consecutive vector reads do not pay for ring setup
+   // and reads of different handles share the submission queue
+   if (auto ring = RIoUring::GetThreadLocal()) {
+      auto state = std::make_unique<RUringReadV>();
+      state->fRing = ring;
+      state->fReadEvents.resize(handle.fNReq);
+      for (std::size_t i = 0; i < handle.fNReq; ++i) {
+         auto &ev = state->fReadEvents[i];
+         ev.fBuffer = handle.fIoVec[i].fBuffer;
+         ev.fOffset = handle.fIoVec[i].fOffset;
+         ev.fSize = handle.fIoVec[i].fSize;
+         ev.fFileDes = fFileDes;
+      }
+      state->fBatch.fReadEvents = state->fReadEvents.data();
+      state->fBatch.fNReads = handle.fNReq;
       try {
-         RIoUring ring; // throws std::runtime_error
-         std::vector<RIoUring::RReadEvent> reads;
-         reads.reserve(nReq);
-         for (std::size_t i = 0; i < nReq; ++i) {
-            RIoUring::RReadEvent ev;
-            ev.fBuffer = ioVec[i].fBuffer;
-            ev.fOffset = ioVec[i].fOffset;
-            ev.fSize = ioVec[i].fSize;
-            ev.fFileDes = fFileDes;
-            reads.push_back(ev);
-         }
-         ring.SubmitReadsAndWait(reads.data(), nReq);
-         for (std::size_t i = 0; i < nReq; ++i) {
-            ioVec[i].fOutBytes = reads.at(i).fOutBytes;
-         }
+         ring->SubmitReads(state->fBatch); // throws std::runtime_error
+         handle.fState = std::move(state);
          return;
-      }
-      catch(const std::runtime_error &e) {
-         Warning("RIoUring", "io_uring is unexpectedly not available because:\n%s", e.what());
-         Warning("RRawFileUnix",
-              "io_uring setup failed, falling back to blocking I/O in ReadV");
-         uring_failed = true;
+      } catch (const std::runtime_error &e) {
+         Warning("RRawFileUnix", "io_uring submission failed, falling back to blocking I/O in ReadV:\n%s", e.what());
       }
    }
 #endif
-   RRawFile::ReadVImpl(ioVec, nReq);
+   RRawFile::ReadVImpl(handle.fIoVec, handle.fNReq);
+   handle.fIsComplete = true;
+}
+
+bool ROOT::Internal::RRawFileUnix::PollReadVImpl(RAsyncReadV &handle)
+{
+#ifdef R__HAS_URING
+   auto state = static_cast<RUringReadV *>(handle.fState.get());
+   if (!state->fRing->PollReads(state->fBatch))
+      return false;
+   WaitReadVImpl(handle);
+   return true;
+#else
+   (void)handle;
+   return true;
+#endif
+}
+
+void ROOT::Internal::RRawFileUnix::WaitReadVImpl(RAsyncReadV &handle)
+{
+#ifdef R__HAS_URING
+   auto state = static_cast<RUringReadV *>(handle.fState.get());
+   try {
+      state->fRing->WaitReads(state->fBatch); // throws std::runtime_error on read errors
+   } catch (const std::runtime_error &e) {
+      // The batch is complete even on errors: the kernel does not write into the buffers anymore
+      Warning("RRawFileUnix", "io_uring read failed, falling back to blocking I/O in ReadV:\n%s", e.what());
+      RRawFile::ReadVImpl(handle.fIoVec, handle.fNReq);
+      return;
+   }
+   for (std::size_t i = 0; i < handle.fNReq; ++i)
+      handle.fIoVec[i].fOutBytes = state->fReadEvents[i].fOutBytes;
+#else
+   (void)handle;
+#endif
 }
 
 size_t ROOT::Internal::RRawFileUnix::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
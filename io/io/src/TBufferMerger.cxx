@@ -16,6 +16,7 @@
 #include "TROOT.h"
 #include "TVirtualMutex.h"
 
+#include <algorithm>
 #include <utility>
 
 namespace ROOT {
@@ -71,16 +72,40 @@ size_t TBufferMerger::GetQueueSize() const
    return fQueue.size();
 }
 
+size_t TBufferMerger::GetPeakQueueSize() const
+{
+   std::lock_guard<std::mutex> lock(fQueueMutex);
+   return fPeakQueueSize;
+}
+
+size_t TBufferMerger::GetPeakBuffered() const
+{
+   std::lock_guard<std::mutex> lock(fQueueMutex);
+   return fPeakBuffered;
+}
+
 void TBufferMerger::Push(TBufferFile *buffer)
 {
+   bool overflow = false;
    {
       std::lock_guard<std::mutex> lock(fQueueMutex);
       fBuffered += buffer->BufferSize();
       fQueue.push(buffer);
+      fPeakQueueSize = std::max(fPeakQueueSize, fQueue.size());
+      fPeakBuffered = std::max(fPeakBuffered, fBuffered.load());
+      overflow = fMaxBuffered > 0 && fBuffered > fMaxBuffered;
    }
 
-   if (fBuffered > fAutoSave)
+   if (overflow) {
+      // Backpressure: instead of letting the queue grow while another thread merges,
+      // wait for that merge to finish and drain the queue from this thread.
+      ++fNStalls;
+      std::lock_guard<std::mutex> lock(fMergeMutex);
+      if (GetQueueSize() > 0)
+         MergeImpl();
+   } else if (fBuffered > fAutoSave) {
       Merge();
+   }
 }
 
 size_t TBufferMerger::GetAutoSave() const
@@ -130,6 +155,7 @@ void TBufferMerger::MergeImpl()
    fMerger.PartialMerge(TFileMerger::kAll | TFileMerger::kIncremental | TFileMerger::kDelayWrite |
                         TFileMerger::kKeepCompression);
    fMerger.Reset();
+   ++fNMerges;
 }
 
 bool TBufferMerger::TryMerge(ROOT::TBufferMergerFile *memfile)
@@ -48,12 +48,55 @@ End_Macro
 #include "TProcessUUID.h"
 #include "TVirtualMutex.h"
 #include "TEmulatedCollectionProxy.h"
+#include "TEnv.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 const UInt_t kIsBigFile = BIT(16);
 const Int_t  kMaxLen = 2048;
 
 ClassImp(TDirectoryFile);
 
+////////////////////////////////////////////////////////////////////////////////
+/// The key records of a directory, read in one block by ReadKeys and indexed
+/// by key name. The TKey objects are only created when a key is looked up by
+/// name, or for all the keys when the list of keys is requested.
+
+struct TDirectoryFile::TLazyKeys {
+   struct TRecord {
+      char       *fStart{nullptr};     ///< Start of the key record in the buffer
+      const char *fName{nullptr};      ///< Name of the key, not null terminated
+      Int_t       fNameLen{0};         ///< Length of the name
+      TKey       *fKey{nullptr};       ///< The key once materialized, owned by fKeys
+      Bool_t      fIsDirectory{kFALSE}; ///< Whether the key holds a sub-directory
+   };
+   std::unique_ptr<TKey> fHeaderKey;              ///< Owns the buffer with the key records
+   std::vector<TRecord> fRecords;                 ///< In the order of the list of keys
+   std::unordered_multimap<UInt_t, Int_t> fNames; ///< Hash of the key name to record number
+};
+
+namespace {
+
+/// Skip a string written by TString::FillBuffer, returning where it starts and its length
+void SkipKeyString(char *&buffer, const char *&str, Int_t &len)
+{
+   UChar_t nwh;
+   frombuf(buffer, &nwh);
+   if (nwh == 255)
+      frombuf(buffer, &len);
+   else
+      len = nwh;
+   str = buffer;
+   buffer += len;
+}
+
+} // anonymous namespace
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Default TDirectoryFile constructor
@@ -177,6 +220,9 @@ void TDirectoryFile::InitDirectoryFile(TClass *cl)
 
 TDirectoryFile::~TDirectoryFile()
 {
+   // Drop the index first: ~TKey goes through GetListOfKeys, which would create the pending keys
+   delete fLazyKeys;
+   fLazyKeys = nullptr;
    if (fKeys) {
       fKeys->Delete("slow");
       SafeDelete(fKeys);
@@ -225,6 +271,7 @@ void TDirectoryFile::Append(TObject *obj, Bool_t replace /* = kFALSE */)
 
 Int_t TDirectoryFile::AppendKey(TKey *key)
 {
+   MaterializeKeys();
    if (!fKeys) {
       Error("AppendKey","TDirectoryFile not initialized yet.");
       return 0;
@@ -266,6 +313,7 @@ void TDirectoryFile::Browse(TBrowser *b)
       TObject *obj = nullptr;
       TIter nextin(fList);
       TKey *key = nullptr, *keyo = nullptr;
+      MaterializeKeys();
       TIter next(fKeys);
 
       cd();
@@ -575,6 +623,8 @@ void TDirectoryFile::Close(Option_t *option)
    }
 
    // Delete keys from key list (but don't delete the list header)
+   delete fLazyKeys;
+   fLazyKeys = nullptr;
    if (fKeys) {
       fKeys->Delete("slow");
    }
@@ -788,7 +838,8 @@ TKey *TDirectoryFile::FindKeyAny(const char *keyname) const
 
    DecodeNameCycle(keyname, name, cycle, kMaxLen);
 
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   MaterializeKeys(name);
+   auto listOfKeys = dynamic_cast<THashList *>(fKeys);
    if (!listOfKeys) {
       Error("FindKeyAny", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -805,16 +856,15 @@ TKey *TDirectoryFile::FindKeyAny(const char *keyname) const
    }
 
    //try with subdirectories
-   TIter next(GetListOfKeys());
+   TList dirKeys;
+   GetDirectoryKeys(dirKeys);
+   TIter next(&dirKeys);
    TKey *key;
    while ((key = (TKey *) next())) {
-      //if (!strcmp(key->GetClassName(),"TDirectory")) {
-      if (strstr(key->GetClassName(),"TDirectory")) {
-         TDirectory* subdir =
-             const_cast<TDirectoryFile*>(this)->GetDirectory(key->GetName(), kTRUE, "FindKeyAny");
-         TKey *k = subdir ? subdir->FindKeyAny(keyname) : nullptr;
-         if (k) return k;
-      }
+      TDirectory* subdir =
+          const_cast<TDirectoryFile*>(this)->GetDirectory(key->GetName(), kTRUE, "FindKeyAny");
+      TKey *k = subdir ? subdir->FindKeyAny(keyname) : nullptr;
+      if (k) return k;
    }
    if (dirsav) dirsav->cd();
    return nullptr;
@@ -840,7 +890,8 @@ TObject *TDirectoryFile::FindObjectAny(const char *aname) const
 
    DecodeNameCycle(aname, name, cycle, kMaxLen);
 
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   MaterializeKeys(name);
+   auto listOfKeys = dynamic_cast<THashList *>(fKeys);
    if (!listOfKeys) {
       Error("FindObjectAny", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -856,16 +907,15 @@ TObject *TDirectoryFile::FindObjectAny(const char *aname) const
    }
 
    //try with subdirectories
-   TIter next(GetListOfKeys());
+   TList dirKeys;
+   GetDirectoryKeys(dirKeys);
+   TIter next(&dirKeys);
    TKey *key;
    while ((key = (TKey *) next())) {
-      //if (!strcmp(key->GetClassName(),"TDirectory")) {
-      if (strstr(key->GetClassName(),"TDirectory")) {
-         TDirectory* subdir =
-           ((TDirectory*)this)->GetDirectory(key->GetName(), kTRUE, "FindKeyAny");
-         TKey *k = subdir ? subdir->FindKeyAny(aname) : nullptr;
-         if (k) { if (dirsav) dirsav->cd(); return k->ReadObj();}
-      }
+      TDirectory* subdir =
+        ((TDirectory*)this)->GetDirectory(key->GetName(), kTRUE, "FindKeyAny");
+      TKey *k = subdir ? subdir->FindKeyAny(aname) : nullptr;
+      if (k) { if (dirsav) dirsav->cd(); return k->ReadObj();}
    }
    if (dirsav) dirsav->cd();
    return nullptr;
@@ -961,7 +1011,8 @@ TObject *TDirectoryFile::Get(const char *namecycle)
 
 //*-*---------------------Case of Key---------------------
 //                        ===========
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   MaterializeKeys(namobj);
+   auto listOfKeys = dynamic_cast<THashList *>(fKeys);
    if (!listOfKeys) {
       Error("Get", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -1084,7 +1135,8 @@ void *TDirectoryFile::GetObjectChecked(const char *namecycle, const TClass* expe
 
 //*-*---------------------Case of Key---------------------
 //                        ===========
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   MaterializeKeys(namobj);
+   auto listOfKeys = dynamic_cast<THashList *>(fKeys);
    if (!listOfKeys) {
       Error("GetObjectChecked", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -1125,7 +1177,8 @@ TKey *TDirectoryFile::GetKey(const char *name, Short_t cycle) const
 {
    if (!fKeys) return nullptr;
 
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   MaterializeKeys(name);
+   auto listOfKeys = dynamic_cast<THashList *>(fKeys);
    if (!listOfKeys) {
       Error("GetKey", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -1192,6 +1245,7 @@ void TDirectoryFile::ls(Option_t *option) const
 
    if (diskobj && fKeys) {
       //*-* Loop on all the keys
+      MaterializeKeys();
       TObjLink *lnk = fKeys->FirstLink();
       while (lnk) {
          TKey *key = (TKey*)lnk->GetObject();
@@ -1360,6 +1414,12 @@ void TDirectoryFile::ReadAll(Option_t* opt)
 /// This is an efficient way (without opening/closing files) to view
 /// the latest updates of a file being modified by another process
 /// as it is typically the case in a data acquisition system.
+///
+/// If `TFile.LazyKeys` is set in the ROOT resource file and the file is
+/// opened read-only, the key records are only indexed by name: the TKey
+/// objects are created when an object is looked up by name (Get(), GetKey(),
+/// ...) or, for all the keys, when GetListOfKeys() is called. This makes
+/// opening files with a very large number of keys much cheaper.
 
 Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 {
@@ -1372,6 +1432,8 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 
    char *buffer;
    if (forceRead) {
+      delete fLazyKeys;
+      fLazyKeys = nullptr;
       fKeys->Delete();
       //In case directory was updated by another process, read new
       //position for the keys
@@ -1414,6 +1476,59 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 
       TKey *key;
       frombuf(buffer, &nkeys);
+      if (!fFile->IsWritable() && gEnv->GetValue("TFile.LazyKeys", 0)) {
+         MaterializeKeys();
+         fLazyKeys = new TLazyKeys;
+         fLazyKeys->fHeaderKey.reset(headerkey);
+         fLazyKeys->fRecords.reserve(nkeys);
+         fLazyKeys->fNames.reserve(nkeys);
+         std::vector<Int_t> processIDs;
+         for (Int_t i = 0; i < nkeys; i++) {
+            TLazyKeys::TRecord record;
+            record.fStart = buffer;
+            Int_t nbytes, objlen;
+            Version_t version;
+            UInt_t datime;
+            Short_t keylen, cycle;
+            Long64_t seekkey, seekpdir;
+            frombuf(buffer, &nbytes);
+            frombuf(buffer, &version);
+            frombuf(buffer, &objlen);
+            frombuf(buffer, &datime);
+            frombuf(buffer, &keylen);
+            frombuf(buffer, &cycle);
+            if (version > 1000) {
+               frombuf(buffer, &seekkey);
+               frombuf(buffer, &seekpdir);
+               seekpdir &= 0xffffffffffffLL; // Strip the pid offset, see TKey::ReadKeyBuffer
+            } else {
+               UInt_t skey, spdir;
+               frombuf(buffer, &skey);  seekkey  = (Long64_t)skey;
+               frombuf(buffer, &spdir); seekpdir = (Long64_t)spdir;
+            }
+            const char *classname, *title;
+            Int_t classlen, titlelen;
+            SkipKeyString(buffer, classname, classlen);
+            SkipKeyString(buffer, record.fName, record.fNameLen);
+            SkipKeyString(buffer, title, titlelen);
+            if (seekkey < 64 || seekkey > fsize || seekpdir < 64 || seekpdir > fsize) {
+               Error("ReadKeys","reading illegal key, exiting after %d keys",i);
+               nkeys = i;
+               break;
+            }
+            record.fIsDirectory = std::string(classname, classlen).find("TDirectory") != std::string::npos;
+            fLazyKeys->fNames.emplace(TString::Hash(record.fName, record.fNameLen), i);
+            fLazyKeys->fRecords.push_back(record);
+            // TFile::Init counts the TProcessID keys, they are few: create them right away
+            if (classlen == 10 && !strncmp(classname, "TProcessID", 10))
+               processIDs.push_back(i);
+         }
+         for (auto i : processIDs) {
+            const auto &record = fLazyKeys->fRecords[i];
+            MaterializeKeys(std::string(record.fName, record.fNameLen).c_str());
+         }
+         return nkeys;
+      }
       for (Int_t i = 0; i < nkeys; i++) {
          key = new TKey(this);
          key->ReadKeyBuffer(buffer);
@@ -1438,6 +1553,99 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Create the TKey objects of the keys indexed by a lazy ReadKeys.
+///
+/// If name is given, only the keys with this name (all their cycles) are
+/// created and added to fKeys. Otherwise all the keys are created and fKeys
+/// is rebuilt in the order of the keys on file; the index is then dropped.
+
+void TDirectoryFile::MaterializeKeys(const char *name) const
+{
+   if (!fLazyKeys)
+      return;
+   auto self = const_cast<TDirectoryFile *>(this);
+   auto &records = fLazyKeys->fRecords;
+   auto materialize = [self](TLazyKeys::TRecord &record) {
+      if (record.fKey)
+         return;
+      char *buffer = record.fStart;
+      record.fKey = new TKey(self);
+      record.fKey->ReadKeyBuffer(buffer);
+   };
+
+   if (name) {
+      const Int_t len = strlen(name);
+      std::vector<Int_t> matches;
+      auto range = fLazyKeys->fNames.equal_range(TString::Hash(name, len));
+      for (auto it = range.first; it != range.second; ++it) {
+         const auto &record = records[it->second];
+         if (record.fNameLen == len && !strncmp(record.fName, name, len))
+            matches.push_back(it->second);
+      }
+      // All the cycles of a name are created together, in the order of the list of keys
+      std::sort(matches.begin(), matches.end());
+      if (matches.empty() || records[matches.front()].fKey)
+         return;
+      for (auto i : matches) {
+         materialize(records[i]);
+         fKeys->Add(records[i].fKey);
+      }
+      return;
+   }
+
+   fKeys->Clear("nodelete");
+   for (auto &record : records) {
+      materialize(record);
+      fKeys->Add(record.fKey);
+   }
+   delete fLazyKeys;
+   self->fLazyKeys = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the keys of the sub-directories to keys, in the order of the list of keys.
+/// For a directory whose keys were read lazily, only these keys are created.
+
+void TDirectoryFile::GetDirectoryKeys(TList &keys) const
+{
+   if (fLazyKeys) {
+      for (auto &record : fLazyKeys->fRecords) {
+         if (!record.fIsDirectory)
+            continue;
+         MaterializeKeys(std::string(record.fName, record.fNameLen).c_str());
+         keys.Add(record.fKey);
+      }
+      return;
+   }
+   TIter next(fKeys);
+   TKey *key;
+   while ((key = (TKey *) next())) {
+      if (strstr(key->GetClassName(),"TDirectory"))
+         keys.Add(key);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the list of keys of the directory.
+/// For a directory whose keys were read lazily, all the TKey objects are created.
+
+TList *TDirectoryFile::GetListOfKeys() const
+{
+   MaterializeKeys();
+   return fKeys;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of keys of the directory.
+
+Int_t TDirectoryFile::GetNkeys() const
+{
+   if (fLazyKeys)
+      return fLazyKeys->fRecords.size();
+   return fKeys->GetSize();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read object with keyname from the current directory
 ///
@@ -1450,7 +1658,8 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 Int_t TDirectoryFile::ReadTObject(TObject *obj, const char *keyname)
 {
    if (!fFile) { Error("ReadTObject","No file open"); return 0; }
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   MaterializeKeys(keyname);
+   auto listOfKeys = dynamic_cast<THashList *>(fKeys);
    if (!listOfKeys) {
       Error("ReadTObject", "Unexpected type of TDirectoryFile::fKeys!");
       return 0;
@@ -1491,6 +1700,7 @@ void TDirectoryFile::ResetAfterMerge(TFileMergeInfo *info)
    fSeekParent = 0; // updated by Init
    fSeekKeys = 0;   // updated by Init
    // Does not change: fFile
+   MaterializeKeys();
    TKey *key = fKeys ? (TKey*)fKeys->FindObject(fName) : nullptr;
    TClass *cl = IsA();
    if (key) {
@@ -1498,6 +1708,8 @@ void TDirectoryFile::ResetAfterMerge(TFileMergeInfo *info)
    }
    // NOTE: We should check that the content is really mergeable and in
    // the in-mmeory list, before deleting the keys.
+   delete fLazyKeys;
+   fLazyKeys = nullptr;
    if (fKeys) {
       fKeys->Delete("slow");
    }
@@ -1668,6 +1880,9 @@ void TDirectoryFile::SetWritable(Bool_t writable)
    TDirectory::TContext ctxt(this);
 
    fWritable = writable;
+   // Keys are added and removed from now on, the lazy index would get out of date
+   if (writable)
+      MaterializeKeys();
 
    // recursively set all sub-directories
    if (fList) {
@@ -2164,6 +2379,7 @@ void TDirectoryFile::WriteKeys()
       f->MakeFree(fSeekKeys, fSeekKeys + fNbytesKeys -1);
    }
 //*-* Write new keys record
+   MaterializeKeys();
    TIter next(fKeys);
    TKey *key;
    Int_t nkeys  = fKeys->GetSize();
@@ -132,6 +132,13 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include "TGlobal.h"
 #include "ROOT/RConcurrentHashColl.hxx"
 #include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#ifdef R__HAS_URING
+#include "ROOT/RIoUring.hxx"
+#endif
 
 using std::sqrt;
 
@@ -870,7 +877,7 @@ void TFile::Init(Bool_t create)
             }
          } else if (fVersion != gROOT->GetVersionInt() && fVersion > 30000) {
             // Don't complain about missing streamer info for empty files.
-            if (fKeys->GetSize()) {
+            if (GetNkeys()) {
                Warning("Init","no StreamerInfo found in %s therefore preventing schema evolution when reading this file."
                               " The file was produced with version %d.%02d/%02d of ROOT.",
                               GetName(),  fVersion / 10000, (fVersion / 100) % (100), fVersion  % 100);
@@ -1797,6 +1804,93 @@ Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
       return kFALSE;
    }
 
+#ifdef R__HAS_URING
+   // Local files: rather than reading the blocks one after the other, all of them are in flight at the same time
+   // on the persistent io_uring of the calling thread. As in the sequential code path below, neighbouring blocks that
+   // fit in the read-ahead buffer together are coalesced into a single read.
+   if (IsA() == TFile::Class() && fD >= 0 && !(fWritable && fCacheWrite)) {
+      if (auto ring = ROOT::Internal::RIoUring::GetThreadLocal()) {
+         // Per read: the first block and the number of blocks; coalesced blocks are read into a scratch buffer
+         std::vector<std::pair<Int_t, Int_t>> groups;
+         Long64_t nScratch = 0;
+         for (Int_t i = 0; i < nbuf;) {
+            Int_t n = 1;
+            while (i + n < nbuf && pos[i + n] + len[i + n] - pos[i] < fgReadaheadSize)
+               n++;
+            if (n > 1)
+               nScratch += pos[i + n - 1] + len[i + n - 1] - pos[i];
+            groups.emplace_back(i, n);
+            i += n;
+         }
+
+         std::unique_ptr<char[]> scratch(nScratch > 0 ? new char[nScratch] : nullptr);
+         std::vector<ROOT::Internal::RIoUring::RReadEvent> readEvents(groups.size());
+         Long64_t k = 0;
+         Long64_t kScratch = 0;
+         Long64_t nbytes = 0;
+         for (std::size_t g = 0; g < groups.size(); ++g) {
+            const Int_t first = groups[g].first;
+            const Int_t last = first + groups[g].second - 1;
+            auto &ev = readEvents[g];
+            ev.fOffset = pos[first] + fArchiveOffset;
+            ev.fSize = pos[last] + len[last] - pos[first];
+            ev.fFileDes = fD;
+            if (first == last) {
+               ev.fBuffer = &buf[k];
+            } else {
+               ev.fBuffer = &scratch[kScratch];
+               kScratch += ev.fSize;
+            }
+            for (Int_t j = first; j <= last; j++)
+               k += len[j];
+            nbytes += ev.fSize;
+         }
+
+         Double_t start = 0;
+         if (gPerfStats) start = TTimeStamp();
+         try {
+            ring->SubmitReadsAndWait(readEvents.data(), readEvents.size());
+         } catch (const std::runtime_error &e) {
+            Error("ReadBuffers", "error reading from file %s: %s", GetName(), e.what());
+            return kTRUE;
+         }
+         for (const auto &ev : readEvents) {
+            if (ev.fOutBytes != ev.fSize) {
+               Error("ReadBuffers", "error reading all requested bytes from file %s, got %ld of %ld",
+                     GetName(), (Long_t)ev.fOutBytes, (Long_t)ev.fSize);
+               return kTRUE;
+            }
+         }
+
+         // now copy the coalesced blocks from the scratch buffer
+         k = 0;
+         for (std::size_t g = 0; g < groups.size(); ++g) {
+            const Int_t first = groups[g].first;
+            const Int_t last = first + groups[g].second - 1;
+            for (Int_t j = first; j <= last; j++) {
+               if (first != last)
+                  memcpy(&buf[k], static_cast<char *>(readEvents[g].fBuffer) + (pos[j] - pos[first]), len[j]);
+               k += len[j];
+            }
+         }
+
+         const Long64_t extra = nbytes - k;
+         fBytesReadExtra += extra;
+         fBytesRead  += k;
+         fgBytesRead += k;
+         fReadCalls  += readEvents.size();
+         fgReadCalls += readEvents.size();
+
+         if (gMonitoringWriter)
+            gMonitoringWriter->SendFileReadProgress(this);
+         if (gPerfStats) {
+            gPerfStats->FileReadEvent(this, nbytes, start);
+         }
+         return kFALSE;
+      }
+   }
+#endif
+
    Int_t k = 0;
    Bool_t result = kTRUE;
    TFileCacheRead *old = fCacheRead;
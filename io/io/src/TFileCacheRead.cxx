@@ -458,7 +458,8 @@ Int_t TFileCacheRead::ReadBufferExtNormal(char *buf, Long64_t pos, Int_t len, In
 
       // If ReadBufferAsync is not supported by this implementation...
       if (!fAsyncReading) {
-         // Then we use the vectored read to read everything now
+         // Then we use the vectored read to read everything now.  For local files, TFile::ReadBuffers keeps
+         // all the blocks in flight at the same time if io_uring is available.
          if (fFile->ReadBuffers(fBuffer,fPos,fLen,fNb)) {
             return -1;
          }
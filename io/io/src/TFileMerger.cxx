@@ -49,7 +49,12 @@ to be merged, like the standalone hadd program.
 #include <sys/resource.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <future>
+#include <thread>
+#include <vector>
 
 ClassImp(TFileMerger);
 
@@ -85,6 +90,26 @@ static Int_t R__GetSystemMaxOpenedFiles()
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Call func(i) for every i in [0, n), spreading the calls over at most
+/// nthreads threads, the calling thread included.
+
+template <typename F>
+static void R__ParallelFor(Int_t n, Int_t nthreads, F &&func)
+{
+   std::atomic<Int_t> next{0};
+   auto work = [&]() {
+      for (Int_t i = next++; i < n; i = next++)
+         func(i);
+   };
+   std::vector<std::thread> threads;
+   for (Int_t t = 1; t < std::min(n, nthreads); ++t)
+      threads.emplace_back(work);
+   work();
+   for (auto &thread : threads)
+      thread.join();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Create file merger object.
 
@@ -134,7 +159,7 @@ Bool_t TFileMerger::AddFile(const char *url, Bool_t cpProgress)
    TFile *newfile = 0;
    TString localcopy;
 
-   if (fFileList.GetEntries() >= (fMaxOpenedFiles-1)) {
+   if (fFileList.GetEntries() >= GetMaxFilesPerStep()) {
 
       TObjString *urlObj = new TObjString(url);
       fMergeList.Add(urlObj);
@@ -374,16 +399,26 @@ Bool_t TFileMerger::Merge(Bool_t)
 
 namespace {
 
-/// Merge a list of RNTuples
-Long64_t MergeRNTuples(TClass* rntupleHandle, const TString& /* target */, const TList& /* sources */) {
-   if (!rntupleHandle) {
+/// Merge the RNTuple `name` of all the sources into the target directory.  The merge function of the RNTuple class
+/// receives the name of the RNTuple followed by the source directories that contain it.
+Long64_t MergeRNTuples(TClass *rntupleHandle, void *ntuple, const char *name, const TString &path,
+                       const TList &sources, TFileMergeInfo &info)
+{
+   if (!rntupleHandle || !ntuple) {
       return Long64_t(-1);
    }
-   // todo(max) implement rntuple merger
-   // [ ] build complete list of sources (some sources may actually be a directory with RNTuples inside)
-   // [ ] merge them
+
+   TObjString ntupleName(name);
+   TList inputs;
+   inputs.Add(&ntupleName);
+   for (auto obj : sources) {
+      auto source = static_cast<TFile *>(obj);
+      TDirectory *dir = path.IsNull() ? source : source->GetDirectory(path);
+      if (dir && dir->GetKey(name))
+         inputs.Add(dir);
+   }
    ROOT::MergeFunc_t func = rntupleHandle->GetMerge();
-   return func(static_cast<void*>(rntupleHandle), nullptr, nullptr);
+   return func(ntuple, &inputs, &info);
 }
 
 Bool_t IsMergeable(TClass *cl)
@@ -597,13 +632,18 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
       // merge objects that don't derive from TObject
       if (std::string(keyclassname) == "ROOT::Experimental::RNTuple") {
          Warning("MergeRecursive", "merging RNTuples is experimental");
-         // todo(max): check if this works when a TDirectory is passed as the first
-         // input argument
-         Long64_t mergeResult = MergeRNTuples(cl, *path, *sourcelist);
+         Long64_t mergeResult = MergeRNTuples(cl, obj, keyname, path, *sourcelist, info);
          if (mergeResult < 0) {
             Error("MergeRecursive", "error merging RNTuples");
             return kFALSE;
          }
+         // The merged RNTuple anchor is already written to the target: the anchor read from the first source must
+         // not overwrite it
+         oldkeyname = keyname;
+         if (ownobj)
+            cl->Destructor(obj);
+         info.Reset();
+         return kTRUE;
       } else {
          TFile *nextsource = current_file ? (TFile*)sourcelist->After( current_file ) : (TFile*)sourcelist->First();
          Error("MergeRecursive", "Merging objects that don't inherit from TObject is unimplemented (key: %s of type %s in file %s)",
@@ -625,6 +665,79 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
          ROOT::MergeFunc_t func = cl->GetMerge();
          func(obj, &inputs, &info);
          info.fIsFirst = kFALSE;
+      } else if (fNThreads > 1) {
+         // Find the object in all the remaining sources first, then read them in parallel (reading and
+         // decompressing dominates for histograms) and merge them in order in this thread.
+         std::vector<TFile *> sources;
+         std::vector<TDirectory *> dirs;
+         std::vector<TKey *> keys;
+         std::vector<TObject *> objs;
+         for (; nextsource; nextsource = (TFile*)sourcelist->After( nextsource )) {
+            TDirectory *ndir = getDirectory(nextsource, target->GetName(), path);
+            if (!ndir)
+               continue;
+            TObject *hobj = ndir->GetList()->FindObject(keyname);
+            TKey *key2 = hobj ? nullptr : (TKey*)ndir->GetListOfKeys()->FindObject(keyname);
+            if (!hobj && !key2)
+               continue;
+            sources.push_back(nextsource);
+            dirs.push_back(ndir);
+            keys.push_back(key2);
+            objs.push_back(hobj);
+         }
+         // Without oneGo, at most one object per thread is kept in memory on top of the result.
+         const Int_t nsources = sources.size();
+         const Int_t step = oneGo ? nsources : fNThreads;
+         for (Int_t first = 0; first < nsources; first += step) {
+            const Int_t last = std::min(first + step, nsources);
+            R__ParallelFor(last - first, fNThreads, [&](Int_t i) {
+               if (keys[first + i]) {
+                  TDirectory::TContext ctxt(dirs[first + i]);
+                  objs[first + i] = keys[first + i]->ReadObj();
+               }
+            });
+            for (Int_t i = first; i < last; ++i) {
+               TObject *hobj = objs[i];
+               if (!hobj) {
+                  Info("MergeRecursive", "could not read object for key {%s, %s}; skipping file %s",
+                       keyname, keytitle, sources[i]->GetName());
+                  for (Int_t j = i + 1; j < last; ++j) {
+                     if (keys[j])
+                        delete objs[j];
+                  }
+                  todelete.Delete();
+                  return kTRUE;
+               }
+               if (keys[i])
+                  todelete.Add(hobj);
+               // Set ownership for collections
+               if (hobj->InheritsFrom(TCollection::Class())) {
+                  ((TCollection*)hobj)->SetOwner();
+               }
+               hobj->ResetBit(kMustCleanup);
+               inputs.Add(hobj);
+               if (!oneGo) {
+                  dirs[i]->cd();
+                  ROOT::MergeFunc_t func = cl->GetMerge();
+                  Long64_t result = func(obj, &inputs, &info);
+                  info.fIsFirst = kFALSE;
+                  if (result < 0) {
+                     Error("MergeRecursive", "calling Merge() on '%s' with the corresponding object in '%s'",
+                           keyname, sources[i]->GetName());
+                  }
+                  inputs.Clear();
+                  todelete.Delete();
+               }
+            }
+         }
+         // Merge the list, if still to be done
+         if (oneGo || info.fIsFirst) {
+            ROOT::MergeFunc_t func = cl->GetMerge();
+            func(obj, &inputs, &info);
+            info.fIsFirst = kFALSE;
+            inputs.Clear();
+            todelete.Delete();
+         }
       } else {
          do {
             // make sure we are at the correct directory level by cd'ing to path
@@ -965,6 +1078,12 @@ Bool_t TFileMerger::PartialMerge(Int_t in_type)
    Bool_t result = kTRUE;
    Int_t type = in_type;
    while (result && fFileList.GetEntries()>0) {
+      // With several threads, the next set of files is opened while the current one is merged.
+      TList prefetched;
+      std::future<Bool_t> prefetch;
+      if (fNThreads > 1 && fExcessFiles.GetEntries() > 0)
+         prefetch = std::async(std::launch::async, [this, &prefetched]() { return OpenExcessFiles(prefetched); });
+
       result = MergeRecursive(fOutputFile, &fFileList, type);
 
       // Remove local copies if there are any
@@ -982,7 +1101,23 @@ Bool_t TFileMerger::PartialMerge(Int_t in_type)
          }
       }
       fFileList.Clear();
-      if (result && fExcessFiles.GetEntries() > 0) {
+      if (prefetch.valid()) {
+         Bool_t opened = prefetch.get();
+         TIter nextopened(&prefetched);
+         while ((file = (TFile*) nextopened())) {
+            if (result) {
+               if (fOutputFile->GetCompressionLevel() != file->GetCompressionLevel()) fCompressionChange = kTRUE;
+               fFileList.Add(file);
+            } else {
+               file->Close();
+            }
+         }
+         // The files now belong to fFileList, unless the merge failed.
+         prefetched.Clear(result ? "nodelete" : "");
+         if (result && fFileList.GetEntries() > 0)
+            type = type | kIncremental;
+         result = result && opened;
+      } else if (result && fExcessFiles.GetEntries() > 0) {
          // We merge the first set of files in the output,
          // we now need to open the next set and make
          // sure we accumulate into the output, so we
@@ -1025,49 +1160,90 @@ Bool_t TFileMerger::PartialMerge(Int_t in_type)
    return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return how many input files are opened at the same time. Keep one file
+/// descriptor for the output. With several threads, the next set of files is
+/// opened while the current one is merged, so each set gets half of them.
+
+Int_t TFileMerger::GetMaxFilesPerStep() const
+{
+   if (fNThreads > 1)
+      return TMath::Max((fMaxOpenedFiles - 1) / 2, 1);
+   return fMaxOpenedFiles - 1;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Open up to fMaxOpenedFiles of the excess files.
 
 Bool_t TFileMerger::OpenExcessFiles()
+{
+   TList opened;
+   Bool_t result = OpenExcessFiles(opened);
+   TIter next(&opened);
+   while (TFile *newfile = (TFile*)next()) {
+      if (fOutputFile && fOutputFile->GetCompressionLevel() != newfile->GetCompressionLevel())
+         fCompressionChange = kTRUE;
+      fFileList.Add(newfile);
+   }
+   opened.Clear("nodelete");
+   return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Open the next set of excess files and add them to the list opened, using
+/// up to fNThreads threads. The files are added in order up to the first one
+/// which could not be opened, in which case kFALSE is returned.
+/// Only fExcessFiles is modified, so that this can run while fFileList is
+/// being merged.
+
+Bool_t TFileMerger::OpenExcessFiles(TList &opened)
 {
    if (fPrintLevel > 0) {
-      Printf("%s Opening the next %d files", fMsgPrefix.Data(), TMath::Min(fExcessFiles.GetEntries(), fMaxOpenedFiles - 1));
+      Printf("%s Opening the next %d files", fMsgPrefix.Data(),
+             TMath::Min(fExcessFiles.GetEntries(), GetMaxFilesPerStep()));
    }
-   Int_t nfiles = 0;
+   std::vector<TObjString *> urls;
    TIter next(&fExcessFiles);
    TObjString *url = 0;
-   TString localcopy;
-   // We want gDirectory untouched by anything going on here
-   TDirectory::TContext ctxt;
-   while( nfiles < (fMaxOpenedFiles-1) && ( url = (TObjString*)next() ) ) {
-      TFile *newfile = 0;
+   while( (Int_t)urls.size() < GetMaxFilesPerStep() && ( url = (TObjString*)next() ) )
+      urls.push_back(url);
+
+   std::vector<TFile *> newfiles(urls.size(), nullptr);
+   std::vector<TString> localcopies(urls.size());
+   std::vector<Bool_t> copied(urls.size(), kTRUE);
+   R__ParallelFor(urls.size(), fNThreads, [&](Int_t i) {
+      // We want gDirectory untouched by anything going on here
+      TDirectory::TContext ctxt;
       if (fLocal) {
          TUUID uuid;
-         localcopy.Form("file:%s/ROOTMERGE-%s.root", gSystem->TempDirectory(), uuid.AsString());
-         if (!TFile::Cp(url->GetName(), localcopy, url->TestBit(kCpProgress))) {
-            Error("OpenExcessFiles", "cannot get a local copy of file %s", url->GetName());
-            return kFALSE;
+         localcopies[i].Form("file:%s/ROOTMERGE-%s.root", gSystem->TempDirectory(), uuid.AsString());
+         if (!TFile::Cp(urls[i]->GetName(), localcopies[i], urls[i]->TestBit(kCpProgress))) {
+            copied[i] = kFALSE;
+            return;
          }
-         newfile = TFile::Open(localcopy, "READ");
+         newfiles[i] = TFile::Open(localcopies[i], "READ");
       } else {
-         newfile = TFile::Open(url->GetName(), "READ");
+         newfiles[i] = TFile::Open(urls[i]->GetName(), "READ");
       }
+   });
 
-      if (!newfile) {
-         if (fLocal)
+   for (size_t i = 0; i < urls.size(); ++i) {
+      if (!newfiles[i]) {
+         if (!copied[i])
+            Error("OpenExcessFiles", "cannot get a local copy of file %s", urls[i]->GetName());
+         else if (fLocal)
             Error("OpenExcessFiles", "cannot open local copy %s of URL %s",
-                  localcopy.Data(), url->GetName());
+                  localcopies[i].Data(), urls[i]->GetName());
          else
-            Error("OpenExcessFiles", "cannot open file %s", url->GetName());
+            Error("OpenExcessFiles", "cannot open file %s", urls[i]->GetName());
+         for (size_t j = i + 1; j < urls.size(); ++j)
+            delete newfiles[j];
          return kFALSE;
-      } else {
-         if (fOutputFile && fOutputFile->GetCompressionLevel() != newfile->GetCompressionLevel()) fCompressionChange = kTRUE;
-
-         newfile->SetBit(kCanDelete);
-         fFileList.Add(newfile);
-         ++nfiles;
-         fExcessFiles.Remove(url);
       }
+      newfiles[i]->SetBit(kCanDelete);
+      opened.Add(newfiles[i]);
+      fExcessFiles.Remove(urls[i]);
+      delete urls[i];
    }
    return kTRUE;
 }
@@ -1102,6 +1278,21 @@ void TFileMerger::SetMaxOpenedFiles(Int_t newmax)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the number of threads used to open the input files and to read the
+/// objects to be merged. The objects are still merged one key at a time in
+/// the calling thread; with more than one thread, the next set of input files
+/// is opened while the current one is merged, and the objects with a Merge
+/// function (e.g. histograms) are read from the input files in parallel.
+/// This enables ROOT's thread safety. It should be called before adding files.
+
+void TFileMerger::SetNThreads(Int_t nthreads)
+{
+   fNThreads = nthreads < 1 ? 1 : nthreads;
+   if (fNThreads > 1)
+      ROOT::EnableThreadSafety();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the prefix to be used when printing informational message.
 
@@ -2,6 +2,10 @@
 
 #include "ROOT/RIoUring.hxx"
 #include "ROOT/RRawFileUnix.hxx"
+#include "TFile.h"
+#include "TNamed.h"
+
+#include <vector>
 
 using RIoUring = ROOT::Internal::RIoUring;
 using RIOVec = RRawFile::RIOVec;
@@ -43,6 +47,43 @@ TEST(RRawFileUnix, ReadV)
    }
 }
 
+TEST(RRawFileUnix, AsyncReadV)
+{
+   auto file = "test_uring_async_readv";
+   auto filesize = 2 << 20;
+   std::string content(filesize, 'a');
+   for (int i = 0; i < filesize; i += 4096)
+      content[i] = 'b';
+   FileRaii fileGuard(file, content);
+   auto f = RRawFileUnix::Create(file);
+   EXPECT_TRUE(f->GetFeatures() & RRawFile::kFeatureHasAsyncIo);
+
+   // More requests in flight than the ring can hold; the remainder is submitted as completions are reaped
+   const int nHandles = 4;
+   const int nReq = 1000;
+   std::vector<std::vector<RIOVec>> iovecs;
+   std::vector<RRawFile::RAsyncReadV> handles(nHandles);
+   for (int i = 0; i < nHandles; ++i) {
+      iovecs.emplace_back(make_iovecs(nReq, filesize));
+      f->SubmitReadV(iovecs[i].data(), nReq, handles[i]);
+   }
+   while (!f->PollReadV(handles[nHandles - 1])) {
+   }
+   for (int i = 0; i < nHandles; ++i)
+      f->WaitReadV(handles[i]);
+
+   for (const auto &v : iovecs) {
+      for (const auto &iovec : v) {
+         EXPECT_EQ(std::min<std::size_t>(iovec.fSize, filesize - iovec.fOffset), iovec.fOutBytes);
+         for (std::size_t i = 0; i < iovec.fOutBytes; ++i) {
+            auto expected = ((iovec.fOffset + i) % 4096 == 0) ? 'b' : 'a';
+            ASSERT_EQ(expected, ((unsigned char*)iovec.fBuffer)[i]);
+         }
+         free(iovec.fBuffer);
+      }
+   }
+}
+
 TEST(RawUring, NopRoundTrip)
 {
    struct io_uring ring;
@@ -142,3 +183,36 @@ TEST(RawUring, FileRegistration)
       free(iovec.fBuffer);
    }
 }
+
+TEST(RIoUring, TFileReadBuffers)
+{
+   auto file = "test_uring_tfile_readbuffers.root";
+   FileRaii fileGuard(file, "");
+   {
+      TFile f(file, "RECREATE", "", 0 /* uncompressed */);
+      TNamed n("n", std::string(1 << 20, 'x').c_str());
+      n.Write();
+   }
+
+   TFile f(file);
+   ASSERT_FALSE(f.IsZombie());
+   // The first three blocks fit in the read-ahead buffer and are read at once, the last one is read on its own
+   const Int_t bigLen = TFile::GetReadaheadSize();
+   Long64_t pos[] = {100, 200, 300, 600000};
+   Int_t len[] = {50, 50, 50, bigLen};
+   std::vector<char> buf(150 + bigLen);
+   const auto nCalls = f.GetReadCalls();
+   const auto nExtra = f.GetBytesReadExtra();
+   ASSERT_FALSE(f.ReadBuffers(buf.data(), pos, len, 4));
+   EXPECT_EQ(2, f.GetReadCalls() - nCalls);
+   EXPECT_EQ(100, f.GetBytesReadExtra() - nExtra);
+
+   std::size_t k = 0;
+   for (int i = 0; i < 4; ++i) {
+      std::vector<char> expected(len[i]);
+      f.Seek(pos[i]);
+      ASSERT_FALSE(f.ReadBuffer(expected.data(), len[i]));
+      EXPECT_EQ(0, memcmp(expected.data(), &buf[k], len[i]));
+      k += len[i];
+   }
+}
@@ -138,6 +138,49 @@ TEST(RRawFile, ReadV)
 }
 
 
+TEST(RRawFile, AsyncReadV)
+{
+   FileRaii readvGuard("test_rawfile_async_readv", "Hello, World");
+   auto f = RRawFile::Create("test_rawfile_async_readv");
+
+   char buffer[4];
+   RRawFile::RIOVec iovec[4];
+   for (unsigned i = 0; i < 4; ++i) {
+      buffer[i] = 0;
+      iovec[i].fBuffer = &buffer[i];
+      iovec[i].fOffset = 3 * i;
+      iovec[i].fSize = 1;
+   }
+
+   // Two handles in flight at the same time
+   RRawFile::RAsyncReadV handleA;
+   RRawFile::RAsyncReadV handleB;
+   EXPECT_TRUE(handleA.IsComplete());
+   f->SubmitReadV(&iovec[0], 2, handleA);
+   f->SubmitReadV(&iovec[2], 2, handleB);
+   EXPECT_THROW(f->SubmitReadV(&iovec[0], 2, handleB), std::runtime_error);
+   f->WaitReadV(handleB);
+   EXPECT_TRUE(handleB.IsComplete());
+   while (!f->PollReadV(handleA)) {
+   }
+
+   for (unsigned i = 0; i < 4; ++i)
+      EXPECT_EQ(1U, iovec[i].fOutBytes);
+   EXPECT_EQ('H', buffer[0]);
+   EXPECT_EQ('l', buffer[1]);
+   EXPECT_EQ(' ', buffer[2]);
+   EXPECT_EQ('r', buffer[3]);
+
+   // Handles can be reused
+   iovec[0].fOffset = 11;
+   iovec[0].fSize = 2;
+   f->SubmitReadV(&iovec[0], 1, handleA);
+   f->WaitReadV(handleA);
+   EXPECT_EQ(1U, iovec[0].fOutBytes);
+   EXPECT_EQ('d', buffer[0]);
+}
+
+
 TEST(RRawFile, SplitUrl)
 {
    EXPECT_STREQ("C:\\Data\\events.root", RRawFile::GetLocation("C:\\Data\\events.root").c_str());
@@ -26,3 +26,99 @@ TEST(TBufferFile, ROOT_8367)
    EXPECT_FLOAT_EQ(v2[6], 7.);
    EXPECT_EQ(v2.size(), 7);
 }
+
+// Round trips arrays of all primitive types through the (vectorized) byte swapping array routines,
+// with lengths that exercise both the vector body and the scalar tail
+TEST(TBufferFile, FastArrayRoundTrip)
+{
+   for (Int_t n : {1, 3, 8, 17, 64, 1001}) {
+      std::vector<Short_t> h(n);
+      std::vector<Int_t> ii(n);
+      std::vector<Long64_t> ll(n);
+      std::vector<Float_t> f(n);
+      std::vector<Double_t> d(n);
+      for (Int_t i = 0; i < n; ++i) {
+         h[i] = static_cast<Short_t>(i * 257 - 3000);
+         ii[i] = i * 16843009 - 7;
+         ll[i] = static_cast<Long64_t>(i) * 72340172838076673LL - 11;
+         f[i] = 0.25f * i - 100.f;
+         d[i] = 1.0 / (i + 1) - 3.0;
+      }
+
+      TBufferFile wbuf(TBuffer::kWrite);
+      wbuf.WriteFastArray(h.data(), n);
+      wbuf.WriteFastArray(ii.data(), n);
+      wbuf.WriteFastArray(ll.data(), n);
+      wbuf.WriteFastArray(f.data(), n);
+      wbuf.WriteFastArray(d.data(), n);
+      wbuf.WriteArray(d.data(), n);
+
+      // Values are stored in big-endian byte order
+      EXPECT_EQ(static_cast<UChar_t>(wbuf.Buffer()[0]), static_cast<UShort_t>(h[0]) >> 8);
+
+      TBufferFile rbuf(TBuffer::kRead, wbuf.Length(), wbuf.Buffer(), kFALSE);
+      std::vector<Short_t> h2(n);
+      std::vector<Int_t> ii2(n);
+      std::vector<Long64_t> ll2(n);
+      std::vector<Float_t> f2(n);
+      std::vector<Double_t> d2(n);
+      rbuf.ReadFastArray(h2.data(), n);
+      rbuf.ReadFastArray(ii2.data(), n);
+      rbuf.ReadFastArray(ll2.data(), n);
+      rbuf.ReadFastArray(f2.data(), n);
+      rbuf.ReadFastArray(d2.data(), n);
+      Double_t *d3 = nullptr;
+      EXPECT_EQ(n, rbuf.ReadArray(d3));
+      EXPECT_EQ(wbuf.Length(), rbuf.Length());
+
+      EXPECT_EQ(h, h2);
+      EXPECT_EQ(ii, ii2);
+      EXPECT_EQ(ll, ll2);
+      EXPECT_EQ(f, f2);
+      EXPECT_EQ(d, d2);
+      EXPECT_EQ(d, std::vector<Double_t>(d3, d3 + n));
+      delete[] d3;
+   }
+}
+
+TEST(TBufferFile, FastArrayFloat16Double32)
+{
+   const Int_t n = 1000;
+   std::vector<Float_t> f(n);
+   std::vector<Double_t> d(n);
+   for (Int_t i = 0; i < n; ++i) {
+      f[i] = 0.01f * i - 5.f;
+      d[i] = 0.01 * i - 5.;
+   }
+
+   TBufferFile wbuf(TBuffer::kWrite);
+   // Without a streamer element, Float16_t is stored with a 12 bit mantissa and Double32_t as float
+   wbuf.WriteFastArrayFloat16(f.data(), n, nullptr);
+   wbuf.WriteFastArrayDouble32(d.data(), n, nullptr);
+   // The range encoding of [-5, 5) with a factor of 1000
+   for (Int_t i = 0; i < n; ++i)
+      wbuf << UInt_t(0.5 + 1000. * (d[i] + 5.));
+
+   TBufferFile rbuf(TBuffer::kRead, wbuf.Length(), wbuf.Buffer(), kFALSE);
+   std::vector<Float_t> f2(n);
+   std::vector<Double_t> d2(n);
+   rbuf.ReadFastArrayFloat16(f2.data(), n, nullptr);
+   for (Int_t i = 0; i < n; ++i)
+      EXPECT_NEAR(f[i], f2[i], 1e-2) << i;
+   rbuf.ReadFastArrayDouble32(d2.data(), n, nullptr);
+   for (Int_t i = 0; i < n; ++i)
+      EXPECT_FLOAT_EQ(d[i], d2[i]) << i;
+   rbuf.ReadFastArrayWithFactor(d2.data(), n, 1000., -5.);
+   for (Int_t i = 0; i < n; ++i)
+      EXPECT_NEAR(d[i], d2[i], 1e-3) << i;
+   EXPECT_EQ(wbuf.Length(), rbuf.Length());
+
+   // The same bytes, decoded with an explicit number of bits
+   rbuf.SetBufferOffset(0);
+   rbuf.ReadFastArrayWithNbits(f2.data(), n, 12);
+   for (Int_t i = 0; i < n; ++i)
+      EXPECT_NEAR(f[i], f2[i], 1e-2) << i;
+   rbuf.ReadFastArrayWithNbits(d2.data(), n, 0);
+   for (Int_t i = 0; i < n; ++i)
+      EXPECT_FLOAT_EQ(d[i], d2[i]) << i;
+}
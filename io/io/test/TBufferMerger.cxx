@@ -160,6 +160,58 @@ TEST(TBufferMerger, AutoSave)
    RemoveFile("tbuffermerger_autosave.root");
 }
 
+TEST(TBufferMerger, MaxBuffered)
+{
+   int nevents = 16384;
+   int nthreads = 8;
+   int events_per_thread = nevents / nthreads;
+
+   ROOT::EnableThreadSafety();
+
+   {
+      TBufferMerger merger("tbuffermerger_maxbuffered.root");
+
+      merger.SetAutoSave(16 * 1024 * 1024);
+      merger.SetMaxBuffered(1);
+      EXPECT_EQ(1u, merger.GetMaxBuffered());
+
+      std::vector<std::thread> threads;
+      for (int i = 0; i < nthreads; ++i) {
+         threads.emplace_back([=, &merger]() {
+            auto myfile = merger.GetFile();
+            auto mytree = new TTree("mytree", "mytree");
+            int n = 0;
+            mytree->Branch("n", &n, "n/I");
+
+            for (int j = 0; j < events_per_thread; ++j) {
+               n = i * events_per_thread + j;
+               mytree->Fill();
+               if ((j + 1) % (events_per_thread / 4) == 0)
+                  myfile->Write();
+            }
+            mytree->ResetBranchAddresses();
+         });
+      }
+
+      for (auto &&t : threads)
+         t.join();
+
+      // Every write either merged its own file or the whole queue, nothing is left behind
+      EXPECT_EQ(0u, merger.GetQueueSize());
+      EXPECT_LE(merger.GetPeakQueueSize(), static_cast<size_t>(nthreads));
+      EXPECT_LT(0u, merger.GetNMerges());
+   }
+
+   {
+      TFile f("tbuffermerger_maxbuffered.root");
+      auto t = f.Get<TTree>("mytree");
+      ASSERT_TRUE(t != nullptr);
+      EXPECT_EQ(nevents, t->GetEntries());
+   }
+
+   RemoveFile("tbuffermerger_maxbuffered.root");
+}
+
 TEST(TBufferMerger, CheckTreeFillResults)
 {
    int sum_s, sum_p;
@@ -2,9 +2,16 @@
 
 #include "TFileMerger.h"
 
+#include "TFile.h"
+#include "TH1F.h"
 #include "TMemFile.h"
+#include "TSystem.h"
 #include "TTree.h"
 
+#include <memory>
+#include <string>
+#include <vector>
+
 static void CreateATuple(TMemFile &file, const char *name, double value)
 {
    auto mytree = new TTree(name, "A tree");
@@ -68,3 +75,49 @@ TEST(TFileMerger, CreateWithUnwritableTFilePointer)
    ROOT_EXPECT_ERROR(merger.OutputFile(std::move(output)), "TFileMerger::OutputFile",
                      "output file output.root is not writable");
 }
+
+TEST(TFileMerger, MultiThreaded)
+{
+   const int nfiles = 7;
+   std::vector<std::string> inputs;
+   for (int i = 0; i < nfiles; ++i) {
+      inputs.push_back("tfilemerger_mt_input" + std::to_string(i) + ".root");
+      TFile f(inputs.back().c_str(), "RECREATE");
+      TH1F h("h", "h", 10, 0, 10);
+      h.Fill(i % 10, i + 1);
+      h.Write();
+      auto dir = f.mkdir("dir");
+      dir->cd();
+      TH1F hd("hd", "hd", 10, 0, 10);
+      hd.Fill(1);
+      hd.Write();
+   }
+
+   for (bool histoOneGo : {false, true}) {
+      const char *outputName = "tfilemerger_mt_output.root";
+      {
+         TFileMerger merger(kFALSE, histoOneGo);
+         merger.SetNThreads(3);
+         EXPECT_EQ(3, merger.GetNThreads());
+         // Only a few files at a time, so that the next ones are opened while merging
+         merger.SetMaxOpenedFiles(5);
+         ASSERT_TRUE(merger.OutputFile(outputName, "RECREATE"));
+         for (const auto &input : inputs)
+            ASSERT_TRUE(merger.AddFile(input.c_str(), kFALSE));
+         EXPECT_TRUE(merger.Merge());
+      }
+
+      TFile f(outputName);
+      auto h = f.Get<TH1F>("h");
+      ASSERT_TRUE(h != nullptr);
+      EXPECT_FLOAT_EQ(nfiles * (nfiles + 1) / 2, h->GetSumOfWeights());
+      auto hd = f.Get<TH1F>("dir/hd");
+      ASSERT_TRUE(hd != nullptr);
+      EXPECT_FLOAT_EQ(nfiles, hd->GetEntries());
+      f.Close();
+      gSystem->Unlink(outputName);
+   }
+
+   for (const auto &input : inputs)
+      gSystem->Unlink(input.c_str());
+}
@@ -3,6 +3,7 @@
 
 #include "gtest/gtest.h"
 
+#include "TEnv.h"
 #include "TFile.h"
 #include "TKey.h"
 #include "TNamed.h"
@@ -109,6 +110,111 @@ TEST(TFile, ReadWithoutGlobalRegistrationLocal)
    gSystem->Unlink(localFile);
 }
 
+TEST(TFile, LazyKeys)
+{
+   auto filename{"tfile_lazykeys.root"};
+   {
+      TFile f{filename, "recreate"};
+      for (int i = 0; i < 1000; ++i) {
+         TNamed n{TString::Format("n%d", i), TString::Format("first %d", i)};
+         n.Write();
+      }
+      // A second cycle for some of the keys
+      for (int i = 0; i < 1000; i += 100) {
+         TNamed n{TString::Format("n%d", i), TString::Format("second %d", i)};
+         n.Write();
+      }
+      auto sub = f.mkdir("sub");
+      TNamed inner{"inner", "inner"};
+      sub->WriteObject(&inner, "inner");
+   }
+
+   std::vector<std::string> keysEager;
+   {
+      TFile f{filename};
+      for (auto key : TRangeDynCast<TKey>(f.GetListOfKeys()))
+         keysEager.push_back(std::string(key->GetName()) + ";" + std::to_string(key->GetCycle()));
+   }
+
+   const auto lazyKeys = gEnv->GetValue("TFile.LazyKeys", 0);
+   gEnv->SetValue("TFile.LazyKeys", 1);
+   {
+      TFile f{filename};
+      EXPECT_EQ(static_cast<int>(keysEager.size()), f.GetNkeys());
+
+      std::unique_ptr<TNamed> n{f.Get<TNamed>("n500")};
+      ASSERT_NE(nullptr, n);
+      EXPECT_STREQ("second 500", n->GetTitle());
+      n.reset(f.Get<TNamed>("n500;1"));
+      ASSERT_NE(nullptr, n);
+      EXPECT_STREQ("first 500", n->GetTitle());
+      n.reset(f.Get<TNamed>("n501"));
+      ASSERT_NE(nullptr, n);
+      EXPECT_STREQ("first 501", n->GetTitle());
+      EXPECT_EQ(nullptr, f.Get<TNamed>("n5000"));
+      ASSERT_NE(nullptr, f.GetKey("n7"));
+      EXPECT_EQ(2, f.GetKey("n700")->GetCycle());
+      EXPECT_EQ(1, f.GetKey("n700", 1)->GetCycle());
+
+      n.reset(f.Get<TNamed>("sub/inner"));
+      ASSERT_NE(nullptr, n);
+      EXPECT_STREQ("inner", n->GetTitle());
+
+      // The full list has the same keys in the same order as without lazy reading
+      std::vector<std::string> keysLazy;
+      for (auto key : TRangeDynCast<TKey>(f.GetListOfKeys()))
+         keysLazy.push_back(std::string(key->GetName()) + ";" + std::to_string(key->GetCycle()));
+      EXPECT_EQ(keysEager, keysLazy);
+      EXPECT_EQ(static_cast<int>(keysEager.size()), f.GetNkeys());
+   }
+   gEnv->SetValue("TFile.LazyKeys", lazyKeys);
+
+   gSystem->Unlink(filename);
+}
+
+namespace {
+/// Peek at the keys created so far, without going through GetListOfKeys
+struct TKeysPeek : TDirectoryFile {
+   static int NKeys(TDirectoryFile &dir) { return (dir.*(&TKeysPeek::fKeys))->GetSize(); }
+};
+} // anonymous namespace
+
+TEST(TFile, LazyKeysCreateOnlyLookedUp)
+{
+   auto filename{"tfile_lazykeys_lookedup.root"};
+   {
+      TFile f{filename, "recreate"};
+      for (int i = 0; i < 100; ++i) {
+         TNamed n{TString::Format("n%d", i).Data(), "n"};
+         n.Write();
+      }
+      auto sub = f.mkdir("sub");
+      TNamed inner{"inner", "inner"};
+      sub->WriteObject(&inner, "inner");
+   }
+
+   const auto lazyKeys = gEnv->GetValue("TFile.LazyKeys", 0);
+   gEnv->SetValue("TFile.LazyKeys", 1);
+   {
+      TFile f{filename};
+      EXPECT_EQ(0, TKeysPeek::NKeys(f));
+      std::unique_ptr<TNamed> n{f.Get<TNamed>("n50")};
+      ASSERT_NE(nullptr, n);
+      EXPECT_EQ(1, TKeysPeek::NKeys(f));
+
+      // Searching the sub-directories only creates the keys of the sub-directories
+      ASSERT_NE(nullptr, f.FindKeyAny("inner"));
+      EXPECT_EQ(2, TKeysPeek::NKeys(f));
+
+      // Deleting the keys on close must not create the others
+      f.Close();
+      EXPECT_EQ(0, TKeysPeek::NKeys(f));
+   }
+   gEnv->SetValue("TFile.LazyKeys", lazyKeys);
+
+   gSystem->Unlink(filename);
+}
+
 void TestReadWithoutGlobalRegistrationIfPossible(const char *fname)
 {
    TPluginHandler *h;
@@ -46,6 +46,7 @@ public:
    std::string GetTypeName(std::string_view colName) const final;
    bool HasColumn(std::string_view colName) const final;
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
+   bool SupportsRangeSplitting() const final { return true; }
    void InitSlot(unsigned int slot, ULong64_t firstEntry) final;
    void SetNSlots(unsigned int nSlots) final;
    void Initialize() final;
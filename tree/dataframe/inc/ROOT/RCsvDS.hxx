@@ -88,6 +88,7 @@ public:
    std::string GetTypeName(std::string_view colName) const final;
    bool HasColumn(std::string_view colName) const final;
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
+   bool SupportsRangeSplitting() const final { return true; }
    void SetNSlots(unsigned int nSlots) final;
    std::string GetLabel() final;
 };
@@ -62,6 +62,8 @@
 /// \cond HIDDEN_SYMBOLS
 
 namespace ROOT {
+class RDataFrame;
+
 namespace Internal {
 namespace RDF {
 using namespace ROOT::TypeTraits;
@@ -181,6 +183,7 @@ public:
    CountHelper(const CountHelper &) = delete;
    void InitTask(TTreeReader *, unsigned int) {}
    void Exec(unsigned int slot);
+   void ExecBulk(unsigned int slot, const RMaskedEntryRange &mask, std::size_t bulkSize);
    void Initialize() { /* noop */}
    void Finalize();
 
@@ -310,6 +313,41 @@ public:
         "Cannot fill object if the type of the first column is a scalar and the one of the second a container.");
    }
 
+   /// Bulk mode: append the values of the selected entries to the buffer of the slot
+   template <typename T, std::enable_if_t<std::is_arithmetic<T>::value, int> = 0>
+   void ExecBulk(unsigned int slot, const RMaskedEntryRange &mask, std::size_t bulkSize, const T *values)
+   {
+      auto &thisBuf = fBuffers[slot];
+      BufEl_t thisMin = fMin[slot * CacheLineStep<BufEl_t>()];
+      BufEl_t thisMax = fMax[slot * CacheLineStep<BufEl_t>()];
+      for (std::size_t i = 0u; i < bulkSize; ++i) {
+         if (!mask[i])
+            continue;
+         const BufEl_t v = values[i];
+         thisMin = std::min(thisMin, v);
+         thisMax = std::max(thisMax, v);
+         thisBuf.emplace_back(v);
+      }
+      fMin[slot * CacheLineStep<BufEl_t>()] = thisMin;
+      fMax[slot * CacheLineStep<BufEl_t>()] = thisMax;
+   }
+
+   /// Bulk mode: append the values and the weights of the selected entries to the buffers of the slot
+   template <typename T, typename W,
+             std::enable_if_t<std::is_arithmetic<T>::value && std::is_arithmetic<W>::value, int> = 0>
+   void ExecBulk(unsigned int slot, const RMaskedEntryRange &mask, std::size_t bulkSize, const T *values,
+                 const W *weights)
+   {
+      const auto nBefore = fBuffers[slot].size();
+      ExecBulk(slot, mask, bulkSize, values);
+      auto &thisWBuf = fWBuffers[slot];
+      thisWBuf.reserve(thisWBuf.size() + fBuffers[slot].size() - nBefore);
+      for (std::size_t i = 0u; i < bulkSize; ++i) {
+         if (mask[i])
+            thisWBuf.emplace_back(weights[i]);
+      }
+   }
+
    Hist_t &PartialUpdate(unsigned int);
 
    void Initialize() { /* noop */}
@@ -450,6 +488,37 @@ class R__CLING_PTRCHECK(off) FillHelper : public RActionImpl<FillHelper<HIST>> {
 #endif
    }
 
+   /// Per-slot buffers of the values and weights of the selected entries of a bulk, see FillNBulk
+   std::vector<std::vector<double>> fBulkValues;
+   std::vector<std::vector<double>> fBulkWeights;
+
+   /// Gather the selected entries of the bulk and fill them with TH1::FillN. Returns false if the object is not a
+   /// one-dimensional histogram or the columns are not arithmetic values (and weights). Profiles are excluded: their
+   /// second column is the profiled value, not a weight, and TProfile::FillN(n, x, y) is not usable.
+   template <typename T, typename W = double,
+             std::enable_if_t<std::is_arithmetic<T>::value && std::is_arithmetic<W>::value, int> = 0>
+   bool FillNBulk(TH1 *h, unsigned int slot, const RMaskedEntryRange &mask, std::size_t bulkSize, const T *values,
+                  const W *weights = nullptr)
+   {
+      if (h->GetDimension() != 1 || h->InheritsFrom("TProfile"))
+         return false;
+      auto &x = fBulkValues[slot];
+      auto &w = fBulkWeights[slot];
+      x.clear();
+      w.clear();
+      for (std::size_t i = 0u; i < bulkSize; ++i) {
+         if (!mask[i])
+            continue;
+         x.emplace_back(values[i]);
+         if (weights)
+            w.emplace_back(weights[i]);
+      }
+      h->FillN(static_cast<Int_t>(x.size()), x.data(), weights ? w.data() : nullptr);
+      return true;
+   }
+
+   bool FillNBulk(const void *, unsigned int, const RMaskedEntryRange &, std::size_t, ...) { return false; }
+
    template <std::size_t ColIdx, typename End_t, typename... Its>
    void ExecLoop(unsigned int slot, End_t end, Its... its)
    {
@@ -466,7 +535,8 @@ public:
    FillHelper(FillHelper &&) = default;
    FillHelper(const FillHelper &) = delete;
 
-   FillHelper(const std::shared_ptr<HIST> &h, const unsigned int nSlots) : fObjects(nSlots, nullptr)
+   FillHelper(const std::shared_ptr<HIST> &h, const unsigned int nSlots)
+      : fObjects(nSlots, nullptr), fBulkValues(nSlots), fBulkWeights(nSlots)
    {
       fObjects[0] = h.get();
       // Initialize all other slots
@@ -520,6 +590,20 @@ public:
                     "columns passed did not match the signature of the object's `Fill` method.");
    }
 
+   /// Bulk mode, scalar columns only. One-dimensional histograms filled with a value and optionally a weight are
+   /// filled with a single FillN call per bulk, other objects entry by entry.
+   template <typename... ValTypes, std::enable_if_t<!Disjunction<IsDataContainer<ValTypes>...>::value, int> = 0>
+   auto ExecBulk(unsigned int slot, const RMaskedEntryRange &mask, std::size_t bulkSize, const ValTypes *...values)
+      -> decltype(fObjects[slot]->Fill(*values...), void())
+   {
+      if (FillNBulk(fObjects[slot], slot, mask, bulkSize, values...))
+         return;
+      for (std::size_t i = 0u; i < bulkSize; ++i) {
+         if (mask[i])
+            fObjects[slot]->Fill(values[i]...);
+      }
+   }
+
    void Initialize() { /* noop */}
 
    void Finalize()
@@ -1161,6 +1245,25 @@ public:
       }
    }
 
+   /// Bulk mode: the same Kahan sum as Exec, with the partial sum of the slot kept in local variables
+   template <typename T, std::enable_if_t<!IsDataContainer<T>::value, int> = 0>
+   void ExecBulk(unsigned int slot, const RMaskedEntryRange &mask, std::size_t bulkSize, const T *values)
+   {
+      ResultType sum = fSums[slot];
+      ResultType compensation = fCompensations[slot];
+      for (std::size_t i = 0u; i < bulkSize; ++i) {
+         if (!mask[i])
+            continue;
+         const ResultType x = values[i];
+         ResultType y = x - compensation;
+         ResultType t = sum + y;
+         compensation = (t - sum) - y;
+         sum = t;
+      }
+      fSums[slot] = sum;
+      fCompensations[slot] = compensation;
+   }
+
    void Initialize() { /* noop */}
 
    void Finalize()
@@ -1225,6 +1328,27 @@ public:
       }
    }
 
+   /// Bulk mode: the same Kahan sum as Exec, with the partial sum of the slot kept in local variables
+   template <typename T, std::enable_if_t<std::is_arithmetic<T>::value, int> = 0>
+   void ExecBulk(unsigned int slot, const RMaskedEntryRange &mask, std::size_t bulkSize, const T *values)
+   {
+      ULong64_t count = 0ull;
+      double sum = fSums[slot];
+      double compensation = fCompensations[slot];
+      for (std::size_t i = 0u; i < bulkSize; ++i) {
+         if (!mask[i])
+            continue;
+         ++count;
+         double y = values[i] - compensation;
+         double t = sum + y;
+         compensation = (t - sum) - y;
+         sum = t;
+      }
+      fCounts[slot] += count;
+      fSums[slot] = sum;
+      fCompensations[slot] = compensation;
+   }
+
    void Initialize() { /* noop */}
 
    void Finalize();
@@ -1647,6 +1771,9 @@ public:
    {
       return [this](unsigned int, const RSampleInfo &) mutable { fBranchAddressesNeedReset = true; };
    }
+
+   // the output branches point to the addresses of the input values, which change entry by entry in bulk mode
+   bool SupportsBulk() const final { return false; }
 };
 
 /// Helper object for a multi-thread Snapshot action
@@ -1814,6 +1941,80 @@ public:
    {
       return [this](unsigned int slot, const RSampleInfo &) mutable { fBranchAddressesNeedReset[slot] = 1; };
    }
+
+   // the output branches point to the addresses of the input values, which change entry by entry in bulk mode
+   bool SupportsBulk() const final { return false; }
+};
+
+/// Type-erased writer of a Snapshot with RNTuple output. The implementation lives in the RNTuple-aware part of
+/// the library so that this header does not depend on RNTuple.
+class RSnapshotNTupleWriterBase {
+public:
+   virtual ~RSnapshotNTupleWriterBase() = default;
+   /// Write one entry from the given processing slot; `values` holds the address of every output column value
+   virtual void Fill(unsigned int slot, void *const *values) = 0;
+   /// Commit the remaining entries and close the output file
+   virtual void Finalize() = 0;
+};
+
+/// Throws if RNTuple output is not available in this build or if a column type is not supported by RNTuple
+std::unique_ptr<RSnapshotNTupleWriterBase>
+MakeSnapshotNTupleWriter(const std::string &fileName, const std::string &dirName, const std::string &ntupleName,
+                         const ColumnNames_t &fieldNames, const std::vector<std::string> &fieldTypes,
+                         const RSnapshotOptions &options, unsigned int nSlots);
+
+/// The data frame returned by a Snapshot with RNTuple output.  It can be used right away: the RNTuple is opened
+/// when its own event loop starts, which needs to happen after the Snapshot ran.
+std::shared_ptr<ROOT::RDataFrame>
+MakeSnapshotNTupleDataFrame(const std::string &fileName, const std::string &ntupleName,
+                            const ColumnNames_t &fieldNames, const std::vector<std::string> &fieldTypes);
+
+/// Helper object for a Snapshot action with RNTuple output, used both single- and multi-thread
+template <typename... ColTypes>
+class R__CLING_PTRCHECK(off) SnapshotRNTupleHelper : public RActionImpl<SnapshotRNTupleHelper<ColTypes...>> {
+   unsigned int fNSlots;
+   std::string fFileName;
+   std::string fDirName;
+   std::string fNTupleName;
+   RSnapshotOptions fOptions;
+   ColumnNames_t fOutputFieldNames;
+   std::unique_ptr<RSnapshotNTupleWriterBase> fWriter;
+
+public:
+   using ColumnTypes_t = TypeList<ColTypes...>;
+   SnapshotRNTupleHelper(unsigned int nSlots, std::string_view filename, std::string_view dirname,
+                         std::string_view ntuplename, const ColumnNames_t &bnames, const RSnapshotOptions &options)
+      : fNSlots(nSlots), fFileName(filename), fDirName(dirname), fNTupleName(ntuplename), fOptions(options),
+        fOutputFieldNames(ReplaceDotWithUnderscore(bnames))
+   {
+      ValidateSnapshotOutput(fOptions, fNTupleName, fFileName);
+   }
+   SnapshotRNTupleHelper(const SnapshotRNTupleHelper &) = delete;
+   SnapshotRNTupleHelper(SnapshotRNTupleHelper &&) = default;
+   ~SnapshotRNTupleHelper()
+   {
+      if (!fNTupleName.empty() /*not moved from*/ && !fWriter /* did not run */ && fOptions.fLazy)
+         Warning("Snapshot", "A lazy Snapshot action was booked but never triggered.");
+   }
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   void Initialize()
+   {
+      fWriter = MakeSnapshotNTupleWriter(fFileName, fDirName, fNTupleName, fOutputFieldNames,
+                                         {TypeID2TypeName(typeid(ColTypes))...}, fOptions, fNSlots);
+   }
+
+   void Exec(unsigned int slot, ColTypes &... values)
+   {
+      // the trailing element keeps the array valid for a Snapshot without columns
+      void *const addresses[] = {static_cast<void *>(&values)..., nullptr};
+      fWriter->Fill(slot, addresses);
+   }
+
+   void Finalize() { fWriter->Finalize(); }
+
+   std::string GetActionName() { return "Snapshot"; }
 };
 
 template <typename Acc, typename Merge, typename R, typename T, typename U,
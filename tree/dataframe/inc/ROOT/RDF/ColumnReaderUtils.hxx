@@ -11,6 +11,7 @@
 #ifndef ROOT_RDF_COLUMNREADERUTILS
 #define ROOT_RDF_COLUMNREADERUTILS
 
+#include "RBulkColumnReader.hxx"
 #include "RColumnReaderBase.hxx"
 #include "RColumnRegister.hxx"
 #include "RDefineBase.hxx"
@@ -55,8 +56,12 @@ RDFDetail::RColumnReaderBase *GetColumnReader(unsigned int slot, RColumnReaderBa
 
    assert(r != nullptr && "We could not find a reader for this column, this should never happen at this point.");
 
-   // Make a RTreeColumnReader for this column and insert it in RLoopManager's map
-   auto treeColReader = std::make_unique<RTreeColumnReader<T>>(*r, colName);
+   // Make a tree column reader for this column and insert it in RLoopManager's map
+   auto treeColReader = MakeTreeColumnReader<T>(*r, colName);
+   // in bulk mode, the values of the entries of a bulk are collected by a wrapper reader
+   if (lm.GetLoopBulkSize() > 1)
+      return lm.AddTreeColumnReader(
+         slot, colName, MakeBulkColumnReader<T>(std::move(treeColReader), lm.GetLoopBulkSize()), typeid(T));
    return lm.AddTreeColumnReader(slot, colName, std::move(treeColReader), typeid(T));
 }
 
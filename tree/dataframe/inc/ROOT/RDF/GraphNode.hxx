@@ -51,6 +51,16 @@ class GraphNode {
 
    std::string fName, fColor, fShape;
 
+   /// The expression of the node (e.g. the jitted code of a Filter). It is not part of the dot representation, but it
+   /// distinguishes nodes with the same name when the graph is used to identify a computation (e.g. PersistentCache).
+   std::string fExpression;
+
+   /// The input columns of the node (e.g. of a Define). Like the expression, they identify the computation.
+   std::vector<std::string> fInputColumns;
+
+   /// Whether the expression is the type name of a compiled callable, which does not identify the computation.
+   bool fIsCompiled = false;
+
    /// Columns defined up to this node. By checking the defined columns between two consecutive
    /// nodes, it is possible to know if there was some Define in between.
    std::vector<std::string> fDefinedColumns;
@@ -133,10 +143,17 @@ public:
    /// \brief Adds the column defined up to the node
    void AddDefinedColumns(const std::vector<std::string> &columns) { fDefinedColumns = columns; }
 
+   void SetExpression(const std::string &expression) { fExpression = expression; }
+   void SetInputColumns(const std::vector<std::string> &columns) { fInputColumns = columns; }
+   void SetCompiled(bool isCompiled) { fIsCompiled = isCompiled; }
+
    std::string GetColor() const { return fColor; }
    unsigned int GetID() const { return fID; }
    std::string GetName() const { return fName; }
    std::string GetShape() const { return fShape; }
+   const std::string &GetExpression() const { return fExpression; }
+   const std::vector<std::string> &GetInputColumns() const { return fInputColumns; }
+   bool IsCompiled() const { return fIsCompiled; }
    GraphNode *GetPrevNode() const { return fPrevNode.get(); }
 
    ////////////////////////////////////////////////////////////////////////////
@@ -44,6 +44,7 @@
 class TObjArray;
 class TTree;
 namespace ROOT {
+class RDataFrame;
 namespace Detail {
 namespace RDF {
 class RNodeBase;
@@ -266,6 +267,14 @@ BuildAction(const ColumnNames_t &colNames, const std::shared_ptr<SnapshotHelperA
    const auto &outputColNames = snapHelperArgs->fOutputColNames;
    const auto &options = snapHelperArgs->fOptions;
 
+   if (options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple) {
+      using Helper_t = SnapshotRNTupleHelper<ColTypes...>;
+      using Action_t = RAction<Helper_t, PrevNodeType>;
+      const unsigned int nWriterSlots = ROOT::IsImplicitMTEnabled() ? nSlots : 1u;
+      return std::make_unique<Action_t>(Helper_t(nWriterSlots, filename, dirname, treename, outputColNames, options),
+                                        colNames, prevNode, colRegister);
+   }
+
    auto makeIsDefine = [&] {
       std::vector<bool> isDef;
       isDef.reserve(sizeof...(ColTypes));
@@ -329,6 +338,10 @@ void CheckForNoVariations(const std::string &where, std::string_view definedColV
 
 std::string PrettyPrintAddr(const void *const addr);
 
+void SetJitCacheDir(const std::string &cacheDir);
+
+void SetJittedNodeSharing(bool enable);
+
 std::shared_ptr<RJittedFilter> BookFilterJit(std::shared_ptr<RNodeBase> *prevNodeOnHeap, std::string_view name,
                                              std::string_view expression, const ColumnNames_t &branches,
                                              const RColumnRegister &colRegister, TTree *tree, RDataSource *ds);
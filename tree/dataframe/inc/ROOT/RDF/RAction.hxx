@@ -113,6 +113,21 @@ public:
          CallExec(slot, entry, ColumnTypes_t{}, TypeInd_t{});
    }
 
+   template <typename... ColTypes, std::size_t... S>
+   void CallExecBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask, std::size_t bulkSize,
+                     TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      fHelper.CallExecBulk(slot, mask, bulkSize, fValues[slot][S]->template GetBulk<ColTypes>(mask, bulkSize)...);
+   }
+
+   void RunBulk(unsigned int slot, std::size_t bulkSize) final
+   {
+      const auto &mask = fPrevNode.CheckFiltersBulk(slot, bulkSize);
+      CallExecBulk(slot, mask, bulkSize, ColumnTypes_t{}, TypeInd_t{});
+   }
+
+   bool SupportsBulk() const final { return fHelper.SupportsBulk(); }
+
    void TriggerChildrenCount() final { fPrevNode.IncrChildrenCount(); }
 
    /// Clean-up operations to be performed at the end of a task.
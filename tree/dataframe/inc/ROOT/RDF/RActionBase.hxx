@@ -64,6 +64,10 @@ public:
    RLoopManager *GetLoopManager() { return fLoopManager; }
    unsigned int GetNSlots() const { return fNSlots; }
    virtual void Run(unsigned int slot, Long64_t entry) = 0;
+   /// Process the entries of the current bulk that pass all upstream filters (bulk mode).
+   virtual void RunBulk(unsigned int slot, std::size_t bulkSize) = 0;
+   /// Whether this action can be executed in bulk mode.
+   virtual bool SupportsBulk() const = 0;
    virtual void Initialize() = 0;
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    virtual void TriggerChildrenCount() = 0;
@@ -9,8 +9,10 @@
 #ifndef ROOT_RDF_DETAIL_RACTIONIMPL
 #define ROOT_RDF_DETAIL_RACTIONIMPL
 
+#include <ROOT/RDF/RMaskedEntryRange.hxx>
 #include <ROOT/RDF/RSampleInfo.hxx> // SampleCallback_t
 
+#include <cstddef> // std::size_t
 #include <memory> // std::unique_ptr
 #include <stdexcept> // std::logic_error
 #include <utility> // std::declval
@@ -24,6 +26,25 @@ class RMergeableValueBase;
 /// Base class for action helpers, see RInterface::Book() for more information.
 template <typename Helper>
 class R__CLING_PTRCHECK(off) RActionImpl {
+   template <typename T = Helper, typename... ColTypes>
+   auto CallExecBulkImpl(int, unsigned int slot, const ROOT::Internal::RDF::RMaskedEntryRange &mask,
+                         std::size_t bulkSize, ColTypes *...values)
+      -> decltype(std::declval<T>().ExecBulk(slot, mask, bulkSize, values...), void())
+   {
+      static_cast<Helper *>(this)->ExecBulk(slot, mask, bulkSize, values...);
+   }
+
+   template <typename... ColTypes>
+   void CallExecBulkImpl(long, unsigned int slot, const ROOT::Internal::RDF::RMaskedEntryRange &mask,
+                         std::size_t bulkSize, ColTypes *...values)
+   {
+      for (std::size_t i = 0u; i < bulkSize; ++i) {
+         if (mask[i])
+            static_cast<Helper *>(this)->Exec(slot, values[i]...);
+      }
+      (void)mask; // avoid unused parameter warnings (gcc 12.1)
+   }
+
 public:
    virtual ~RActionImpl() = default;
    // call Helper::FinalizeTask if present, do nothing otherwise
@@ -36,6 +57,15 @@ public:
    template <typename... Args>
    void CallFinalizeTask(unsigned int, Args...) {}
 
+   /// Call Helper::ExecBulk if present, otherwise call Helper::Exec for each entry selected by the mask (bulk mode).
+   /// values[i] is the value of the corresponding column for entry mask.FirstEntry() + i.
+   template <typename... ColTypes>
+   void CallExecBulk(unsigned int slot, const ROOT::Internal::RDF::RMaskedEntryRange &mask, std::size_t bulkSize,
+                     ColTypes *...values)
+   {
+      CallExecBulkImpl(0, slot, mask, bulkSize, values...);
+   }
+
    template <typename H = Helper>
    auto CallPartialUpdate(unsigned int slot) -> decltype(std::declval<H>().PartialUpdate(slot), (void *)(nullptr))
    {
@@ -71,6 +101,10 @@ public:
    /// Override this method to register a callback that is executed before the processing a new data sample starts.
    /// The callback will be invoked in the same conditions as with DefinePerSample().
    virtual ROOT::RDF::SampleCallback_t GetSampleCallback() { return {}; }
+
+   /// Override this method to return false if the helper relies on the addresses of the input values staying the
+   /// same across entries. Event loops that book such actions are not executed in bulk mode.
+   virtual bool SupportsBulk() const { return true; }
 };
 
 } // namespace RDF
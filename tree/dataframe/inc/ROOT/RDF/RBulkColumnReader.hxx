@@ -0,0 +1,110 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RBULKCOLUMNREADER
+#define ROOT_RDF_RBULKCOLUMNREADER
+
+#include "RColumnReaderBase.hxx"
+#include "Utils.hxx" // TypeID2TypeName
+#include <Rtypes.h>  // Long64_t, R__CLING_PTRCHECK
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// Base class of the column readers that collect the values of a dataset column for a bulk of entries.
+/// RLoopManager calls Stage once per entry while it builds the bulk.
+class R__CLING_PTRCHECK(off) RBulkColumnReaderBase : public ROOT::Detail::RDF::RColumnReaderBase {
+public:
+   /// Make the value of the current entry available as the idx-th element of the bulk.
+   virtual void Stage(std::size_t idx, Long64_t entry) = 0;
+};
+
+/// Column reader that wraps the reader of a TTree column and exposes the values of a whole bulk of entries.
+/// As long as the values of the staged entries are adjacent in the storage of the wrapped reader (e.g. the decoded
+/// basket of an RTreeBulkColumnReader), the bulk is a view on that storage. Otherwise the values are copied while the
+/// TTreeReader is positioned on each entry, as TTree column readers can only serve the current entry.
+template <typename T>
+class R__CLING_PTRCHECK(off) RBulkColumnReader final : public RBulkColumnReaderBase {
+   std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> fReader; ///< The reader of the wrapped column
+   std::unique_ptr<T[]> fValues;                                  ///< The values of the staged entries, if copied
+   T *fDirect = nullptr; ///< The values of the staged entries in the storage of fReader, or nullptr if copied
+   Long64_t fFirstEntry = -1; ///< The entry number of the first element of the bulk
+
+   T *Values() { return fDirect ? fDirect : fValues.get(); }
+
+   void *GetImpl(Long64_t entry) final { return Values() + (entry - fFirstEntry); }
+
+   void *GetBulkImpl(const RMaskedEntryRange &, std::size_t) final { return Values(); }
+
+public:
+   RBulkColumnReader(std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> reader, std::size_t bulkSize)
+      : fReader(std::move(reader)), fValues(new T[bulkSize])
+   {
+   }
+
+   void Stage(std::size_t idx, Long64_t entry) final
+   {
+      if (idx == 0) {
+         fFirstEntry = entry;
+         // make sure the value is loaded, then check whether it can be accessed in place
+         fValues[0] = fReader->template Get<T>(entry);
+         fDirect = fReader->template TryGetContiguous<T>(entry);
+         return;
+      }
+      if (fDirect) {
+         if (fReader->template TryGetContiguous<T>(entry) == fDirect + idx)
+            return;
+         // the bulk leaves the storage of fReader (e.g. it crosses a basket boundary): copy the values staged so far
+         // before fReader overwrites them
+         std::copy(fDirect, fDirect + idx, fValues.get());
+         fDirect = nullptr;
+      }
+      fValues[idx] = fReader->template Get<T>(entry);
+   }
+};
+
+template <typename T>
+std::unique_ptr<RBulkColumnReaderBase>
+MakeBulkColumnReader(std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> reader, std::size_t bulkSize,
+                     std::true_type /*canStage*/)
+{
+   return std::unique_ptr<RBulkColumnReaderBase>(new RBulkColumnReader<T>(std::move(reader), bulkSize));
+}
+
+template <typename T>
+std::unique_ptr<RBulkColumnReaderBase>
+MakeBulkColumnReader(std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>, std::size_t, std::false_type /*canStage*/)
+{
+   throw std::runtime_error("RDataFrame: columns of type " + TypeID2TypeName(typeid(T)) +
+                            " cannot be read in bulk mode, as they are not default-constructible and copy-assignable. "
+                            "Please disable bulk mode by setting the bulk size to 1.");
+}
+
+/// Wrap the reader of a dataset column so that its values can be processed in bulks of bulkSize entries.
+template <typename T>
+std::unique_ptr<RBulkColumnReaderBase>
+MakeBulkColumnReader(std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> reader, std::size_t bulkSize)
+{
+   using CanStage_t =
+      std::integral_constant<bool, std::is_default_constructible<T>::value && std::is_copy_assignable<T>::value>;
+   return MakeBulkColumnReader<T>(std::move(reader), bulkSize, CanStage_t{});
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -13,7 +13,16 @@
 
 #include <Rtypes.h>
 
+#include <cstddef>
+#include <stdexcept>
+
 namespace ROOT {
+namespace Internal {
+namespace RDF {
+class RMaskedEntryRange;
+}
+} // namespace Internal
+
 namespace Detail {
 namespace RDF {
 
@@ -38,8 +47,35 @@ public:
       return *static_cast<T *>(GetImpl(entry));
    }
 
+   /// Return a pointer to the column values of all entries in the given range (bulk mode).
+   /// Only the values of the entries selected by the mask are guaranteed to be valid.
+   /// \tparam T The column type
+   /// \param mask The range of entries and the mask of the selected ones
+   /// \param bulkSize The number of entries in the range
+   template <typename T>
+   T *GetBulk(const ROOT::Internal::RDF::RMaskedEntryRange &mask, std::size_t bulkSize)
+   {
+      return static_cast<T *>(GetBulkImpl(mask, bulkSize));
+   }
+
+   /// Return the address of the value of the given entry if it is already held, without reading anything, in storage
+   /// owned by the reader where the values of consecutive entries are adjacent. Return nullptr otherwise.
+   /// The address stays valid until the reader is asked for a value that is not in that storage.
+   /// \tparam T The column type
+   /// \param entry The entry number
+   template <typename T>
+   T *TryGetContiguous(Long64_t entry)
+   {
+      return static_cast<T *>(TryGetContiguousImpl(entry));
+   }
+
 private:
    virtual void *GetImpl(Long64_t entry) = 0;
+   virtual void *TryGetContiguousImpl(Long64_t /*entry*/) { return nullptr; }
+   virtual void *GetBulkImpl(const ROOT::Internal::RDF::RMaskedEntryRange & /*mask*/, std::size_t /*bulkSize*/)
+   {
+      throw std::logic_error("This column reader does not support bulk reading.");
+   }
 };
 
 } // namespace RDF
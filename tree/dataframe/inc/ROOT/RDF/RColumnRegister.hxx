@@ -126,6 +126,8 @@ public:
 
    RDFDetail::RDefineBase *GetDefine(const std::string &colName) const;
 
+   void SetDefinesUsed(const ColumnNames_t &columns) const;
+
    bool IsDefineOrAlias(std::string_view name) const;
 
    void AddDefine(std::shared_ptr<RDFDetail::RDefineBase> column);
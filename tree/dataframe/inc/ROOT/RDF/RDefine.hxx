@@ -15,6 +15,7 @@
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RStringView.hxx"
 #include "ROOT/TypeTraits.hxx"
@@ -22,6 +23,8 @@
 
 #include <array>
 #include <deque>
+#include <memory>
+#include <tuple>
 #include <type_traits>
 #include <utility> // std::index_sequence
 #include <vector>
@@ -66,6 +69,14 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    /// Column readers per slot and per input column
    std::vector<std::array<RColumnReaderBase *, ColumnTypes_t::list_size>> fValues;
 
+   /// Values computed in bulk mode for one range of entries, and the mask of the entries already evaluated.
+   struct RBulkValues {
+      std::unique_ptr<ret_type[]> fValues;
+      std::size_t fSize = 0;
+      RDFInternal::RMaskedEntryRange fLoaded;
+   };
+   std::vector<RBulkValues> fBulkValues; ///< Per-slot values computed in bulk mode
+
    /// Define objects corresponding to systematic variations other than nominal for this defined column.
    /// The map key is the full variation name, e.g. "pt:up".
    std::unordered_map<std::string, std::unique_ptr<RDefineBase>> fVariedDefines;
@@ -94,13 +105,49 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
          fExpression(slot, entry, fValues[slot][S]->template Get<ColTypes>(entry)...);
    }
 
+   template <typename... Args>
+   ret_type EvalBulk(unsigned int, Long64_t, NoneTag, Args &...args)
+   {
+      return fExpression(args...);
+   }
+
+   template <typename... Args>
+   ret_type EvalBulk(unsigned int slot, Long64_t, SlotTag, Args &...args)
+   {
+      return fExpression(slot, args...);
+   }
+
+   template <typename... Args>
+   ret_type EvalBulk(unsigned int slot, Long64_t entry, SlotAndEntryTag, Args &...args)
+   {
+      return fExpression(slot, entry, args...);
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void UpdateBulkHelper(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask, std::size_t bulkSize,
+                         TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      auto &bulk = fBulkValues[slot];
+      // the input values are retrieved once per range, then the expression is evaluated entry by entry
+      std::tuple<ColTypes *...> columns{fValues[slot][S]->template GetBulk<ColTypes>(mask, bulkSize)...};
+      for (std::size_t i = 0u; i < bulkSize; ++i) {
+         if (mask[i] && !bulk.fLoaded[i]) {
+            bulk.fValues[i] = EvalBulk(slot, mask.FirstEntry() + i, ExtraArgsTag{}, std::get<S>(columns)[i]...);
+            bulk.fLoaded[i] = true;
+         }
+      }
+      (void)columns; // avoid unused variable warnings when there are no input columns
+   }
+
 public:
    RDefine(std::string_view name, std::string_view type, F expression, const ROOT::RDF::ColumnNames_t &columns,
            const RDFInternal::RColumnRegister &colRegister, RLoopManager &lm,
            const std::string &variationName = "nominal")
       : RDefineBase(name, type, colRegister, lm, columns, variationName), fExpression(std::move(expression)),
-        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fValues(lm.GetNSlots())
+        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fValues(lm.GetNSlots()),
+        fBulkValues(lm.GetNSlots())
    {
+      fExpressionStr = typeid(F).name();
       fLoopManager->Register(this);
    }
 
@@ -113,6 +160,7 @@ public:
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
       fValues[slot] = RDFInternal::GetColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fBulkValues[slot].fLoaded.SetFirstEntry(-1);
    }
 
    /// Return the (type-erased) address of the Define'd value for the given processing slot.
@@ -133,6 +181,24 @@ public:
 
    void Update(unsigned int /*slot*/, const ROOT::RDF::RSampleInfo &/*id*/) final {}
 
+   /// Evaluate the expression for the entries selected by the mask that were not evaluated yet for this range.
+   void *UpdateBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask, std::size_t bulkSize) final
+   {
+      auto &bulk = fBulkValues[slot];
+      if (bulk.fSize < bulkSize) {
+         bulk.fValues.reset(new ret_type[bulkSize]);
+         bulk.fSize = bulkSize;
+         bulk.fLoaded = RDFInternal::RMaskedEntryRange(bulkSize);
+         bulk.fLoaded.SetFirstEntry(-1);
+      }
+      if (bulk.fLoaded.FirstEntry() != mask.FirstEntry()) {
+         bulk.fLoaded.SetAll(false);
+         bulk.fLoaded.SetFirstEntry(mask.FirstEntry());
+      }
+      UpdateBulkHelper(slot, mask, bulkSize, ColumnTypes_t{}, TypeInd_t{});
+      return bulk.fValues.get();
+   }
+
    const std::type_info &GetTypeId() const final { return typeid(ret_type); }
 
    /// Clean-up operations to be performed at the end of a task.
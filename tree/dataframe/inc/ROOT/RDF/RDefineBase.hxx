@@ -29,6 +29,11 @@ namespace ROOT {
 namespace RDF {
 class RDataSource;
 }
+namespace Internal {
+namespace RDF {
+class RMaskedEntryRange;
+}
+} // namespace Internal
 namespace Detail {
 namespace RDF {
 
@@ -48,6 +53,9 @@ protected:
    ROOT::RVecB fIsDefine;
    std::vector<std::string> fVariationDeps; ///< List of systematic variations that affect the value of this define.
    std::string fVariation;                  ///< This indicates for what variation this define evaluates values.
+   /// The expression of a jitted Define, or the (mangled) type name of the callable of a compiled one.
+   std::string fExpressionStr;
+   bool fIsUsed = true; ///< Whether the values of this define are read in the next event loop
 
 public:
    RDefineBase(std::string_view name, std::string_view type, const RDFInternal::RColumnRegister &colRegister,
@@ -62,10 +70,20 @@ public:
    virtual const std::type_info &GetTypeId() const = 0;
    std::string GetName() const;
    std::string GetTypeName() const;
+   const std::string &GetExpression() const { return fExpressionStr; }
+   const ColumnNames_t &GetColumnNames() const { return fColumnNames; }
+   const std::string &GetVariation() const { return fVariation; }
+   /// Mark this define, and the defines it reads, as read in the next event loop.
+   virtual void SetUsed();
+   void ResetUsed() { fIsUsed = false; }
+   bool IsUsed() const { return fIsUsed; }
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    virtual void Update(unsigned int slot, Long64_t entry) = 0;
    /// Update function to be called once per sample, used if the derived type is a RDefinePerSample
    virtual void Update(unsigned int /*slot*/, const ROOT::RDF::RSampleInfo &/*id*/) {}
+   /// Evaluate the defined values for the entries selected by the mask (bulk mode) and return the address of the
+   /// first element of the array of values, which holds one element per entry of the range.
+   virtual void *UpdateBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask, std::size_t bulkSize) = 0;
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinalizeSlot(unsigned int slot) = 0;
 
@@ -12,12 +12,16 @@
 #define ROOT_RDF_RDEFINEPERSAMPLE
 
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include <ROOT/RDF/RDefineBase.hxx>
 #include <ROOT/TypeTraits.hxx>
 
+#include <algorithm>
 #include <deque>
+#include <memory>
+#include <utility>
 #include <vector>
 
 namespace ROOT {
@@ -36,12 +40,16 @@ class R__CLING_PTRCHECK(off) RDefinePerSample final : public RDefineBase {
 
    F fExpression;
    ValuesPerSlot_t fLastResults;
+   /// Per-slot arrays of values handed out in bulk mode and their sizes.
+   std::vector<std::pair<std::unique_ptr<RetType_t[]>, std::size_t>> fBulkResults;
 
 public:
    RDefinePerSample(std::string_view name, std::string_view type, F expression, RLoopManager &lm)
       : RDefineBase(name, type, RDFInternal::RColumnRegister{nullptr}, lm, /*columnNames*/ {}),
-        fExpression(std::move(expression)), fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<RetType_t>())
+        fExpression(std::move(expression)), fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<RetType_t>()),
+        fBulkResults(lm.GetNSlots())
    {
+      fExpressionStr = typeid(F).name();
       fLoopManager->Register(this);
       auto callUpdate = [this](unsigned int slot, const ROOT::RDF::RSampleInfo &id) { this->Update(slot, id); };
       fLoopManager->AddSampleCallback(this, std::move(callUpdate));
@@ -69,6 +77,19 @@ public:
       fLastResults[slot * RDFInternal::CacheLineStep<RetType_t>()] = fExpression(slot, id);
    }
 
+   /// Bulks never straddle samples: all entries of the range get the value of the current sample.
+   void *UpdateBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &, std::size_t bulkSize) final
+   {
+      auto &bulk = fBulkResults[slot];
+      if (bulk.second < bulkSize) {
+         bulk.first.reset(new RetType_t[bulkSize]);
+         bulk.second = bulkSize;
+      }
+      std::fill(bulk.first.get(), bulk.first.get() + bulkSize,
+                fLastResults[slot * RDFInternal::CacheLineStep<RetType_t>()]);
+      return bulk.first.get();
+   }
+
    const std::type_info &GetTypeId() const final { return typeid(RetType_t); }
 
    void InitSlot(TTreeReader *, unsigned int) final {}
@@ -41,6 +41,11 @@ class R__CLING_PTRCHECK(off) RDefineReader final : public ROOT::Detail::RDF::RCo
       return fValuePtr;
    }
 
+   void *GetBulkImpl(const RMaskedEntryRange &mask, std::size_t bulkSize) final
+   {
+      return fDefine.UpdateBulk(fSlot, mask, bulkSize);
+   }
+
 public:
    RDefineReader(unsigned int slot, RDFDetail::RDefineBase &define)
       : fDefine(define), fValuePtr(define.GetValuePtr(slot)), fSlot(slot)
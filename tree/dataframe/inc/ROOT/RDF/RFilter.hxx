@@ -24,6 +24,7 @@
 #include <cassert>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility> // std::index_sequence
 #include <vector>
@@ -78,6 +79,7 @@ public:
         fFilter(std::move(f)), fValues(pd->GetLoopManagerUnchecked()->GetNSlots()), fPrevNodePtr(std::move(pd)),
         fPrevNode(*fPrevNodePtr)
    {
+      fExpressionStr = typeid(FilterF).name();
       fLoopManager->Register(this);
    }
 
@@ -116,11 +118,43 @@ public:
       (void)entry;
    }
 
+   const RDFInternal::RMaskedEntryRange &CheckFiltersBulk(unsigned int slot, std::size_t bulkSize) final
+   {
+      auto &mask = fBulkMasks[slot];
+      const auto &prevMask = fPrevNode.CheckFiltersBulk(slot, bulkSize);
+      if (mask.FirstEntry() != prevMask.FirstEntry()) {
+         // evaluate this filter on the entries that passed the upstream filters, cache the result
+         mask = prevMask;
+         CheckFilterBulkHelper(slot, mask, bulkSize, ColumnTypes_t{}, TypeInd_t{});
+      }
+      return mask;
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void CheckFilterBulkHelper(unsigned int slot, RDFInternal::RMaskedEntryRange &mask, std::size_t bulkSize,
+                              TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      std::tuple<ColTypes *...> columns{fValues[slot][S]->template GetBulk<ColTypes>(mask, bulkSize)...};
+      ULong64_t accepted = 0ull;
+      ULong64_t rejected = 0ull;
+      for (std::size_t i = 0u; i < bulkSize; ++i) {
+         if (mask[i]) {
+            const bool passed = fFilter(std::get<S>(columns)[i]...);
+            passed ? ++accepted : ++rejected;
+            mask[i] = passed;
+         }
+      }
+      fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()] += accepted;
+      fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()] += rejected;
+      (void)columns; // avoid unused variable warnings when there are no input columns
+   }
+
    void InitSlot(TTreeReader *r, unsigned int slot) final
    {
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
       fValues[slot] = RDFInternal::GetColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fBulkMasks[slot].SetFirstEntry(-1);
    }
 
    // recursive chain of `Report`s
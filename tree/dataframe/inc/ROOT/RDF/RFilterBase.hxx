@@ -12,6 +12,7 @@
 #define ROOT_RFILTERBASE
 
 #include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "ROOT/RVec.hxx"
@@ -41,12 +42,15 @@ protected:
    std::vector<int> fLastResult = {true}; // std::vector<bool> cannot be used in a MT context safely
    std::vector<ULong64_t> fAccepted = {0};
    std::vector<ULong64_t> fRejected = {0};
+   std::vector<RDFInternal::RMaskedEntryRange> fBulkMasks; ///< Per-slot masks of the entries accepted in bulk mode
    const std::string fName;
    const ROOT::RDF::ColumnNames_t fColumnNames;
    RDFInternal::RColumnRegister fColRegister;
    /// The nth flag signals whether the nth input column is a custom column or not.
    ROOT::RVecB fIsDefine;
    std::string fVariation; ///< This indicates for what variation this filter evaluates values.
+   /// The expression of a jitted Filter, or the (mangled) type name of the callable of a compiled one.
+   std::string fExpressionStr;
    std::unordered_map<std::string, std::shared_ptr<RFilterBase>> fVariedFilters;
 
 public:
@@ -60,6 +64,12 @@ public:
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    bool HasName() const;
    std::string GetName() const;
+   const std::string &GetExpression() const { return fExpressionStr; }
+   const ColumnNames_t &GetColumnNames() const { return fColumnNames; }
+   const RDFInternal::RColumnRegister &GetColRegister() const { return fColRegister; }
+   /// Whether this filter is evaluated in the next event loop: named filters always are, the others only if an action
+   /// depends on them. Only meaningful after RLoopManager has evaluated the children counts.
+   bool IsActive() const { return fNChildren > 0 || HasName(); }
    virtual void FillReport(ROOT::RDF::RCutFlowReport &) const;
    virtual void TriggerChildrenCount() = 0;
    virtual void ResetReportCount()
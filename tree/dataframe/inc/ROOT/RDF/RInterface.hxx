@@ -87,6 +87,13 @@ class RInterface;
 
 using RNode = RInterface<::ROOT::Detail::RDF::RNodeBase, void>;
 
+namespace Experimental {
+// fwd decls for RInterface, see RDFHelpers.hxx for the documentation
+void SetBulkSize(RNode node, std::size_t bulkSize);
+RNode PersistentCache(RNode node, const std::vector<std::string> &columns, const std::string &cacheDir,
+                      const std::string &tag);
+} // namespace Experimental
+
 // clang-format off
 /**
  * \class ROOT::RDF::RInterface
@@ -112,6 +119,9 @@ class RInterface : public RInterfaceBase {
    friend class RInterface;
 
    friend void RDFInternal::TriggerRun(RNode &node);
+   friend void Experimental::SetBulkSize(RNode node, std::size_t bulkSize);
+   friend RNode Experimental::PersistentCache(RNode node, const std::vector<std::string> &columns,
+                                              const std::string &cacheDir, const std::string &tag);
 
    std::shared_ptr<Proxied> fProxiedPtr; ///< Smart pointer to the graph node encapsulated by this RInterface.
 
@@ -900,6 +910,15 @@ public:
    /// the TTree as part of the TTree name, e.g. `df.Snapshot("subdir/t", "f.root")` write TTree `t` in the
    /// sub-directory `subdir` of file `f.root` (creating file and sub-directory as needed).
    ///
+   /// ### Writing an RNTuple
+   ///
+   /// Setting `RSnapshotOptions::fOutputFormat` to `ESnapshotOutputFormat::kRNTuple` writes the columns as fields of
+   /// an RNTuple instead of branches of a TTree. In multi-thread runs, every processing slot compresses its own
+   /// clusters and appends them to the same RNTuple, so no intermediate merging step is needed. As for TTree output,
+   /// operations can be booked on the returned `RDataFrame` right away; the RNTuple is opened when its event loop
+   /// starts. The split level and auto-flush options do not apply to RNTuple output and writing to a sub-directory
+   /// is not supported.
+   ///
    /// \attention In multi-thread runs (i.e. when EnableImplicitMT() has been called) threads will loop over clusters of
    /// entries in an undefined order, so Snapshot will produce outputs in which (clusters of) entries will be shuffled with
    /// respect to the input TTree. Using such "shuffled" TTrees as friends of the original trees would result in wrong
@@ -979,7 +998,16 @@ public:
                                          colListWithAliasesAndSizeBranches, options});
 
       ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, colListNoAliasesWithSizeBranches);
+      std::shared_ptr<ROOT::RDataFrame> newRDF;
+      if (options.fOutputFormat == ESnapshotOutputFormat::kRNTuple) {
+         std::vector<std::string> colTypes;
+         for (const auto &col : colListNoAliasesWithSizeBranches)
+            colTypes.emplace_back(GetColumnType(col));
+         newRDF = RDFInternal::MakeSnapshotNTupleDataFrame(std::string(filename), std::string(treename),
+                                                           colListWithAliasesAndSizeBranches, colTypes);
+      } else {
+         newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, colListNoAliasesWithSizeBranches);
+      }
 
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, RDFDetail::RInferredType>(
          colListNoAliasesWithSizeBranches, newRDF, snapHelperArgs, fProxiedPtr,
@@ -2792,8 +2820,15 @@ private:
          std::string(filename), std::string(dirname), std::string(treename), columnListWithoutSizeColumns, options});
 
       ::TDirectory::TContext ctxt;
-      auto newRDF =
-         std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, /*defaultColumns=*/columnListWithoutSizeColumns);
+      std::shared_ptr<ROOT::RDataFrame> newRDF;
+      if (options.fOutputFormat == ESnapshotOutputFormat::kRNTuple) {
+         newRDF = RDFInternal::MakeSnapshotNTupleDataFrame(std::string(filename), std::string(treename),
+                                                           columnListWithoutSizeColumns,
+                                                           {RDFInternal::TypeID2TypeName(typeid(ColumnTypes))...});
+      } else {
+         newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename,
+                                                     /*defaultColumns=*/columnListWithoutSizeColumns);
+      }
 
       // The Snapshot helper will use validCols (with aliases resolved) as input columns, and
       // columnListWithoutSizeColumns (still with aliases in it, passed through snapHelperArgs) as output column names.
@@ -34,17 +34,22 @@ namespace RDF {
 /// that will be just-in-time compiled. Jitted code will assign the concrete RDefine to this RJittedDefine
 /// before the event-loop starts.
 class RJittedDefine : public RDefineBase {
-   std::unique_ptr<RDefineBase> fConcreteDefine = nullptr;
+   /// The concrete define created in jitted code, or another RJittedDefine with the same expression and inputs.
+   std::shared_ptr<RDefineBase> fConcreteDefine = nullptr;
    /// Type info obtained through TypeName2TypeID based on the column type name.
    /// The expectation is that this always compares equal to fConcreteDefine->GetTypeId() (which however is only
    /// available after jitting). It can be null if TypeName2TypeID failed to figure out this type.
    const std::type_info *fTypeId = nullptr;
+   /// Whether fConcreteDefine is another RJittedDefine, with the same expression and inputs, that this define shares.
+   bool fIsShared = false;
 
 public:
    RJittedDefine(std::string_view name, std::string_view type, RLoopManager &lm,
-                 const RDFInternal::RColumnRegister &colRegister, const ColumnNames_t &columns)
+                 const RDFInternal::RColumnRegister &colRegister, const ColumnNames_t &columns,
+                 std::string_view expression = "")
       : RDefineBase(name, type, colRegister, lm, columns)
    {
+      fExpressionStr = std::string(expression);
       // try recovering the type_info of this type, no problem if we fail (as long as no one calls GetTypeId)
       try {
          fTypeId = &RDFInternal::TypeName2TypeID(std::string(type));
@@ -54,15 +59,24 @@ public:
    ~RJittedDefine();
 
    void SetDefine(std::unique_ptr<RDefineBase> c) { fConcreteDefine = std::move(c); }
+   void SetSharedDefine(std::shared_ptr<RJittedDefine> d)
+   {
+      fConcreteDefine = std::move(d);
+      fIsShared = true;
+   }
+   /// Return the define that evaluates the expression: the define this one shares its values with, or this one.
+   const RDefineBase *GetEvaluatingDefine() const { return fIsShared ? fConcreteDefine.get() : this; }
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    void *GetValuePtr(unsigned int slot) final;
    const std::type_info &GetTypeId() const final;
    void Update(unsigned int slot, Long64_t entry) final;
    void Update(unsigned int slot, const ROOT::RDF::RSampleInfo &id) final;
+   void *UpdateBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask, std::size_t bulkSize) final;
    void FinalizeSlot(unsigned int slot) final;
    void MakeVariations(const std::vector<std::string> &variations) final;
    RDefineBase &GetVariedDefine(const std::string &variationName) final;
+   void SetUsed() final;
 };
 
 } // ns RDF
@@ -40,13 +40,15 @@ class RJittedFilter final : public RFilterBase {
    std::unique_ptr<RFilterBase> fConcreteFilter = nullptr;
 
 public:
-   RJittedFilter(RLoopManager *lm, std::string_view name, const std::vector<std::string> &variations);
+   RJittedFilter(RLoopManager *lm, std::string_view name, const std::vector<std::string> &variations,
+                 std::string_view expression = "");
    ~RJittedFilter();
 
    void SetFilter(std::unique_ptr<RFilterBase> f);
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    bool CheckFilters(unsigned int slot, Long64_t entry) final;
+   const RDFInternal::RMaskedEntryRange &CheckFiltersBulk(unsigned int slot, std::size_t bulkSize) final;
    void Report(ROOT::RDF::RCutFlowReport &) const final;
    void PartialReport(ROOT::RDF::RCutFlowReport &) const final;
    void FillReport(ROOT::RDF::RCutFlowReport &) const final;
@@ -14,6 +14,7 @@
 #include "ROOT/InternalTreeUtils.hxx" // RNoCleanupNotifier
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RDatasetSpec.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "ROOT/RDF/RNewSampleNotifier.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
@@ -43,6 +44,7 @@ std::vector<std::string> GetBranchNames(TTree &t, bool allowDuplicates = true);
 
 class GraphNode;
 class RActionBase;
+class RBulkColumnReaderBase;
 class RVariationBase;
 
 namespace GraphDrawing {
@@ -101,6 +103,8 @@ namespace RDFInternal = ROOT::Internal::RDF;
 class RFilterBase;
 class RRangeBase;
 class RDefineBase;
+class RJittedDefine;
+class RJittedFilter;
 using ROOT::RDF::RDataSource;
 
 /// The head node of a RDF computation graph.
@@ -147,6 +151,22 @@ class RLoopManager : public RNodeBase {
    /// Cache of the tree/chain branch names. Never access directy, always use GetBranchNames().
    ColumnNames_t fValidBranchNames;
 
+   /// Entries staged for processing in bulk mode.
+   struct RBulk {
+      RDFInternal::RMaskedEntryRange fMask; ///< The range of staged entries. Entries past fNEntries are masked out.
+      std::size_t fNEntries = 0;            ///< Number of entries staged so far
+      /// Readers of dataset columns that copy the values of the staged entries. Owned by fDatasetColumnReaders.
+      std::vector<RDFInternal::RBulkColumnReaderBase *> fReaders;
+   };
+   std::size_t fBulkSize{1};     ///< Number of entries processed together, as requested by the user
+   std::size_t fLoopBulkSize{1}; ///< Number of entries processed together in the current event loop
+   std::vector<RBulk> fBulks;    ///< Per-slot staged entries
+
+   /// Jitted Defines and unnamed Filters booked so far, by a key that identifies their expression and their inputs.
+   /// Identical jitted Defines and Filters share the same node, so that their expression is evaluated only once.
+   std::unordered_map<std::string, std::weak_ptr<RJittedDefine>> fJittedDefines;
+   std::unordered_map<std::string, std::weak_ptr<RJittedFilter>> fJittedFilters;
+
    ROOT::Internal::TreeUtils::RNoCleanupNotifier fNoCleanupNotifier;
 
    void RunEmptySourceMT();
@@ -156,11 +176,15 @@ class RLoopManager : public RNodeBase {
    void RunDataSourceMT();
    void RunDataSource();
    void RunAndCheckFilters(unsigned int slot, Long64_t entry);
+   void StageBulkEntry(unsigned int slot, Long64_t entry);
+   void RunBulk(unsigned int slot);
+   void SetupBulk();
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
    void InitNodes();
    void CleanUpNodes();
    void CleanUpTask(TTreeReader *r, unsigned int slot);
    void EvalChildrenCounts();
+   void SetUsedDefines();
    void SetupSampleCallbacks(TTreeReader *r, unsigned int slot);
    void UpdateSampleInfo(unsigned int slot, const std::pair<ULong64_t, ULong64_t> &range);
    void UpdateSampleInfo(unsigned int slot, TTreeReader &r);
@@ -181,6 +205,8 @@ public:
    TTree *GetTree() const;
    ::TDirectory *GetDirectory() const;
    ULong64_t GetNEmptyEntries() const { return fNEmptyEntries; }
+   /// Return the range of entries of the TTree that the event loop processes, as [begin, end).
+   std::pair<Long64_t, Long64_t> GetEntryRange() const { return {fBeginEntry, fEndEntry}; }
    RDataSource *GetDataSource() const { return fDataSource.get(); }
    void Register(RDFInternal::RActionBase *actionPtr);
    void Deregister(RDFInternal::RActionBase *actionPtr);
@@ -193,6 +219,10 @@ public:
    void Register(RDFInternal::RVariationBase *varPtr);
    void Deregister(RDFInternal::RVariationBase *varPtr);
    bool CheckFilters(unsigned int, Long64_t) final;
+   const RDFInternal::RMaskedEntryRange &CheckFiltersBulk(unsigned int slot, std::size_t) final
+   {
+      return fBulks[slot].fMask;
+   }
    unsigned int GetNSlots() const { return fNSlots; }
    void Report(ROOT::RDF::RCutFlowReport &rep) const final;
    /// End of recursive chain of calls, does nothing
@@ -208,6 +238,9 @@ public:
                                    const std::type_info &ti);
    RColumnReaderBase *AddTreeColumnReader(unsigned int slot, const std::string &col,
                                           std::unique_ptr<RColumnReaderBase> &&reader, const std::type_info &ti);
+   RColumnReaderBase *AddTreeColumnReader(unsigned int slot, const std::string &col,
+                                          std::unique_ptr<RDFInternal::RBulkColumnReaderBase> &&reader,
+                                          const std::type_info &ti);
    RColumnReaderBase *GetDatasetColumnReader(unsigned int slot, const std::string &col, const std::type_info &ti) const;
 
    /// End of recursive chain of calls, does nothing
@@ -228,6 +261,15 @@ public:
    const ColumnNames_t &GetBranchNames();
 
    void AddSampleCallback(void *nodePtr, ROOT::RDF::SampleCallback_t &&callback);
+
+   std::shared_ptr<RJittedDefine> GetJittedDefine(const std::string &key) const;
+   void AddJittedDefine(const std::string &key, const std::shared_ptr<RJittedDefine> &define);
+   std::shared_ptr<RJittedFilter> GetJittedFilter(const std::string &key) const;
+   void AddJittedFilter(const std::string &key, const std::shared_ptr<RJittedFilter> &filter);
+
+   void SetBulkSize(std::size_t bulkSize);
+   /// Return the number of entries processed together in the current event loop (1 if bulk mode is off).
+   std::size_t GetLoopBulkSize() const { return fLoopBulkSize; }
 };
 
 } // ns RDF
@@ -0,0 +1,48 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_INTERNAL_RDF_RMASKEDENTRYRANGE
+#define ROOT_INTERNAL_RDF_RMASKEDENTRYRANGE
+
+#include <ROOT/RVec.hxx>
+#include <Rtypes.h>
+
+#include <algorithm>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/**
+\class ROOT::Internal::RDF::RMaskedEntryRange
+\ingroup dataframe
+\brief A range of consecutive entries processed together in bulk mode, with a mask that flags the selected ones.
+
+The i-th element of the mask refers to entry FirstEntry() + i. Nodes of the computation graph must not evaluate
+anything for entries whose mask element is false.
+**/
+class RMaskedEntryRange {
+   ROOT::RVec<bool> fMask; ///< Boolean mask. Its size is the maximum number of entries in the range.
+   Long64_t fBegin{-1};    ///< Entry number of the first entry in the range, -1 if the range is not set yet.
+
+public:
+   explicit RMaskedEntryRange(std::size_t size = 0) : fMask(size, true) {}
+
+   Long64_t FirstEntry() const { return fBegin; }
+   void SetFirstEntry(Long64_t e) { fBegin = e; }
+   std::size_t Size() const { return fMask.size(); }
+   bool &operator[](std::size_t idx) { return fMask[idx]; }
+   bool operator[](std::size_t idx) const { return fMask[idx]; }
+   void SetAll(bool to) { std::fill(fMask.begin(), fMask.end(), to); }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -29,6 +29,7 @@ namespace RDF {
 namespace GraphDrawing {
 class GraphNode;
 }
+class RMaskedEntryRange;
 }
 }
 
@@ -54,6 +55,8 @@ public:
    }
    virtual ~RNodeBase() {}
    virtual bool CheckFilters(unsigned int, Long64_t) = 0;
+   /// Return the mask of the entries of the current bulk that pass all filters up to this node (bulk mode).
+   virtual const ROOT::Internal::RDF::RMaskedEntryRange &CheckFiltersBulk(unsigned int slot, std::size_t bulkSize) = 0;
    virtual void Report(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void PartialReport(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void IncrChildrenCount() = 0;
@@ -87,6 +87,32 @@ public:
       return fLastResult;
    }
 
+   const ROOT::Internal::RDF::RMaskedEntryRange &CheckFiltersBulk(unsigned int slot, std::size_t bulkSize) final
+   {
+      const auto &prevMask = fPrevNode.CheckFiltersBulk(slot, bulkSize);
+      if (prevMask.FirstEntry() != fBulkMask.FirstEntry()) {
+         fBulkMask = prevMask;
+         // same logic as CheckFilters, applied in order to the entries that passed the upstream filters
+         for (std::size_t i = 0u; i < bulkSize; ++i) {
+            if (!fBulkMask[i])
+               continue;
+            if (fHasStopped) {
+               fBulkMask[i] = false;
+               continue;
+            }
+            if (fNProcessedEntries < fStart || (fStop > 0 && fNProcessedEntries >= fStop) ||
+                (fStride != 1 && (fNProcessedEntries - fStart) % fStride != 0))
+               fBulkMask[i] = false;
+            ++fNProcessedEntries;
+            if (fNProcessedEntries == fStop) {
+               fHasStopped = true;
+               fPrevNode.StopProcessing();
+            }
+         }
+      }
+      return fBulkMask;
+   }
+
    // recursive chain of `Report`s
    // RRange simply forwards these calls to the previous node
    void Report(ROOT::RDF::RCutFlowReport &rep) const final { fPrevNode.PartialReport(rep); }
@@ -127,6 +153,7 @@ public:
          return thisNode;
       }
       thisNode->SetPrevNode(prevNode);
+      thisNode->SetExpression(std::to_string(fStart) + ":" + std::to_string(fStop) + ":" + std::to_string(fStride));
 
       // If there have been some defines between the last Filter and this Range node we won't detect them:
       // Ranges don't keep track of Defines (they have no RColumnRegister data member).
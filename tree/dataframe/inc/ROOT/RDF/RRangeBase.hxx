@@ -11,6 +11,7 @@
 #ifndef ROOT_RRANGEBASE
 #define ROOT_RRANGEBASE
 
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "RtypesCore.h"
 
@@ -38,6 +39,7 @@ protected:
    unsigned int fStride;
    Long64_t fLastCheckedEntry{-1};
    bool fLastResult{true};
+   ROOT::Internal::RDF::RMaskedEntryRange fBulkMask; ///< Mask of the entries accepted in bulk mode
    ULong64_t fNProcessedEntries{0};
    bool fHasStopped{false};    ///< True if the end of the range has been reached
    const unsigned int fNSlots; ///< Number of thread slots used by this node, inherited from parent node.
@@ -0,0 +1,102 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RSTEALABLERANGES
+#define ROOT_RDF_RSTEALABLERANGES
+
+#include <ROOT/TSpinMutex.hxx>
+#include <Rtypes.h>
+
+#include <list>
+#include <mutex>
+#include <string>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/**
+\class ROOT::Internal::RDF::RStealableRanges
+\ingroup dataframe
+\brief The entry ranges processed by the tasks of a multi-thread event loop, whose unprocessed tails can be stolen.
+
+Each task registers the range of entries it processes and claims its entries a few at a time while it goes through
+them. When a task is done with its range and the event loop is in its tail, i.e. all entries have been handed out to
+tasks, the task can steal the second half of the unclaimed entries of the range with the most unclaimed entries,
+instead of leaving its worker idle while other tasks are still running.
+**/
+class RStealableRanges {
+public:
+   /// The range of entries processed by one task.
+   class RRange {
+      friend class RStealableRanges;
+
+      ROOT::TSpinMutex fMutex; ///< Synchronizes the claims of the owner with the steals of other tasks
+      Long64_t fBegin;         ///< First entry of the range. Only changed when the owner steals a new range.
+      Long64_t fEnd;           ///< End of the range (excluded). Reduced when other tasks steal the tail of the range.
+      Long64_t fClaimedEnd;    ///< The owner processes the entries before this one. Protected by fMutex.
+      Long64_t fOwnerClaimedEnd; ///< Copy of fClaimedEnd that only the owner accesses, without locking.
+      ULong64_t fFirstCount;     ///< Value of the entry counter for the first entry of the range
+      std::string fDomain;       ///< Only ranges with the same domain use the same entry numbers
+
+      bool ClaimSlow(Long64_t entry);
+
+   public:
+      RRange(Long64_t begin, Long64_t end, ULong64_t firstCount, const std::string &domain)
+         : fBegin(begin), fEnd(end), fClaimedEnd(begin), fOwnerClaimedEnd(begin), fFirstCount(firstCount),
+           fDomain(domain)
+      {
+      }
+
+      /// Return true if the owner can process the given entry, false if it is beyond the end of the range.
+      /// Entries must be claimed in increasing order.
+      bool Claim(Long64_t entry) { return entry < fOwnerClaimedEnd || ClaimSlow(entry); }
+
+      Long64_t GetBegin() const { return fBegin; }
+      Long64_t GetEnd();
+      ULong64_t GetFirstCount() const { return fFirstCount; }
+   };
+
+private:
+   std::mutex fMutex;                ///< Protects the list of ranges and serializes the steals
+   std::list<RRange> fRanges;        ///< The ranges currently being processed
+   const unsigned int fNSlots;       ///< Number of processing slots of the event loop
+   const ULong64_t fNEntries;        ///< Total number of entries of the event loop, 0 if unknown
+   ULong64_t fNStartedEntries = 0ull; ///< Number of entries in the ranges registered so far
+   const Long64_t fMinStealEntries;  ///< A range is only split if the stolen part has at least this many entries
+
+   bool IsInTail() const;
+
+public:
+   RStealableRanges(unsigned int nSlots, ULong64_t nEntries, Long64_t minStealEntries);
+   RStealableRanges(const RStealableRanges &) = delete;
+   RStealableRanges &operator=(const RStealableRanges &) = delete;
+
+   RRange &Add(Long64_t begin, Long64_t end, ULong64_t firstCount, const std::string &domain = "");
+   void Remove(RRange &range);
+   bool Steal(RRange &thief);
+};
+
+/// A RAII object that registers a range in a RStealableRanges object for the lifetime of a task.
+/// After construction the range is available as the data member fRange.
+struct RStealableRangeRAII {
+   RStealableRanges &fRanges;
+   RStealableRanges::RRange &fRange;
+   RStealableRangeRAII(RStealableRanges &ranges, Long64_t begin, Long64_t end, ULong64_t firstCount,
+                       const std::string &domain = "")
+      : fRanges(ranges), fRange(ranges.Add(begin, end, firstCount, domain))
+   {
+   }
+   ~RStealableRangeRAII() { fRanges.Remove(fRange); }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -17,9 +17,14 @@
 #include <TTreeReader.h>
 #include <TTreeReaderValue.h>
 #include <TTreeReaderArray.h>
+#include <TBufferFile.h>
+#include <TDataType.h> // EDataType
 
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
 
 namespace ROOT {
 namespace Internal {
@@ -81,7 +86,10 @@ class R__CLING_PTRCHECK(off) RTreeColumnReader<RVec<T>> final : public ROOT::Det
       // Currently we need the first entry to have been loaded to perform the check
       // TODO Move check to constructor once ROOT-10823 is fixed and TTreeReaderArray itself exposes this information
       const auto readerArraySize = readerArray.GetSize();
-      if (EStorageType::kUnknown == fStorageType && readerArraySize > 1) {
+      // Arrays that are read basket-wise through the bulk I/O interface are known to be contiguous. This can change
+      // if the array reader falls back to entry-wise reading, so we don't remember it in fStorageType.
+      const bool isContiguous = readerArray.IsContiguous();
+      if (!isContiguous && EStorageType::kUnknown == fStorageType && readerArraySize > 1) {
          // We can decide since the array is long enough
          fStorageType = EStorageType::kContiguous;
          for (auto i = 0u; i < readerArraySize - 1; ++i) {
@@ -92,7 +100,7 @@ class R__CLING_PTRCHECK(off) RTreeColumnReader<RVec<T>> final : public ROOT::Det
          }
       }
 
-      if (EStorageType::kContiguous == fStorageType ||
+      if (isContiguous || EStorageType::kContiguous == fStorageType ||
           (EStorageType::kUnknown == fStorageType && readerArray.GetSize() < 2)) {
          if (readerArraySize > 0) {
             // trigger loading of the contents of the TTreeReaderArray
@@ -181,6 +189,159 @@ public:
    ~RTreeColumnReader() override { fTreeArray.reset(); }
 };
 
+/// Decodes whole baskets of a branch holding a single leaf of fundamental type (or a fixed-size array thereof) through
+/// TBranch's bulk I/O interface, so that the values of an entry can be served directly from the decoded basket.
+///
+/// The branch is looked up again whenever the TTreeReader switches tree. If the branch cannot be read in bulk (it is
+/// not a plain leaf of the requested type, it belongs to a friend tree, a basket cannot be decoded...) the reader
+/// permanently switches to the fallback, entry-wise reader.
+class RTreeBulkBasketReader {
+   TTreeReader *fTreeReader;
+   std::string fBranchName;
+   EDataType fType;
+   Int_t fElementSize;
+   /// Whether the column is an RVec, i.e. the branch is expected to hold a fixed-size array
+   bool fIsArray;
+   bool fUseFallback = false;
+
+   /// The tree and the branch of the currently decoded basket
+   TTree *fTree = nullptr;
+   Int_t fTreeNumber = -1;
+   TBranch *fBranch = nullptr;
+   /// Number of values per entry
+   Int_t fLen = 1;
+   /// The decoded basket: the values of entries [fFirstEntry, fFirstEntry + fNEntries)
+   TBufferFile fBuffer{TBuffer::kRead, 10000};
+   /// The values of the decoded basket: they point into fBuffer, or into fAlignedValues if the values in fBuffer are
+   /// not suitably aligned for their type (the position of the data in the basket buffer is arbitrary)
+   char *fValues = nullptr;
+   std::vector<Long64_t> fAlignedValues;
+   Long64_t fFirstEntry = -1;
+   Long64_t fNEntries = 0;
+
+   bool SetTree(TTree *tree, Int_t treeNumber);
+   bool LoadBasket(Long64_t entry);
+
+public:
+   RTreeBulkBasketReader(TTreeReader &r, const std::string &branchName, const std::type_info &type, bool isArray);
+
+   /// Return the address of the first value of the entry currently loaded by the TTreeReader and set `len` to the
+   /// number of values per entry. Return nullptr if the fallback reader has to be used.
+   void *LoadEntry(Int_t &len)
+   {
+      if (fUseFallback)
+         return nullptr;
+      TTree *tree = fTreeReader->GetTree()->GetTree();
+      const auto treeNumber = fTreeReader->GetTree()->GetTreeNumber();
+      if ((tree != fTree || treeNumber != fTreeNumber) && !SetTree(tree, treeNumber))
+         return nullptr;
+      const auto entry = tree->GetReadEntry();
+      if ((entry < fFirstEntry || entry >= fFirstEntry + fNEntries) && !LoadBasket(entry))
+         return nullptr;
+      len = fLen;
+      return fValues + (entry - fFirstEntry) * fLen * fElementSize;
+   }
+
+   /// Return the address of the first value of the entry currently loaded by the TTreeReader if it is part of the
+   /// basket that is already decoded, nullptr otherwise. Never decodes a basket.
+   void *GetDecodedEntry() const
+   {
+      if (fUseFallback || fTree == nullptr)
+         return nullptr;
+      TTree *tree = fTreeReader->GetTree()->GetTree();
+      if (tree != fTree || fTreeReader->GetTree()->GetTreeNumber() != fTreeNumber)
+         return nullptr;
+      const auto entry = tree->GetReadEntry();
+      if (entry < fFirstEntry || entry >= fFirstEntry + fNEntries)
+         return nullptr;
+      return fValues + (entry - fFirstEntry) * fLen * fElementSize;
+   }
+};
+
+/// Column reader for TTree values of fundamental type that are read basket-wise via RTreeBulkBasketReader, without
+/// going through a TTreeReaderValue for every entry. Falls back to a regular RTreeColumnReader if needed.
+template <typename T>
+class R__CLING_PTRCHECK(off) RTreeBulkColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
+   RTreeBulkBasketReader fBulkReader;
+   std::unique_ptr<RTreeColumnReader<T>> fFallback;
+
+   void *GetImpl(Long64_t entry) final
+   {
+      Int_t len = 0;
+      if (auto values = fBulkReader.LoadEntry(len))
+         return values;
+      return &fFallback->template Get<T>(entry);
+   }
+
+   /// The values of the entries of a basket are adjacent in the decoded basket
+   void *TryGetContiguousImpl(Long64_t) final { return fBulkReader.GetDecodedEntry(); }
+
+public:
+   RTreeBulkColumnReader(TTreeReader &r, const std::string &colName)
+      : fBulkReader(r, colName, typeid(T), false), fFallback(std::make_unique<RTreeColumnReader<T>>(r, colName))
+   {
+   }
+
+   /// See RTreeColumnReader for an explanation.
+   ~RTreeBulkColumnReader() override { fFallback.reset(); }
+};
+
+/// RTreeBulkColumnReader specialization for fixed-size arrays of fundamental type: the RVec is a view on the values
+/// of the entry in the decoded basket.
+template <typename T>
+class R__CLING_PTRCHECK(off) RTreeBulkColumnReader<RVec<T>> final : public ROOT::Detail::RDF::RColumnReaderBase {
+   RTreeBulkBasketReader fBulkReader;
+   std::unique_ptr<RTreeColumnReader<RVec<T>>> fFallback;
+
+   /// We return a reference to this RVec to clients, to guarantee a stable address.
+   RVec<T> fRVec;
+
+   void *GetImpl(Long64_t entry) final
+   {
+      Int_t len = 0;
+      auto values = static_cast<T *>(fBulkReader.LoadEntry(len));
+      if (!values)
+         return &fFallback->template Get<RVec<T>>(entry);
+      if (values != fRVec.data() || static_cast<std::size_t>(len) != fRVec.size()) {
+         RVec<T> rvec(values, len);
+         swap(fRVec, rvec);
+      }
+      return &fRVec;
+   }
+
+public:
+   RTreeBulkColumnReader(TTreeReader &r, const std::string &colName)
+      : fBulkReader(r, colName, typeid(T), true), fFallback(std::make_unique<RTreeColumnReader<RVec<T>>>(r, colName))
+   {
+   }
+
+   /// See RTreeColumnReader for an explanation.
+   ~RTreeBulkColumnReader() override { fFallback.reset(); }
+};
+
+/// Whether columns of type T can be read with an RTreeBulkColumnReader
+template <typename T>
+struct IsTreeBulkReadable : std::is_arithmetic<T> {
+};
+
+template <typename T>
+struct IsTreeBulkReadable<RVec<T>> : std::integral_constant<bool, std::is_arithmetic<T>::value> {
+};
+
+/// RVec<bool> is always copied, see RTreeColumnReader<RVec<bool>>
+template <>
+struct IsTreeBulkReadable<RVec<bool>> : std::false_type {
+};
+
+/// Create the reader for a column of a TTree: fundamental types and fixed-size arrays thereof are read basket-wise,
+/// everything else through TTreeReaderValues and TTreeReaderArrays.
+template <typename T>
+std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> MakeTreeColumnReader(TTreeReader &r, const std::string &colName)
+{
+   using Reader_t = std::conditional_t<IsTreeBulkReadable<T>::value, RTreeBulkColumnReader<T>, RTreeColumnReader<T>>;
+   return std::make_unique<Reader_t>(r, colName);
+}
+
 } // namespace RDF
 } // namespace Internal
 } // namespace ROOT
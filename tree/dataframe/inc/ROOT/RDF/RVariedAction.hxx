@@ -128,6 +128,14 @@ public:
       }
    }
 
+   void RunBulk(unsigned int, std::size_t) final
+   {
+      R__ASSERT(false && "RunBulk was called on a RVariedAction. This should never happen.");
+   }
+
+   // event loops with systematic variations are never executed in bulk mode
+   bool SupportsBulk() const final { return false; }
+
    void TriggerChildrenCount() final
    {
       std::for_each(fPrevNodes.begin(), fPrevNodes.end(), [](auto &f) { f->IncrChildrenCount(); });
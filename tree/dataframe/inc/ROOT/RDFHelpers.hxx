@@ -248,6 +248,87 @@ RResultMap<T> VariationsFor(RResultPtr<T> resPtr)
                                         *resPtr.fLoopManager, std::move(nominalAction), std::move(variedAction));
 }
 
+/// \brief Process the entries of the event loops of the computation graph in bulks of the given size.
+/// \param[in] node Any node of the computation graph.
+/// \param[in] bulkSize The number of entries processed together. A value of 1 (the default) disables bulk mode.
+///
+/// In bulk mode the event loop collects the values of the dataset columns for bulkSize consecutive entries, then
+/// Filters compute a mask of the selected entries for the whole bulk, Defines are evaluated only for the selected
+/// entries and actions receive the values of the bulk at once. This reduces the number of virtual calls per entry
+/// and lets action helpers that implement an `ExecBulk(slot, mask, bulkSize, values...)` method process the whole
+/// bulk in a tight loop. Helpers that only implement `Exec` are called once per selected entry as usual.
+///
+/// The results are identical to the ones of the entry-by-entry event loop. Event loops over a RDataSource, with
+/// systematic variations or with Snapshots to TTrees are executed entry by entry regardless of this setting.
+/// Columns read from a TTree must be default-constructible and copy-assignable to be used in bulk mode.
+///
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("tree", "file.root");
+/// ROOT::RDF::Experimental::SetBulkSize(df, 256);
+/// auto h = df.Filter("x > 0").Define("y", "x * x").Histo1D("y");
+/// ~~~
+void SetBulkSize(RNode node, std::size_t bulkSize);
+
+/// \brief Cache the given columns of the entries selected by the node in a file, and reuse them in later processes.
+/// \param[in] node Any node of the computation graph.
+/// \param[in] columns The columns to cache, e.g. the results of expensive Defines.
+/// \param[in] cacheDir The directory where the cache files are written.
+/// \param[in] tag An arbitrary string that is part of the cache key, see below.
+/// \return A RDataFrame that reads the cached columns.
+///
+/// The cache key is a hash of the identity of the dataset (tree names, file names, sizes and modification times, entry
+/// range, or the number of entries of an empty source), of the Defines, Filters and Ranges upstream of the node
+/// (including their input columns and the expressions of jitted Defines and Filters), of the names and types of the
+/// cached columns, of the ROOT version and of the tag. If a file for that key exists in cacheDir, the returned
+/// RDataFrame reads from it without running the upstream computation graph. Otherwise the columns are written with
+/// Snapshot to a new file, which triggers the event loop, and the returned RDataFrame reads from the new file.
+///
+/// Like Cache(), the returned RDataFrame only provides the cached columns, and only for the entries that pass the
+/// upstream Filters. Compiled callables (e.g. lambdas) passed to Define and Filter are identified by their type
+/// name only: neither changes to their implementation nor different captured values are detected. Therefore a
+/// non-empty tag that identifies the computation is required if the graph contains compiled callables, otherwise
+/// an exception is thrown. RDataSources, in-memory TTrees and files that are not local are not supported.
+///
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("Events", "data.root");
+/// auto reco = df.Filter("nMuon >= 2").Define("mass", "ExpensiveReconstruction(Muon_pt, Muon_eta)");
+/// auto cached = ROOT::RDF::Experimental::PersistentCache(reco, {"mass"}, "/tmp/rdfcache");
+/// auto h = cached.Histo1D("mass");
+/// ~~~
+RNode PersistentCache(RNode node, const std::vector<std::string> &columns, const std::string &cacheDir = ".",
+                      const std::string &tag = "");
+
+/// \brief Keep the functions compiled for the jitted expressions of Define and Filter in a persistent cache.
+/// \param[in] cacheDir The directory where the compiled functions are stored. An empty string disables the cache.
+///
+/// Every string expression passed to Define, Filter, Redefine or DefinePerSample is wrapped in a function that is
+/// compiled by the interpreter in each process. With the cache enabled, the first process that jits an expression
+/// also compiles the function with ACLiC into a shared library in cacheDir. Later processes that jit the same
+/// expression with the same column types and the same ROOT version load the library and only declare the prototype
+/// of the function to the interpreter, instead of compiling the function again.
+///
+/// Populating the cache is slower than plain just-in-time compilation, so the cache pays off for jobs that run
+/// repeatedly over the same analysis code. Only the functions for the expressions are cached: the code
+/// that books the corresponding nodes is still jitted. Expressions that cannot be compiled in isolation, e.g. because
+/// they use column types or functions that are only known to the interpreter, are transparently jitted as usual.
+///
+/// ~~~{.cpp}
+/// ROOT::RDF::Experimental::SetJitCacheDir("/tmp/rdfjitcache");
+/// ROOT::RDataFrame df("Events", "data.root");
+/// auto h = df.Filter("nMuon >= 2").Define("pt0", "Muon_pt[0]").Histo1D("pt0");
+/// ~~~
+void SetJitCacheDir(const std::string &cacheDir);
+
+/// \brief Enable or disable the sharing of identical jitted Defines and Filters.
+/// \param[in] enable Whether the computation graphs booked from now on share identical jitted nodes.
+///
+/// Unnamed Filters and Defines with the same string expression and the same input columns (and, for Filters, the
+/// same previous node) are evaluated once per entry, also if they are booked on different branches of the
+/// computation graph. This assumes that expressions are pure functions of their inputs. Expressions that read no
+/// column or that draw random numbers, e.g. `x + gRandom->Gaus()`, are never shared. Disable the sharing for
+/// expressions with other side effects, e.g. calls to a function that counts its invocations.
+void SetJittedNodeSharing(bool enable);
+
 } // namespace Experimental
 } // namespace RDF
 } // namespace ROOT
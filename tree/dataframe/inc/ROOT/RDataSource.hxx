@@ -239,6 +239,14 @@ public:
    // clang-format on
    virtual void InitSlot(unsigned int /*slot*/, ULong64_t /*firstEntry*/) {}
 
+   // clang-format off
+   /// \brief Whether the entry ranges returned by GetEntryRanges can be split during the event loop.
+   /// If true, in the tail of the processing of a set of ranges, tasks that are done take over the last part of
+   /// the range of a task that is still running. Both tasks then call InitSlot, SetEntry and FinalizeSlot on their
+   /// own part of the range: SetEntry must accept any entry of a range in any slot, and InitSlot any first entry.
+   // clang-format on
+   virtual bool SupportsRangeSplitting() const { return false; }
+
    // clang-format off
    /// \brief Convenience method called at the end of the data processing associated to a slot.
    /// \param[in] slot The data processing slot wihch needs to be finalized
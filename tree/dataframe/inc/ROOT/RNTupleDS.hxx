@@ -55,9 +55,27 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    std::vector<std::string> fColumnTypes;
    std::vector<size_t> fActiveColumns;
 
+   /// Restricts the event loop to the clusters whose value statistics of the field allow for values in [fMin, fMax]
+   struct RValueRangeFilter {
+      DescriptorId_t fFieldId;
+      double fMin;
+      double fMax;
+   };
+   std::vector<RValueRangeFilter> fValueRangeFilters;
+
    unsigned fNSlots = 0;
    bool fHasSeenAllRanges = false;
 
+   /// Set for a data source whose RNTuple is only written after the data source is created, see the constructor
+   bool fIsDeferred = false;
+   /// The column readers handed out by a deferred data source before the RNTuple is available
+   struct RDeferredReader {
+      unsigned int fSlot;
+      std::size_t fColumnIndex;
+      ROOT::Experimental::Internal::RNTupleColumnReader *fReader;
+   };
+   std::vector<RDeferredReader> fDeferredReaders;
+
    /// Provides the RDF column "colName" given the field identified by fieldID. For records and collections,
    /// AddField recurses into the sub fields. The skeinIDs is the list of field IDs of the outer collections
    /// of fieldId. For instance, if fieldId refers to an `std::vector<Jet>`, with
@@ -71,8 +89,15 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
                  DescriptorId_t fieldId,
                  std::vector<DescriptorId_t> skeinIDs);
 
+   /// Attaches the page sources of a deferred data source and connects the column readers handed out so far
+   void AttachDeferred();
+
 public:
    explicit RNTupleDS(std::unique_ptr<ROOT::Experimental::Detail::RPageSource> pageSource);
+   /// Creates a data source for an RNTuple that is not yet written, e.g. the output of a Snapshot.  The columns are
+   /// taken from the given schema; the page source is only attached in Initialize(), where the schema is checked
+   /// against the actual RNTuple.
+   RNTupleDS(std::unique_ptr<ROOT::Experimental::Detail::RPageSource> pageSource, const RNTupleDescriptor &schema);
    ~RNTupleDS();
    void SetNSlots(unsigned int nSlots) final;
    const std::vector<std::string> &GetColumnNames() const final { return fColumnNames; }
@@ -82,6 +107,13 @@ public:
    std::string GetLabel() final { return "RNTupleDS"; }
 
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
+   bool SupportsRangeSplitting() const final { return true; }
+
+   /// Skips the clusters that cannot contain entries with values of the given top-level field in [min, max], according
+   /// to the value statistics stored with the ntuple (see RNTupleWriteOptions::SetEnablePageStatistics()).
+   /// Multiple filters are combined with a logical AND.  Only entire clusters are skipped; the selection itself
+   /// still needs to be applied, e.g. with RDataFrame::Filter().  Needs to be called before the event loop starts.
+   void AddValueRangeFilter(std::string_view fieldName, double min, double max);
 
    void Initialize() final;
    void Finalize() final;
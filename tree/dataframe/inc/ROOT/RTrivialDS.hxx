@@ -47,6 +47,7 @@ public:
    std::string GetTypeName(std::string_view) const final;
    std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
+   bool SupportsRangeSplitting() const final { return true; }
    void SetNSlots(unsigned int nSlots) final;
    void Initialize() final;
    std::string GetLabel() final;
@@ -25,6 +25,14 @@ void CountHelper::Exec(unsigned int slot)
    fCounts[slot]++;
 }
 
+void CountHelper::ExecBulk(unsigned int slot, const RMaskedEntryRange &mask, std::size_t bulkSize)
+{
+   ULong64_t count = 0ull;
+   for (std::size_t i = 0u; i < bulkSize; ++i)
+      count += mask[i];
+   fCounts[slot] += count;
+}
+
 void CountHelper::Finalize()
 {
    *fResultCount = 0;
@@ -279,6 +287,22 @@ void ValidateSnapshotOutput(const RSnapshotOptions &opts, const std::string &tre
    }
 }
 
+#ifndef R__ENABLE_RNTUPLE_SNAPSHOT
+// Without root7, the RNTuple output format of Snapshot is not available (see RDFSnapshotRNTuple.cxx otherwise)
+std::unique_ptr<RSnapshotNTupleWriterBase>
+MakeSnapshotNTupleWriter(const std::string &, const std::string &, const std::string &, const ColumnNames_t &,
+                         const std::vector<std::string> &, const RSnapshotOptions &, unsigned int)
+{
+   throw std::runtime_error("Snapshot: RNTuple output requires ROOT to be built with root7=ON");
+}
+
+std::shared_ptr<ROOT::RDataFrame> MakeSnapshotNTupleDataFrame(const std::string &, const std::string &,
+                                                              const ColumnNames_t &, const std::vector<std::string> &)
+{
+   throw std::runtime_error("Snapshot: RNTuple output requires ROOT to be built with root7=ON");
+}
+#endif
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
@@ -124,6 +124,17 @@ RDFDetail::RDefineBase *RColumnRegister::GetDefine(const std::string &colName) c
    return it == fDefines->end() ? nullptr : &it->second->GetDefine();
 }
 
+////////////////////////////////////////////////////////////////////////////
+/// \brief Mark the defines that provide the given columns, if any, as read in the next event loop.
+/// Each define in turn marks the defines it reads, see RDefineBase::SetUsed.
+void RColumnRegister::SetDefinesUsed(const ColumnNames_t &columns) const
+{
+   for (const auto &col : columns) {
+      if (auto *define = GetDefine(ResolveAlias(col)))
+         define->SetUsed();
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////
 /// \brief Check if the provided name is tracked in the names list
 bool RColumnRegister::IsDefineOrAlias(std::string_view name) const
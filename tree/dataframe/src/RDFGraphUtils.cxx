@@ -10,6 +10,7 @@
 
 #include "ROOT/RDF/RColumnRegister.hxx"
 #include "ROOT/RDF/GraphUtils.hxx"
+#include "ROOT/RDF/RJittedDefine.hxx"
 
 #include <algorithm> // std::find
 
@@ -28,6 +29,9 @@ GraphDrawing::CreateDefineNode(const std::string &columnName, const ROOT::Detail
       return duplicateDefineIt->second;
 
    auto node = std::make_shared<GraphNode>("Define\\n" + columnName, visitedMap.size(), ENodeType::kDefine);
+   node->SetExpression(columnPtr->GetExpression());
+   node->SetInputColumns(columnPtr->GetColumnNames());
+   node->SetCompiled(dynamic_cast<const ROOT::Detail::RDF::RJittedDefine *>(columnPtr) == nullptr);
    visitedMap[(void *)columnPtr] = node;
    return node;
 }
@@ -45,6 +49,10 @@ GraphDrawing::CreateFilterNode(const ROOT::Detail::RDF::RFilterBase *filterPtr,
 
    auto node = std::make_shared<GraphNode>((filterPtr->HasName() ? filterPtr->GetName() : "Filter"), visitedMap.size(),
                                            ENodeType::kFilter);
+   node->SetExpression(filterPtr->GetExpression());
+   node->SetInputColumns(filterPtr->GetColumnNames());
+   // jitted filters replace the expression of their concrete filter, see RJittedFilter::GetGraph
+   node->SetCompiled(true);
    visitedMap[(void *)filterPtr] = node;
    return node;
 }
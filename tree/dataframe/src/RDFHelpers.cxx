@@ -11,9 +11,16 @@
 #include "ROOT/RDFHelpers.hxx"
 #include "TROOT.h"      // IsImplicitMTEnabled
 #include "TError.h"     // Warning
+#include "TEntryList.h"
+#include "TFile.h"
+#include "TMD5.h"
+#include "TNamed.h"
 #include "TStopwatch.h"
+#include "TSystem.h"
 #include "RConfigure.h" // R__USE_IMT
+#include "ROOT/InternalTreeUtils.hxx" // GetFileNamesFromTree, GetFriendInfo, GetTreeFullPaths
 #include "ROOT/RLogger.hxx"
+#include "ROOT/RDF/RJittedDefine.hxx"
 #include "ROOT/RDF/RLoopManager.hxx" // for RLoopManager
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RResultHandle.hxx"    // for RResultHandle, RunGraphs
@@ -23,6 +30,9 @@
 
 #include <algorithm>
 #include <set>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
 
 using ROOT::RDF::RResultHandle;
 
@@ -92,3 +102,157 @@ void ROOT::RDF::RunGraphs(std::vector<RResultHandle> handles)
       << "Finished RunGraphs run (" << uniqueLoops.size() << " unique computation graphs, " << sw.CpuTime() << "s CPU, "
       << sw.RealTime() << "s elapsed).";
 }
+
+void ROOT::RDF::Experimental::SetBulkSize(RNode node, std::size_t bulkSize)
+{
+   node.fLoopManager->SetBulkSize(bulkSize);
+}
+
+namespace {
+
+const char *const kPersistentCacheTreeName = "rdfcache";
+const char *const kPersistentCacheKeyName = "rdfcache_key";
+
+/// Describe the dataset the event loop processes, in a way that changes whenever the input data changes.
+std::string DescribeDatasetForCache(const ROOT::Detail::RDF::RLoopManager &lm)
+{
+   if (lm.GetDataSource() != nullptr)
+      throw std::runtime_error("PersistentCache: RDataSources are not supported.");
+
+   auto *tree = lm.GetTree();
+   if (tree == nullptr)
+      return "empty source with " + std::to_string(lm.GetNEmptyEntries()) + " entries\n";
+
+   std::string desc = "trees:";
+   for (const auto &path : ROOT::Internal::TreeUtils::GetTreeFullPaths(*tree))
+      desc += " " + path;
+   desc += "\n";
+
+   // without size and modification time, changes of the file would go unnoticed
+   auto describeFile = [&desc](const std::string &fileName) {
+      FileStat_t stat;
+      if (gSystem->GetPathInfo(fileName.c_str(), stat) != 0)
+         throw std::runtime_error("PersistentCache: cannot get the size and modification time of " + fileName +
+                                  ", only local files are supported.");
+      desc += "file: " + fileName + " size " + std::to_string(stat.fSize) + " mtime " + std::to_string(stat.fMtime) +
+              "\n";
+   };
+   // throws for in-memory trees, whose content we cannot identify
+   for (const auto &fileName : ROOT::Internal::TreeUtils::GetFileNamesFromTree(*tree))
+      describeFile(fileName);
+   const auto friendInfo = ROOT::Internal::TreeUtils::GetFriendInfo(*tree);
+   for (const auto &friendFileNames : friendInfo.fFriendFileNames)
+      for (const auto &fileName : friendFileNames)
+         describeFile(fileName);
+
+   const auto range = lm.GetEntryRange();
+   desc += "range: " + std::to_string(range.first) + " " + std::to_string(range.second) + "\n";
+   if (auto *entryList = tree->GetEntryList())
+      desc += "entry list: " + std::string(entryList->GetName()) + " " + std::to_string(entryList->GetN()) + "\n";
+   return desc;
+}
+
+std::string DescribeColumnsForCache(const std::vector<std::string> &columns)
+{
+   std::string desc;
+   for (const auto &col : columns)
+      desc += " " + col;
+   return desc;
+}
+
+/// Describe the branch of the computation graph that ends with the given graph node, from the node to the root.
+/// hasCompiled is set if one of the nodes is a compiled callable, which is only identified by its type name.
+std::string DescribeGraphForCache(const ROOT::Internal::RDF::GraphDrawing::GraphNode *node, bool &hasCompiled)
+{
+   std::string desc;
+   for (; node != nullptr; node = node->GetPrevNode()) {
+      desc += "node: " + node->GetName() + " [" + node->GetExpression() + "]" +
+              DescribeColumnsForCache(node->GetInputColumns()) + "\n";
+      hasCompiled |= node->IsCompiled();
+   }
+   return desc;
+}
+
+} // anonymous namespace
+
+ROOT::RDF::RNode ROOT::RDF::Experimental::PersistentCache(RNode node, const std::vector<std::string> &columns,
+                                                          const std::string &cacheDir, const std::string &tag)
+{
+   auto &lm = *node.fLoopManager;
+   // make sure all nodes are complete before describing them
+   lm.Jit();
+
+   std::string key = "ROOT " + std::string(gROOT->GetVersion()) + "\n";
+   key += DescribeDatasetForCache(lm);
+
+   std::unordered_map<void *, std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode>> visitedMap;
+   bool hasCompiled = false;
+   key += DescribeGraphForCache(node.fProxiedPtr->GetGraph(visitedMap).get(), hasCompiled);
+
+   // Defines (and aliases) that are not upstream of a Filter do not appear in the graph
+   for (const auto &colName : node.fColRegister.GetNames()) {
+      if (ROOT::Internal::RDF::IsInternalColumn(colName))
+         continue;
+      if (const auto *define = node.fColRegister.GetDefine(colName)) {
+         key += "define: " + colName + " " + define->GetTypeName() + " [" + define->GetExpression() + "]" +
+                DescribeColumnsForCache(define->GetColumnNames()) + "\n";
+         hasCompiled |= dynamic_cast<const ROOT::Detail::RDF::RJittedDefine *>(define) == nullptr;
+      } else if (node.fColRegister.IsAlias(colName))
+         key += "alias: " + colName + " " + node.fColRegister.ResolveAlias(colName) + "\n";
+   }
+   for (const auto &colName : columns)
+      key += "column: " + colName + " " + node.GetColumnType(colName) + "\n";
+   // the type name of a compiled callable does not tell e.g. the values captured by a lambda
+   if (hasCompiled && tag.empty())
+      throw std::runtime_error("PersistentCache: the computation graph contains Defines or Filters with compiled "
+                               "callables, which cannot be identified reliably. Please provide a tag that "
+                               "identifies the computation.");
+   key += "tag: " + tag + "\n";
+
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(key.data()), key.size());
+   md5.Final();
+   const std::string fileName = cacheDir + "/rdfcache_" + md5.AsString() + ".root";
+
+   // AccessPathName returns false if the file exists
+   if (!gSystem->AccessPathName(fileName.c_str())) {
+      std::unique_ptr<TFile> f(TFile::Open(fileName.c_str(), "READ"));
+      auto *storedKey = f ? f->Get<TNamed>(kPersistentCacheKeyName) : nullptr;
+      // the full key is compared as well, to rule out hash collisions
+      if (storedKey && key == storedKey->GetTitle() && f->Get<TTree>(kPersistentCacheTreeName)) {
+         R__LOG_INFO(ROOT::Detail::RDF::RDFLogChannel()) << "PersistentCache: reading cached columns from " << fileName;
+         return ROOT::RDataFrame(kPersistentCacheTreeName, fileName);
+      }
+   }
+
+   // write to a temporary file first so that concurrent jobs never see a partially written cache
+   R__LOG_INFO(ROOT::Detail::RDF::RDFLogChannel()) << "PersistentCache: writing cached columns to " << fileName;
+   const std::string tmpFileName = fileName + ".tmp" + std::to_string(gSystem->GetPid());
+   try {
+      node.Snapshot(kPersistentCacheTreeName, tmpFileName, columns);
+   } catch (...) {
+      gSystem->Unlink(tmpFileName.c_str());
+      throw;
+   }
+   {
+      TFile f(tmpFileName.c_str(), "UPDATE");
+      TNamed storedKey(kPersistentCacheKeyName, key.c_str());
+      f.WriteObject(&storedKey, kPersistentCacheKeyName);
+   }
+   if (gSystem->Rename(tmpFileName.c_str(), fileName.c_str()) != 0) {
+      gSystem->Unlink(tmpFileName.c_str());
+      throw std::runtime_error("PersistentCache: could not move the cache file to " + fileName);
+   }
+
+   return ROOT::RDataFrame(kPersistentCacheTreeName, fileName);
+}
+
+void ROOT::RDF::Experimental::SetJitCacheDir(const std::string &cacheDir)
+{
+   ROOT::Internal::RDF::SetJitCacheDir(cacheDir);
+}
+
+void ROOT::RDF::Experimental::SetJittedNodeSharing(bool enable)
+{
+   ROOT::Internal::RDF::SetJittedNodeSharing(enable);
+}
@@ -19,6 +19,7 @@
 #include <ROOT/RDF/RLoopManager.hxx>
 #include <ROOT/RDF/RNodeBase.hxx>
 #include <ROOT/RDF/Utils.hxx>
+#include <ROOT/RLogger.hxx>
 #include <ROOT/RStringView.hxx>
 #include <TBranch.h>
 #include <TClass.h>
@@ -26,10 +27,12 @@
 #include <TDataType.h>
 #include <TError.h>
 #include <TLeaf.h>
+#include <TMD5.h>
 #include <TObjArray.h>
 #include <TPRegexp.h>
 #include <TROOT.h>
 #include <TString.h>
+#include <TSystem.h>
 #include <TTree.h>
 #include <TVirtualMutex.h>
 
@@ -46,11 +49,14 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstdlib>  // for size_t
+#include <fstream>
 #include <iterator> // for back_insert_iterator
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <stdexcept>
@@ -299,13 +305,140 @@ BuildFunctionString(const std::string &expr, const ColumnNames_t &vars, const Co
    return ss.str();
 }
 
-/// Declare a function to the interpreter in namespace R_rdf, return the name of the jitted function.
-/// If the function is already in GetJittedExprs, return the name for the function that has already been jitted.
-static std::string DeclareFunction(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes)
+/// The directory of the persistent cache of compiled jitted functions, empty if the cache is disabled.
+static std::string &GetJitCacheDir()
+{
+   static std::string cacheDir;
+   return cacheDir;
+}
+
+/// Each jitted function comes with a func_ret_t type alias for its return type.
+/// Resolve that alias and return the true type as string.
+static std::string RetTypeOfFunc(const std::string &funcName)
+{
+   const auto dt = gROOT->GetType((funcName + "_ret_t").c_str());
+   R__ASSERT(dt != nullptr);
+   const auto type = dt->GetFullTypeName();
+   return type;
+}
+
+/// Return the hash that identifies the function with the given code in the persistent cache of jitted functions.
+/// The code contains the expression and the types of the columns.
+static std::string JitCacheHash(const std::string &funcCode)
+{
+   const std::string key = std::string("ROOT ") + gROOT->GetVersion() + " " + gROOT->GetGitCommit() + "\n" + funcCode;
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(key.data()), key.size());
+   md5.Final();
+   return md5.AsString();
+}
+
+/// Make the function with the given hash available to the interpreter by loading its compiled version from the
+/// persistent cache of jitted functions and declaring its prototype. Return false if it is not in the cache.
+static bool DeclareFunctionFromJitCache(const std::string &hash)
+{
+   const auto baseName = GetJitCacheDir() + "/rdfjit_" + hash;
+   const auto protoName = baseName + ".h";
+   const auto libName = baseName + "_C." + gSystem->GetSoExt();
+   // AccessPathName returns false if the file exists. The prototype is written last, once the library is complete.
+   if (gSystem->AccessPathName(protoName.c_str()) || gSystem->AccessPathName(libName.c_str()))
+      return false;
+
+   std::ifstream protoFile(protoName);
+   const std::string proto((std::istreambuf_iterator<char>(protoFile)), std::istreambuf_iterator<char>());
+   if (!protoFile || gSystem->Load(libName.c_str()) < 0)
+      return false;
+   // only the prototype is declared: the interpreter does not need to compile the function
+   ROOT::Internal::RDF::InterpreterDeclare(proto);
+   R__LOG_DEBUG(10, ROOT::Detail::RDF::RDFLogChannel()) << "Loaded the jitted function " << hash << " from " << libName;
+   return true;
+}
+
+/// Compile the given macro with ACLiC into a library next to it, without loading the library. Return true on success.
+static bool CompileJitCacheMacro(const std::string &macroName)
+{
+   // k: keep the library, O: optimize, s: silent, c: do not load it, -: do not create sub-directories
+   return gSystem->CompileMacro(macroName.c_str(), "kOsc-", "", GetJitCacheDir().c_str()) == 1;
+}
+
+/// Compile the function with the given code and return type, which has already been declared to the interpreter, with
+/// ACLiC and store it in the persistent cache of jitted functions, together with its prototype. The compilation takes
+/// long: this must not be called with gROOTMutex locked.
+static void AddFunctionToJitCache(const std::string &hash, const std::string &funcCode, const std::string &retType)
+{
+   const auto baseName = GetJitCacheDir() + "/rdfjit_" + hash;
+   const auto failedName = baseName + ".failed";
+   // do not try again to compile functions that could not be compiled by a previous process
+   if (!gSystem->AccessPathName(failedName.c_str()))
+      return;
+
+   const auto funcBaseName = "func_" + hash;
+   // funcCode is "(<parameters>){<body>}" and type names cannot contain braces
+   const auto params = funcCode.substr(0, funcCode.find('{'));
+
+   // Everything is written under names unique to this process and then renamed into place, so that other processes
+   // never see incomplete files. The auxiliary files of ACLiC keep their temporary names, the library refers to them.
+   const auto tmpSuffix = "_tmp" + std::to_string(gSystem->GetPid());
+   const auto tmpBaseName = baseName + tmpSuffix;
+   const auto tmpMacroName = tmpBaseName + ".C";
+   {
+      std::ofstream macro(tmpMacroName);
+      macro << "#include \"ROOT/RVec.hxx\"\n#include \"TMath.h\"\nnamespace R_rdf {\n" << retType << ' ' << funcBaseName
+            << funcCode << "\n}\n";
+      if (!macro.flush()) {
+         // e.g. a full disk; the function may well be compiled by a later process
+         gSystem->Unlink(tmpMacroName.c_str());
+         return;
+      }
+   }
+   // A compilation can also fail for reasons unrelated to the function, such as a killed compiler. Only a failure that
+   // is reproduced by a second attempt is recorded as a property of the function.
+   if (!CompileJitCacheMacro(tmpMacroName) && !CompileJitCacheMacro(tmpMacroName)) {
+      R__LOG_INFO(ROOT::Detail::RDF::RDFLogChannel())
+         << "The jitted function \"" << funcCode
+         << "\" cannot be compiled outside of the interpreter, it will not be cached.";
+      gSystem->Unlink(tmpMacroName.c_str());
+      const auto tmpFailedName = failedName + tmpSuffix;
+      std::ofstream failed(tmpFailedName);
+      if (failed.flush())
+         gSystem->Rename(tmpFailedName.c_str(), failedName.c_str());
+      else
+         gSystem->Unlink(tmpFailedName.c_str());
+      return;
+   }
+
+   const std::string libSuffix = std::string("_C.") + gSystem->GetSoExt();
+   if (gSystem->Rename((tmpBaseName + libSuffix).c_str(), (baseName + libSuffix).c_str()) != 0) {
+      gSystem->Unlink((tmpBaseName + libSuffix).c_str());
+      gSystem->Unlink(tmpMacroName.c_str());
+      return;
+   }
+   gSystem->Rename(tmpMacroName.c_str(), (baseName + ".C").c_str());
+
+   // the prototype is renamed into place last: it marks the cache entry as complete
+   const auto protoName = baseName + ".h";
+   const auto tmpProtoName = protoName + tmpSuffix;
+   {
+      std::ofstream proto(tmpProtoName);
+      proto << "namespace R_rdf {\n" << retType << ' ' << funcBaseName << params << ";\nusing " << funcBaseName
+            << "_ret_t = " << retType << ";\n}\n";
+      if (!proto.flush()) {
+         gSystem->Unlink(tmpProtoName.c_str());
+         return;
+      }
+   }
+   gSystem->Rename(tmpProtoName.c_str(), protoName.c_str());
+}
+
+/// Declare the function with gROOTMutex locked, see DeclareFunction. If the function needs to be added to the
+/// persistent cache of jitted functions, its hash, code and return type are returned through the last parameters.
+static std::string DeclareFunctionLocked(const std::string &expr, const ColumnNames_t &vars,
+                                         const ColumnNames_t &varTypes, std::string &hash, std::string &funcCode,
+                                         std::string &retType)
 {
    R__LOCKGUARD(gROOTMutex);
 
-   const auto funcCode = BuildFunctionString(expr, vars, varTypes);
+   funcCode = BuildFunctionString(expr, vars, varTypes);
    auto &exprMap = GetJittedExprs();
    const auto exprIt = exprMap.find(funcCode);
    if (exprIt != exprMap.end()) {
@@ -314,8 +447,16 @@ static std::string DeclareFunction(const std::string &expr, const ColumnNames_t
       return funcName;
    }
 
-   // new expression
-   const auto funcBaseName = "func" + std::to_string(exprMap.size());
+   const bool useJitCache = !GetJitCacheDir().empty();
+   if (useJitCache)
+      hash = JitCacheHash(funcCode);
+   if (useJitCache && DeclareFunctionFromJitCache(hash)) {
+      exprMap.insert({funcCode, "R_rdf::func_" + hash});
+      return "R_rdf::func_" + hash;
+   }
+
+   // new expression. With the jit cache, the name must be the same in all processes.
+   const auto funcBaseName = useJitCache ? "func_" + hash : "func" + std::to_string(exprMap.size());
    const auto funcFullName = "R_rdf::" + funcBaseName;
 
    const auto toDeclare = "namespace R_rdf {\nauto " + funcBaseName + funcCode + "\nusing " + funcBaseName +
@@ -326,17 +467,24 @@ static std::string DeclareFunction(const std::string &expr, const ColumnNames_t
    // InterpreterDeclare could throw. If it doesn't, mark the function as already jitted
    exprMap.insert({funcCode, funcFullName});
 
+   if (useJitCache)
+      retType = RetTypeOfFunc(funcFullName);
+
    return funcFullName;
 }
 
-/// Each jitted function comes with a func_ret_t type alias for its return type.
-/// Resolve that alias and return the true type as string.
-static std::string RetTypeOfFunc(const std::string &funcName)
+/// Declare a function to the interpreter in namespace R_rdf, return the name of the jitted function.
+/// If the function is already in GetJittedExprs, return the name for the function that has already been jitted.
+/// If the persistent cache of jitted functions is enabled, the compiled function is loaded from the cache if
+/// possible, and added to the cache otherwise.
+static std::string DeclareFunction(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes)
 {
-   const auto dt = gROOT->GetType((funcName + "_ret_t").c_str());
-   R__ASSERT(dt != nullptr);
-   const auto type = dt->GetFullTypeName();
-   return type;
+   std::string hash, funcCode, retType;
+   auto funcName = DeclareFunctionLocked(expr, vars, varTypes, hash, funcCode, retType);
+   // the function is usable from now on: other threads do not wait for its compilation
+   if (!retType.empty())
+      AddFunctionToJitCache(hash, funcCode, retType);
+   return funcName;
 }
 
 [[noreturn]] void
@@ -638,6 +786,66 @@ std::string PrettyPrintAddr(const void *const addr)
    return s.str();
 }
 
+/// Set the directory of the persistent cache of compiled jitted functions. An empty string disables the cache.
+void SetJitCacheDir(const std::string &cacheDir)
+{
+   R__LOCKGUARD(gROOTMutex);
+   GetJitCacheDir() = cacheDir;
+}
+
+/// Whether identical jitted Defines and Filters share a single node, see SetJittedNodeSharing().
+static std::atomic<bool> &JittedNodeSharing()
+{
+   static std::atomic<bool> isEnabled{true};
+   return isEnabled;
+}
+
+/// Enable or disable the sharing of identical jitted Defines and Filters for the computation graphs booked from now on.
+void SetJittedNodeSharing(bool enable)
+{
+   JittedNodeSharing() = enable;
+}
+
+/// Return true if the expression can evaluate to different values for the same inputs, which rules out sharing its
+/// node. Only the common sources of random numbers are recognized; other side effects need to be handled by disabling
+/// the sharing altogether.
+static bool IsNonDeterministic(std::string_view expression)
+{
+   static TPRegexp randomRegex("\\b(gRandom|TRandom\\w*|rand|random|drand48|random_device|mt19937\\w*|Rndm)\\b");
+   // TPRegexp compiles the pattern on first use: matches must not run concurrently
+   static std::mutex randomRegexMutex;
+   std::lock_guard<std::mutex> lock(randomRegexMutex);
+   return randomRegex.MatchB(std::string(expression).c_str());
+}
+
+/// Return a key that identifies the values computed by a jitted Define or Filter: its jitted function and its actual
+/// input columns. Defined input columns are identified by the RDefineBase that evaluates them, so that columns with the
+/// same name but different definitions on different branches of the computation graph do not match, while chains of
+/// identical Defines are shared as a whole. An empty key, i.e. no sharing, is returned
+/// - if sharing is disabled,
+/// - if the expression reads no column: every node is meant to evaluate it anew, e.g. for `gRandom->Gaus()`,
+///   and expressions of constants are cheap anyway,
+/// - if the expression draws random numbers,
+/// - if the inputs depend on systematic variations, which are registered per branch of the computation graph.
+static std::string JittedNodeKey(const std::string &funcName, std::string_view expression,
+                                 const ColumnNames_t &usedCols, const RColumnRegister &colRegister)
+{
+   if (!JittedNodeSharing() || usedCols.empty() || IsNonDeterministic(expression))
+      return "";
+   if (!colRegister.GetVariationDeps(usedCols).empty())
+      return "";
+
+   std::string key = funcName;
+   for (const auto &col : usedCols) {
+      const auto resolvedCol = colRegister.ResolveAlias(col);
+      const RDFDetail::RDefineBase *define = colRegister.GetDefine(resolvedCol);
+      if (const auto *jittedDefine = dynamic_cast<const RDFDetail::RJittedDefine *>(define))
+         define = jittedDefine->GetEvaluatingDefine();
+      key += define ? ";define:" + PrettyPrintAddr(define) : ";column:" + resolvedCol;
+   }
+   return key;
+}
+
 /// Book the jitting of a Filter call
 std::shared_ptr<RDFDetail::RJittedFilter>
 BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string_view name, std::string_view expression,
@@ -653,14 +861,25 @@ BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string
    if (type != "bool")
       std::runtime_error("Filter: the following expression does not evaluate to bool:\n" + std::string(expression));
 
+   auto *lm = (*prevNodeOnHeap)->GetLoopManagerUnchecked();
+   // unnamed filters with the same expression, inputs and previous node are shared, so that they are evaluated once
+   auto key = name.empty() ? JittedNodeKey(funcName, expression, parsedExpr.fUsedCols, colRegister) : "";
+   if (!key.empty()) {
+      key += ";prev:" + PrettyPrintAddr(prevNodeOnHeap->get());
+      if (auto existingFilter = lm->GetJittedFilter(key)) {
+         delete prevNodeOnHeap;
+         return existingFilter;
+      }
+   }
+
    // definesOnHeap is deleted by the jitted call to JitFilterHelper
    ROOT::Internal::RDF::RColumnRegister *definesOnHeap = new ROOT::Internal::RDF::RColumnRegister(colRegister);
    const auto definesOnHeapAddr = PrettyPrintAddr(definesOnHeap);
    const auto prevNodeAddr = PrettyPrintAddr(prevNodeOnHeap);
 
    const auto jittedFilter = std::make_shared<RDFDetail::RJittedFilter>(
-      (*prevNodeOnHeap)->GetLoopManagerUnchecked(), name,
-      Union(colRegister.GetVariationDeps(parsedExpr.fUsedCols), (*prevNodeOnHeap)->GetVariations()));
+      lm, name,
+      Union(colRegister.GetVariationDeps(parsedExpr.fUsedCols), (*prevNodeOnHeap)->GetVariations()), expression);
 
    // Produce code snippet that creates the filter and registers it with the corresponding RJittedFilter
    // Windows requires std::hex << std::showbase << (size_t)pointer to produce notation "0x1234"
@@ -682,8 +901,9 @@ BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string
                     << "reinterpret_cast<ROOT::Internal::RDF::RColumnRegister*>(" << definesOnHeapAddr << ")"
                     << ");\n";
 
-   auto lm = jittedFilter->GetLoopManagerUnchecked();
    lm->ToJitExec(filterInvocation.str());
+   if (!key.empty())
+      lm->AddJittedFilter(key, jittedFilter);
 
    return jittedFilter;
 }
@@ -703,9 +923,21 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
    const auto funcName = DeclareFunction(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes);
    const auto type = RetTypeOfFunc(funcName);
 
+   auto jittedDefine =
+      std::make_shared<RDFDetail::RJittedDefine>(name, type, lm, colRegister, parsedExpr.fUsedCols, expression);
+
+   // Defines with the same expression and inputs forward to the first one, so that the expression is evaluated once
+   const auto key = JittedNodeKey(funcName, expression, parsedExpr.fUsedCols, colRegister);
+   if (!key.empty()) {
+      if (auto existingDefine = lm.GetJittedDefine(key)) {
+         jittedDefine->SetSharedDefine(std::move(existingDefine));
+         delete upcastNodeOnHeap;
+         return jittedDefine;
+      }
+   }
+
    auto definesCopy = new RColumnRegister(colRegister);
    auto definesAddr = PrettyPrintAddr(definesCopy);
-   auto jittedDefine = std::make_shared<RDFDetail::RJittedDefine>(name, type, lm, colRegister, parsedExpr.fUsedCols);
 
    std::stringstream defineInvocation;
    defineInvocation << "ROOT::Internal::RDF::JitDefineHelper<ROOT::Internal::RDF::DefineTypes::RDefineTag>(" << funcName
@@ -728,6 +960,8 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
                     << PrettyPrintAddr(upcastNodeOnHeap) << "));\n";
 
    lm.ToJitExec(defineInvocation.str());
+   if (!key.empty())
+      lm.AddJittedDefine(key, jittedDefine);
    return jittedDefine;
 }
 
@@ -742,7 +976,8 @@ std::shared_ptr<RJittedDefine> BookDefinePerSampleJit(std::string_view name, std
 
    auto definesCopy = new RColumnRegister(colRegister);
    auto definesAddr = PrettyPrintAddr(definesCopy);
-   auto jittedDefine = std::make_shared<RDFDetail::RJittedDefine>(name, retType, lm, colRegister, ColumnNames_t{});
+   auto jittedDefine =
+      std::make_shared<RDFDetail::RJittedDefine>(name, retType, lm, colRegister, ColumnNames_t{}, expression);
 
    std::stringstream defineInvocation;
    defineInvocation << "ROOT::Internal::RDF::JitDefineHelper<ROOT::Internal::RDF::DefineTypes::RDefinePerSampleTag>("
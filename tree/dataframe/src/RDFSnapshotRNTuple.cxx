@@ -0,0 +1,197 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDF/ActionHelpers.hxx"
+#include "ROOT/REntry.hxx"
+#include "ROOT/RField.hxx"
+#include "ROOT/RNTuple.hxx"
+#include "ROOT/RNTupleDS.hxx"
+#include "ROOT/RNTupleModel.hxx"
+#include "ROOT/RNTupleOptions.hxx"
+#include "ROOT/RNTupleParallelWriter.hxx"
+#include "ROOT/RPageAllocator.hxx"
+#include "ROOT/RPageStorage.hxx"
+#include "TDirectory.h"
+#include "TFile.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using ROOT::Experimental::DescriptorId_t;
+using ROOT::Experimental::NTupleSize_t;
+using ROOT::Experimental::REntry;
+using ROOT::Experimental::RNTupleDS;
+using ROOT::Experimental::RNTupleFillContext;
+using ROOT::Experimental::RNTupleLocator;
+using ROOT::Experimental::RNTupleModel;
+using ROOT::Experimental::RNTupleParallelWriter;
+using ROOT::Experimental::RNTupleWriteOptions;
+using ROOT::Experimental::RNTupleWriter;
+using ROOT::Experimental::Detail::RFieldBase;
+using ROOT::Experimental::Detail::RPage;
+using ROOT::Experimental::Detail::RPageAllocatorHeap;
+using ROOT::Experimental::Detail::RPageSink;
+using ROOT::Internal::RDF::RSnapshotNTupleWriterBase;
+
+/// The model of the Snapshot output, one top-level field per column
+std::unique_ptr<RNTupleModel>
+MakeSnapshotModel(const std::vector<std::string> &fieldNames, const std::vector<std::string> &fieldTypes)
+{
+   auto model = RNTupleModel::CreateBare();
+   for (std::size_t i = 0; i < fieldNames.size(); ++i) {
+      if (fieldTypes[i].empty())
+         throw std::runtime_error("Snapshot: cannot write column \"" + fieldNames[i] +
+                                  "\" as RNTuple field because its type is unknown");
+      auto field = RFieldBase::Create(fieldNames[i], fieldTypes[i]);
+      if (!field)
+         throw std::runtime_error("Snapshot: cannot write column \"" + fieldNames[i] + "\" of type " + fieldTypes[i] +
+                                  " as RNTuple field: " + field.GetError()->GetReport());
+      model->AddField(field.Unwrap());
+   }
+   return model;
+}
+
+/// A page sink that writes nothing.  It is only used to obtain the descriptor of the Snapshot output before the
+/// output is written, from which the data frame returned by Snapshot takes its columns.
+class RPageSinkSchema final : public RPageSink {
+protected:
+   void CreateImpl(const RNTupleModel &, unsigned char *, std::uint32_t) final {}
+   RNTupleLocator CommitPageImpl(ColumnHandle_t, const RPage &) final { return {}; }
+   RNTupleLocator CommitSealedPageImpl(DescriptorId_t, const RSealedPage &) final { return {}; }
+   std::uint64_t CommitClusterImpl(NTupleSize_t) final { return 0; }
+   RNTupleLocator CommitClusterGroupImpl(unsigned char *, std::uint32_t) final { return {}; }
+   void CommitDatasetImpl(unsigned char *, std::uint32_t) final {}
+
+   RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final
+   {
+      auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+      return RPageAllocatorHeap::NewPage(columnHandle.fId, elementSize, nElements);
+   }
+   void ReleasePage(RPage &page) final { RPageAllocatorHeap::DeletePage(page); }
+
+public:
+   RPageSinkSchema(std::string_view ntupleName) : RPageSink(ntupleName, RNTupleWriteOptions()) {}
+};
+
+/// Writes the Snapshot output with an RNTupleWriter (single slot) or with an RNTupleParallelWriter and one fill
+/// context per slot. The fields of the output model are filled from bare entries that point directly to the
+/// column values of the event loop, so no copies are made.
+class RSnapshotNTupleWriter final : public RSnapshotNTupleWriterBase {
+   /// The per-slot state of the output
+   struct RSlot {
+      /// Only used in multi-thread mode; needs to be destructed before the parallel writer
+      std::unique_ptr<RNTupleFillContext> fContext;
+      std::unique_ptr<REntry> fEntry;
+      /// The addresses captured by fEntry, updated whenever the event loop moves a column value
+      std::vector<void *> fAddresses;
+   };
+
+   std::string fFileName;
+   std::string fNTupleName;
+   std::vector<std::string> fFieldNames;
+   std::unique_ptr<TFile> fOutputFile;
+   /// Set in single-thread mode
+   std::unique_ptr<RNTupleWriter> fWriter;
+   /// Set in multi-thread mode
+   std::unique_ptr<RNTupleParallelWriter> fParallelWriter;
+   std::vector<RSlot> fSlots;
+
+   void CreateEntry(RSlot &slot)
+   {
+      if (fWriter) {
+         slot.fEntry = fWriter->GetModel()->CreateBareEntry();
+      } else {
+         slot.fContext = fParallelWriter->CreateFillContext();
+         slot.fEntry = slot.fContext->GetModel()->CreateBareEntry();
+      }
+      slot.fAddresses.assign(fFieldNames.size(), nullptr);
+   }
+
+public:
+   RSnapshotNTupleWriter(const std::string &fileName, const std::string &ntupleName,
+                         const std::vector<std::string> &fieldNames, const std::vector<std::string> &fieldTypes,
+                         const ROOT::RDF::RSnapshotOptions &options, unsigned int nSlots)
+      : fFileName(fileName), fNTupleName(ntupleName), fFieldNames(fieldNames), fSlots(nSlots)
+   {
+      auto model = MakeSnapshotModel(fFieldNames, fieldTypes);
+
+      const auto compression = ROOT::CompressionSettings(options.fCompressionAlgorithm, options.fCompressionLevel);
+      RNTupleWriteOptions writeOptions;
+      writeOptions.SetCompression(compression);
+
+      ::TDirectory::TContext ctxt;
+      fOutputFile.reset(TFile::Open(fFileName.c_str(), options.fMode.c_str(), /*ftitle=*/"", compression));
+      if (!fOutputFile || fOutputFile->IsZombie())
+         throw std::runtime_error("Snapshot: could not create output file " + fFileName);
+
+      if (nSlots == 1)
+         fWriter = RNTupleWriter::Append(std::move(model), fNTupleName, *fOutputFile, writeOptions);
+      else
+         fParallelWriter = RNTupleParallelWriter::Append(std::move(model), fNTupleName, *fOutputFile, writeOptions);
+   }
+
+   void Fill(unsigned int slotIdx, void *const *values) final
+   {
+      auto &slot = fSlots[slotIdx];
+      if (!slot.fEntry)
+         CreateEntry(slot);
+      for (std::size_t i = 0; i < fFieldNames.size(); ++i) {
+         if (slot.fAddresses[i] == values[i])
+            continue;
+         slot.fEntry->CaptureValueUnsafe(fFieldNames[i], values[i]);
+         slot.fAddresses[i] = values[i];
+      }
+      if (fWriter)
+         fWriter->Fill(*slot.fEntry);
+      else
+         slot.fContext->Fill(*slot.fEntry);
+   }
+
+   void Finalize() final
+   {
+      // Commits the last clusters of the fill contexts, then the dataset
+      fSlots.clear();
+      fWriter.reset();
+      fParallelWriter.reset();
+      fOutputFile->Close();
+      fOutputFile.reset();
+   }
+};
+
+} // anonymous namespace
+
+std::unique_ptr<RSnapshotNTupleWriterBase> ROOT::Internal::RDF::MakeSnapshotNTupleWriter(
+   const std::string &fileName, const std::string &dirName, const std::string &ntupleName,
+   const ColumnNames_t &fieldNames, const std::vector<std::string> &fieldTypes, const RSnapshotOptions &options,
+   unsigned int nSlots)
+{
+   if (!dirName.empty())
+      throw std::runtime_error("Snapshot: writing an RNTuple into a sub-directory is not supported");
+   return std::make_unique<RSnapshotNTupleWriter>(fileName, ntupleName, fieldNames, fieldTypes, options, nSlots);
+}
+
+std::shared_ptr<ROOT::RDataFrame>
+ROOT::Internal::RDF::MakeSnapshotNTupleDataFrame(const std::string &fileName, const std::string &ntupleName,
+                                                 const ColumnNames_t &fieldNames,
+                                                 const std::vector<std::string> &fieldTypes)
+{
+   // The schema sink needs to outlive the model, whose fields are connected to it
+   RPageSinkSchema schemaSink(ntupleName);
+   auto model = MakeSnapshotModel(ReplaceDotWithUnderscore(fieldNames), fieldTypes);
+   schemaSink.Create(*model);
+
+   auto pageSource = ROOT::Experimental::Detail::RPageSource::Create(ntupleName, fileName);
+   return std::make_shared<ROOT::RDataFrame>(
+      std::make_unique<RNTupleDS>(std::move(pageSource), schemaSink.GetDescriptor()));
+}
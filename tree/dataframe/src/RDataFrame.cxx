@@ -1131,6 +1131,12 @@ When strings are passed as expressions to Filter() or Define(), fundamental type
 df.Define("x", "0").Filter("x = 0");
 ~~~
 
+Unnamed string Filters and Defines with the same expression and the same input columns are evaluated only once per
+entry, even if they are booked on different branches of the computation graph. RDataFrame assumes that such
+expressions are pure functions of their input columns: expressions that read no column or that draw random numbers
+(e.g. `x + gRandom->Gaus()`) are never shared. For expressions with other side effects, the sharing can be disabled
+with ROOT::RDF::Experimental::SetJittedNodeSharing().
+
 \anchor generic-actions
 ### User-defined custom actions
 RDataFrame strives to offer a comprehensive set of standard actions that can be performed on each event. At the same
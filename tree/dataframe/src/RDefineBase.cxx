@@ -48,3 +48,11 @@ std::string RDefineBase::GetTypeName() const
 {
    return fType;
 }
+
+void RDefineBase::SetUsed()
+{
+   if (fIsUsed)
+      return;
+   fIsUsed = true;
+   fColRegister.SetDefinesUsed(fColumnNames);
+}
@@ -51,6 +51,12 @@ void RJittedDefine::Update(unsigned int slot, const ROOT::RDF::RSampleInfo &id)
    fConcreteDefine->Update(slot, id);
 }
 
+void *RJittedDefine::UpdateBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask, std::size_t bulkSize)
+{
+   assert(fConcreteDefine != nullptr);
+   return fConcreteDefine->UpdateBulk(slot, mask, bulkSize);
+}
+
 void RJittedDefine::FinalizeSlot(unsigned int slot)
 {
    assert(fConcreteDefine != nullptr);
@@ -68,3 +74,9 @@ RDefineBase &RJittedDefine::GetVariedDefine(const std::string &variationName)
    assert(fConcreteDefine != nullptr);
    return fConcreteDefine->GetVariedDefine(variationName);
 }
+
+void RJittedDefine::SetUsed()
+{
+   assert(fConcreteDefine != nullptr);
+   fConcreteDefine->SetUsed();
+}
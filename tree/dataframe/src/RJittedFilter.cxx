@@ -17,9 +17,11 @@
 
 using namespace ROOT::Detail::RDF;
 
-RJittedFilter::RJittedFilter(RLoopManager *lm, std::string_view name, const std::vector<std::string> &variations)
+RJittedFilter::RJittedFilter(RLoopManager *lm, std::string_view name, const std::vector<std::string> &variations,
+                             std::string_view expression)
    : RFilterBase(lm, name, lm->GetNSlots(), RDFInternal::RColumnRegister(nullptr), /*columnNames*/ {}, variations)
 {
+   fExpressionStr = std::string(expression);
    // Jitted nodes of the computation graph (e.g. RJittedAction, RJittedDefine) usually don't need to register
    // themselves with the RLoopManager: the _concrete_ nodes will be registered with the RLoopManager right before
    // the event loop, at jitting time, and that is good enough.
@@ -59,6 +61,12 @@ bool RJittedFilter::CheckFilters(unsigned int slot, Long64_t entry)
    return fConcreteFilter->CheckFilters(slot, entry);
 }
 
+const RDFInternal::RMaskedEntryRange &RJittedFilter::CheckFiltersBulk(unsigned int slot, std::size_t bulkSize)
+{
+   assert(fConcreteFilter != nullptr);
+   return fConcreteFilter->CheckFiltersBulk(slot, bulkSize);
+}
+
 void RJittedFilter::Report(ROOT::RDF::RCutFlowReport &cr) const
 {
    assert(fConcreteFilter != nullptr);
@@ -132,8 +140,12 @@ std::shared_ptr<RDFGraphDrawing::GraphNode>
 RJittedFilter::GetGraph(std::unordered_map<void *, std::shared_ptr<RDFGraphDrawing::GraphNode>> &visitedMap)
 {
    if (fConcreteFilter != nullptr) {
-      // Here the filter exists, so it can be served
-      return fConcreteFilter->GetGraph(visitedMap);
+      // Here the filter exists, so it can be served. The graph node shows the jitted expression rather than the
+      // type of the concrete filter.
+      auto node = fConcreteFilter->GetGraph(visitedMap);
+      node->SetExpression(fExpressionStr);
+      node->SetCompiled(false);
+      return node;
    }
    throw std::runtime_error("The Jitting should have been invoked before this method.");
 }
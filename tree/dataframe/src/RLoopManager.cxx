@@ -11,10 +11,12 @@
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/InternalTreeUtils.hxx" // GetTreeFullPaths
 #include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RBulkColumnReader.hxx"
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
+#include "ROOT/RDF/RStealableRanges.hxx"
 #include "ROOT/RDF/RVariationBase.hxx"
 #include "ROOT/RLogger.hxx"
 #include "RtypesCore.h" // Long64_t
@@ -299,6 +301,27 @@ DatasetLogInfo TreeDatasetLogInfo(const TTreeReader &r, unsigned int slot)
    return {std::move(what), static_cast<ULong64_t>(entryRange.first), end, slot};
 }
 
+/// Minimum number of entries a task takes over from another task that processes the same TTree. Splitting a range
+/// in the middle of a cluster makes both tasks read its baskets, so this should be comparable to a cluster size.
+constexpr Long64_t kMinStealTreeEntries = 1000;
+/// Minimum number of entries a task takes over from another task that processes entries of a RDataSource.
+constexpr Long64_t kMinStealDataSourceEntries = 100;
+
+/// Return a string that identifies the entry numbering of the TTree read by the TTreeReader. A task can only take
+/// over the entries of another task if the TTreeReaders of both read the same (chain of) trees.
+std::string TreeEntryDomain(const TTreeReader &r)
+{
+   const auto tree = r.GetTree();
+   std::string domain = tree->GetName();
+   if (const auto chain = dynamic_cast<TChain *>(tree)) {
+      for (TObject *f : *chain->GetListOfFiles())
+         domain += std::string("\n") + f->GetName() + " " + f->GetTitle();
+   } else if (const auto file = tree->GetCurrentFile()) {
+      domain += std::string("\n") + file->GetName();
+   }
+   return domain;
+}
+
 static auto MakeDatasetColReadersKey(const std::string &colName, const std::type_info &ti)
 {
    // We use a combination of column name and column type name as the key because in some cases we might end up
@@ -459,6 +482,7 @@ void RLoopManager::RunEmptySourceMT()
          for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
             RunAndCheckFilters(slot, currEntry);
          }
+         RunBulk(slot);
       } catch (...) {
          // Error might throw in experiment frameworks like CMSSW
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -483,6 +507,7 @@ void RLoopManager::RunEmptySource()
       for (ULong64_t currEntry = 0; currEntry < fNEmptyEntries && fNStopsReceived < fNChildren; ++currEntry) {
          RunAndCheckFilters(0, currEntry);
       }
+      RunBulk(0);
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
       throw;
@@ -490,6 +515,8 @@ void RLoopManager::RunEmptySource()
 }
 
 /// Run event loop over one or multiple ROOT files, in parallel.
+/// In the tail of the event loop, tasks that are done take over part of the entries of the tasks that are still
+/// running, see RStealableRanges.
 void RLoopManager::RunTreeProcessorMT()
 {
 #ifdef R__USE_IMT
@@ -503,7 +530,15 @@ void RLoopManager::RunTreeProcessorMT()
 
    std::atomic<ULong64_t> entryCount(0ull);
 
-   tp->Process([this, &slotStack, &entryCount](TTreeReader &r) -> void {
+   // With a TEntryList, the entry numbers of the TTreeReaders are indexes in the list: entries are never stolen.
+   const bool canSteal = entryList.GetN() == 0;
+   // The total number of entries is only known upfront if it does not require opening all files of a chain
+   const auto nTreeEntries = fTree->GetEntriesFast();
+   const ULong64_t nEntries =
+      canSteal && nTreeEntries != TTree::kMaxEntries ? std::min(fEndEntry, nTreeEntries) - fBeginEntry : 0ull;
+   RStealableRanges ranges(fNSlots, nEntries, kMinStealTreeEntries);
+
+   tp->Process([this, &slotStack, &entryCount, &ranges, canSteal](TTreeReader &r) -> void {
       ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
       auto slot = slotRAII.fSlot;
       RCallCleanUpTask cleanup(*this, slot, &r);
@@ -512,21 +547,40 @@ void RLoopManager::RunTreeProcessorMT()
       const auto entryRange = r.GetEntriesRange(); // we trust TTreeProcessorMT to call SetEntriesRange
       const auto nEntries = entryRange.second - entryRange.first;
       auto count = entryCount.fetch_add(nEntries);
+      RStealableRangeRAII rangeRAII(ranges, entryRange.first, entryRange.second, count,
+                                    canSteal ? TreeEntryDomain(r) : "");
+      auto &range = rangeRAII.fRange;
+      bool stolen = false;
       try {
-         // recursive call to check filters and conditionally execute actions
-         while (r.Next()) {
-            if (fNewSampleNotifier.CheckFlag(slot)) {
-               UpdateSampleInfo(slot, r);
+         do {
+            if (stolen) {
+               if (r.SetEntriesRange(range.GetBegin(), range.GetEnd()) != TTreeReader::kEntryValid)
+                  throw std::logic_error("Something went wrong in initializing the TTreeReader.");
+               count = range.GetFirstCount();
+               // the sample information contains the entry range, which changed
+               fNewSampleNotifier.SetFlag(slot);
+               R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing(TreeDatasetLogInfo(r, slot));
             }
-            RunAndCheckFilters(slot, count++);
-         }
+            // recursive call to check filters and conditionally execute actions
+            while ((!canSteal || range.Claim(r.GetCurrentEntry() + 1)) && r.Next()) {
+               if (fNewSampleNotifier.CheckFlag(slot)) {
+                  UpdateSampleInfo(slot, r);
+               }
+               RunAndCheckFilters(slot, count++);
+            }
+            // the loop also stops with a valid entry if the rest of the range has been stolen
+            if (r.GetEntryStatus() != TTreeReader::kEntryBeyondEnd && r.GetEntryStatus() != TTreeReader::kEntryValid)
+               break;
+         } while (canSteal && (stolen = ranges.Steal(range)));
+         RunBulk(slot);
       } catch (...) {
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
          throw;
       }
       // fNStopsReceived < fNChildren is always true at the moment as we don't support event loop early quitting in
       // multi-thread runs, but it costs nothing to be safe and future-proof in case we add support for that later.
-      if (r.GetEntryStatus() != TTreeReader::kEntryBeyondEnd && fNStopsReceived < fNChildren) {
+      if (r.GetEntryStatus() != TTreeReader::kEntryBeyondEnd && r.GetEntryStatus() != TTreeReader::kEntryValid &&
+          fNStopsReceived < fNChildren) {
          // something went wrong in the TTreeReader event loop
          throw std::runtime_error("An error was encountered while processing the data. TTreeReader status code is: " +
                                   std::to_string(r.GetEntryStatus()));
@@ -561,6 +615,7 @@ void RLoopManager::RunTreeReader()
          }
          RunAndCheckFilters(0, r.GetCurrentEntry());
       }
+      RunBulk(0);
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
       throw;
@@ -611,32 +666,46 @@ void RLoopManager::RunDataSourceMT()
    ROOT::Internal::RSlotStack slotStack(fNSlots);
    ROOT::TThreadExecutor pool;
 
-   // Each task works on a subrange of entries
-   auto runOnRange = [this, &slotStack](const std::pair<ULong64_t, ULong64_t> &range) {
-      ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
-      const auto slot = slotRAII.fSlot;
-      InitNodeSlots(nullptr, slot);
-      RCallCleanUpTask cleanup(*this, slot);
-      fDataSource->InitSlot(slot, range.first);
-      const auto start = range.first;
-      const auto end = range.second;
-      R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, slot});
-      try {
-         for (auto entry = start; entry < end; ++entry) {
-            if (fDataSource->SetEntry(slot, entry)) {
-               RunAndCheckFilters(slot, entry);
-            }
-         }
-      } catch (...) {
-         std::cerr << "RDataFrame::Run: event loop was interrupted\n";
-         throw;
-      }
-      fDataSource->CallFinalizeSlot(slot);
-   };
+   // Sub-ranges are only handed to the InitSlot/SetEntry/FinalizeSlot calls of data sources that support it
+   const bool canSteal = fDataSource->SupportsRangeSplitting();
 
    fDataSource->CallInitialize();
    auto ranges = fDataSource->GetEntryRanges();
    while (!ranges.empty()) {
+      // In the tail of the processing of the ranges, tasks that are done take over part of the entries of the tasks
+      // that are still running, see RStealableRanges. The entries of a range only belong to the current set of ranges.
+      ULong64_t nEntries = 0ull;
+      for (const auto &range : ranges)
+         nEntries += range.second - range.first;
+      RStealableRanges stealableRanges(fNSlots, nEntries, kMinStealDataSourceEntries);
+
+      // Each task works on a subrange of entries
+      auto runOnRange = [this, &slotStack, &stealableRanges, canSteal](const std::pair<ULong64_t, ULong64_t> &range) {
+         ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
+         const auto slot = slotRAII.fSlot;
+         InitNodeSlots(nullptr, slot);
+         RCallCleanUpTask cleanup(*this, slot);
+         RStealableRangeRAII rangeRAII(stealableRanges, range.first, range.second, range.first);
+         auto &taskRange = rangeRAII.fRange;
+         do {
+            const ULong64_t start = taskRange.GetBegin();
+            fDataSource->InitSlot(slot, start);
+            R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing(
+               {fDataSource->GetLabel(), start, static_cast<ULong64_t>(taskRange.GetEnd()), slot});
+            try {
+               for (auto entry = start; taskRange.Claim(entry); ++entry) {
+                  if (fDataSource->SetEntry(slot, entry)) {
+                     RunAndCheckFilters(slot, entry);
+                  }
+               }
+            } catch (...) {
+               std::cerr << "RDataFrame::Run: event loop was interrupted\n";
+               throw;
+            }
+            fDataSource->CallFinalizeSlot(slot);
+         } while (canSteal && stealableRanges.Steal(taskRange));
+      };
+
       pool.Foreach(runOnRange, ranges);
       ranges = fDataSource->GetEntryRanges();
    }
@@ -648,6 +717,11 @@ void RLoopManager::RunDataSourceMT()
 /// Named filters must be called even if the analysis logic would not require it, lest they report confusing results.
 void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
 {
+   if (fLoopBulkSize > 1) {
+      StageBulkEntry(slot, entry);
+      return;
+   }
+
    // data-block callbacks run before the rest of the graph
    if (fNewSampleNotifier.CheckFlag(slot)) {
       for (auto &callback : fSampleCallbacks)
@@ -663,18 +737,103 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
       callback(slot);
 }
 
+/// Add an entry to the bulk of the given slot, processing the bulk first if the entry cannot be part of it.
+/// Bulks are made of consecutive entries of the same data block (e.g. the same TTree of a TChain) so that the
+/// data-block callbacks, which may update the values of DefinePerSample columns, run in between bulks.
+void RLoopManager::StageBulkEntry(unsigned int slot, Long64_t entry)
+{
+   auto &bulk = fBulks[slot];
+   const bool isNewSample = fNewSampleNotifier.CheckFlag(slot);
+   if (isNewSample || (bulk.fNEntries > 0 && entry != bulk.fMask.FirstEntry() + Long64_t(bulk.fNEntries)))
+      RunBulk(slot);
+
+   if (isNewSample) {
+      for (auto &callback : fSampleCallbacks)
+         callback.second(slot, fSampleInfos[slot]);
+      fNewSampleNotifier.UnsetFlag(slot);
+   }
+
+   if (bulk.fNEntries == 0)
+      bulk.fMask.SetFirstEntry(entry);
+   for (auto *reader : bulk.fReaders)
+      reader->Stage(bulk.fNEntries, entry);
+   ++bulk.fNEntries;
+
+   if (bulk.fNEntries == fLoopBulkSize)
+      RunBulk(slot);
+}
+
+/// Process the entries staged for the given slot, if any: this is the bulk-mode equivalent of RunAndCheckFilters.
+void RLoopManager::RunBulk(unsigned int slot)
+{
+   if (fLoopBulkSize == 1 || fBulks[slot].fNEntries == 0)
+      return;
+
+   auto &bulk = fBulks[slot];
+   const auto nEntries = bulk.fNEntries;
+   for (std::size_t i = 0u; i < fLoopBulkSize; ++i)
+      bulk.fMask[i] = i < nEntries;
+
+   for (auto &actionPtr : fBookedActions)
+      actionPtr->RunBulk(slot, nEntries);
+   for (auto &namedFilterPtr : fBookedNamedFilters)
+      namedFilterPtr->CheckFiltersBulk(slot, nEntries);
+   for (std::size_t i = 0u; i < nEntries; ++i) {
+      for (auto &callback : fCallbacks)
+         callback(slot);
+   }
+   bulk.fNEntries = 0;
+}
+
+/// Decide whether the next event loop runs in bulk mode and prepare the per-slot bulks.
+/// Bulk mode is only used for empty sources and TTrees, and if all booked actions support it.
+void RLoopManager::SetupBulk()
+{
+   fLoopBulkSize = fBulkSize;
+   if (fBulkSize == 1)
+      return;
+
+   std::string reason;
+   if (fLoopType == ELoopType::kDataSource || fLoopType == ELoopType::kDataSourceMT)
+      reason = "RDataSources are not supported";
+   else if (!fBookedVariations.empty())
+      reason = "systematic variations are not supported";
+   else if (std::any_of(fBookedActions.begin(), fBookedActions.end(),
+                        [](RActionBase *a) { return !a->SupportsBulk(); }))
+      reason = "one of the booked actions does not support it";
+
+   if (!reason.empty()) {
+      R__LOG_INFO(RDFLogChannel()) << "Bulk mode was requested but the event loop will process one entry at a time: "
+                                   << reason << ".";
+      fLoopBulkSize = 1;
+      return;
+   }
+
+   fBulks.resize(fNSlots);
+   for (auto &bulk : fBulks) {
+      bulk.fMask = RMaskedEntryRange(fLoopBulkSize);
+      bulk.fNEntries = 0;
+      bulk.fReaders.clear();
+   }
+}
+
 /// Build TTreeReaderValues for all nodes
 /// This method loops over all filters, actions and other booked objects and
 /// calls their `InitSlot` method, to get them ready for running a task.
+/// Filters that are not evaluated and defines that are not read in this event loop are skipped.
 void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
 {
    SetupSampleCallbacks(r, slot);
    for (auto &ptr : fBookedActions)
       ptr->InitSlot(r, slot);
-   for (auto &ptr : fBookedFilters)
-      ptr->InitSlot(r, slot);
-   for (auto &ptr : fBookedDefines)
-      ptr->InitSlot(r, slot);
+   for (auto &ptr : fBookedFilters) {
+      if (ptr->IsActive())
+         ptr->InitSlot(r, slot);
+   }
+   for (auto &ptr : fBookedDefines) {
+      if (ptr->IsUsed())
+         ptr->InitSlot(r, slot);
+   }
    for (auto &ptr : fBookedVariations)
       ptr->InitSlot(r, slot);
 
@@ -726,6 +885,7 @@ void RLoopManager::UpdateSampleInfo(unsigned int slot, TTreeReader &r) {
 void RLoopManager::InitNodes()
 {
    EvalChildrenCounts();
+   SetUsedDefines();
    for (auto &filter : fBookedFilters)
       filter->InitNode();
    for (auto &range : fBookedRanges)
@@ -777,6 +937,8 @@ void RLoopManager::CleanUpTask(TTreeReader *r, unsigned int slot)
       for (auto &v : fDatasetColumnReaders[slot])
          v.second.reset();
    }
+   if (fLoopBulkSize > 1)
+      fBulks[slot].fReaders.clear();
 }
 
 /// Add RDF nodes that require just-in-time compilation to the computation graph.
@@ -815,6 +977,33 @@ void RLoopManager::EvalChildrenCounts()
       namedFilterPtr->TriggerChildrenCount();
 }
 
+/// Find out which defines are read in the next event loop, i.e. the defines read by booked actions, by active filters
+/// and by variations, directly or through other defines. The others are not initialized for the tasks of the event
+/// loop. Varied defines are only created when a varied node reads them, so they are always considered used.
+/// Must be called after EvalChildrenCounts.
+void RLoopManager::SetUsedDefines()
+{
+   for (auto *define : fBookedDefines)
+      define->ResetUsed();
+   for (auto *define : fBookedDefines) {
+      if (define->GetVariation() != "nominal")
+         define->SetUsed();
+   }
+   for (auto *action : fBookedActions)
+      action->GetColRegister().SetDefinesUsed(action->GetColumnNames());
+   for (auto *filter : fBookedFilters) {
+      if (filter->IsActive())
+         filter->GetColRegister().SetDefinesUsed(filter->GetColumnNames());
+   }
+   for (auto *variation : fBookedVariations)
+      variation->GetColumnRegister().SetDefinesUsed(variation->GetInputColumns());
+
+   const auto nUnused =
+      std::count_if(fBookedDefines.begin(), fBookedDefines.end(), [](RDefineBase *d) { return !d->IsUsed(); });
+   if (nUnused > 0)
+      R__LOG_DEBUG(0, RDFLogChannel()) << "Skipping the initialization of " << nUnused << " unused Define(s).";
+}
+
 /// Start the event loop with a different mechanism depending on IMT/no IMT, data source/no data source.
 /// Also perform a few setup and clean-up operations (jit actions if necessary, clear booked actions after the loop...).
 /// The jitting phase is skipped if the `jit` parameter is `false` (unsafe, use with care).
@@ -830,6 +1019,7 @@ void RLoopManager::Run(bool jit)
    if (jit)
       Jit();
 
+   SetupBulk();
    InitNodes();
 
    TStopwatch s;
@@ -1056,6 +1246,15 @@ RColumnReaderBase *RLoopManager::AddTreeColumnReader(unsigned int slot, const st
    return rptr;
 }
 
+/// Register a dataset column reader for bulk mode: the event loop stages the values of the column for each entry.
+RColumnReaderBase *RLoopManager::AddTreeColumnReader(unsigned int slot, const std::string &col,
+                                                     std::unique_ptr<RBulkColumnReaderBase> &&reader,
+                                                     const std::type_info &ti)
+{
+   fBulks[slot].fReaders.push_back(reader.get());
+   return AddTreeColumnReader(slot, col, std::unique_ptr<RColumnReaderBase>(std::move(reader)), ti);
+}
+
 RColumnReaderBase *
 RLoopManager::GetDatasetColumnReader(unsigned int slot, const std::string &col, const std::type_info &ti) const
 {
@@ -1072,3 +1271,35 @@ void RLoopManager::AddSampleCallback(void *nodePtr, SampleCallback_t &&callback)
    if (callback)
       fSampleCallbacks.insert({nodePtr, std::move(callback)});
 }
+
+/// Return the jitted Define booked with the given key, or nullptr if there is none (anymore).
+std::shared_ptr<RJittedDefine> RLoopManager::GetJittedDefine(const std::string &key) const
+{
+   const auto it = fJittedDefines.find(key);
+   return it == fJittedDefines.end() ? nullptr : it->second.lock();
+}
+
+void RLoopManager::AddJittedDefine(const std::string &key, const std::shared_ptr<RJittedDefine> &define)
+{
+   fJittedDefines[key] = define;
+}
+
+/// Return the jitted Filter booked with the given key, or nullptr if there is none (anymore).
+std::shared_ptr<RJittedFilter> RLoopManager::GetJittedFilter(const std::string &key) const
+{
+   const auto it = fJittedFilters.find(key);
+   return it == fJittedFilters.end() ? nullptr : it->second.lock();
+}
+
+void RLoopManager::AddJittedFilter(const std::string &key, const std::shared_ptr<RJittedFilter> &filter)
+{
+   fJittedFilters[key] = filter;
+}
+
+/// Set the number of entries that the next event loops process together. A value of 1 disables bulk mode.
+void RLoopManager::SetBulkSize(std::size_t bulkSize)
+{
+   if (bulkSize == 0)
+      throw std::invalid_argument("RDataFrame: the bulk size must be larger than zero.");
+   fBulkSize = bulkSize;
+}
@@ -26,6 +26,7 @@
 
 #include <TError.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <typeinfo>
@@ -74,11 +75,17 @@ public:
    // Field is only used for reading
    void GenerateColumnsImpl() final { assert(false && "Cardinality fields must only be used for reading"); }
 
-   void GenerateColumnsImpl(const RNTupleDescriptor &) final
+   void GenerateColumnsImpl(const RNTupleDescriptor &desc) final
    {
-      RColumnModel model(EColumnType::kIndex, true /* isSorted*/);
-      fColumns.emplace_back(std::unique_ptr<ROOT::Experimental::Detail::RColumn>(
-         ROOT::Experimental::Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(model, 0)));
+      auto type = EnsureColumnType({EColumnType::kSplitIndex32, EColumnType::kIndex}, 0, desc);
+      RColumnModel model(type, true /* isSorted*/);
+      if (type == EColumnType::kSplitIndex32) {
+         fColumns.emplace_back(std::unique_ptr<ROOT::Experimental::Detail::RColumn>(
+            ROOT::Experimental::Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex32>(model, 0)));
+      } else {
+         fColumns.emplace_back(std::unique_ptr<ROOT::Experimental::Detail::RColumn>(
+            ROOT::Experimental::Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(model, 0)));
+      }
       fPrincipalColumn = fColumns[0].get();
    }
 
@@ -122,10 +129,18 @@ class RNTupleColumnReader : public ROOT::Detail::RDF::RColumnReaderBase {
    std::unique_ptr<RFieldBase> fField; ///< The field backing the RDF column
    RFieldValue fValue;                 ///< The memory location used to read from fField
    Long64_t fLastEntry;                ///< Last entry number that was read
+   /// For simple fields, the values are served directly from the page buffer of the field's column.  The range
+   /// [fMappedFirst, fMappedEnd) is the entry range of the currently mapped page, starting at fMappedValues.
+   bool fIsSimple;
+   Long64_t fMappedFirst = 0;
+   Long64_t fMappedEnd = 0;
+   unsigned char *fMappedValues = nullptr;
+   std::size_t fValueSize;
 
 public:
    RNTupleColumnReader(std::unique_ptr<RFieldBase> f)
-      : fField(std::move(f)), fValue(fField->GenerateValue()), fLastEntry(-1)
+      : fField(std::move(f)), fValue(fField->GenerateValue()), fLastEntry(-1), fIsSimple(fField->IsSimple()),
+        fValueSize(fField->GetValueSize())
    {
    }
    ~RNTupleColumnReader() { fField->DestroyValue(fValue); }
@@ -136,6 +151,18 @@ public:
       return std::make_unique<RNTupleColumnReader>(fField->Clone(fField->GetName()));
    }
 
+   /// Replaces the field backing the column by the field of the given reader, which must provide the same type.
+   /// Used for readers that were handed out before the on-disk field IDs were known.
+   void ResetField(const RNTupleColumnReader &prototype)
+   {
+      fField->DestroyValue(fValue);
+      fField = prototype.fField->Clone(prototype.fField->GetName());
+      fValue = fField->GenerateValue();
+      fLastEntry = -1;
+      fMappedFirst = fMappedEnd = 0;
+      fMappedValues = nullptr;
+   }
+
    /// Connect the field and its subfields to the page source
    void Connect(RPageSource &source)
    {
@@ -146,6 +173,16 @@ public:
 
    void *GetImpl(Long64_t entry) final
    {
+      if (fIsSimple) {
+         if (R__unlikely(entry < fMappedFirst || entry >= fMappedEnd)) {
+            ROOT::Experimental::NTupleSize_t nItems;
+            fMappedValues = static_cast<unsigned char *>(fField->MapRawV(entry, nItems));
+            fMappedFirst = entry;
+            fMappedEnd = entry + nItems;
+         }
+         return fMappedValues + (entry - fMappedFirst) * fValueSize;
+      }
+
       if (entry != fLastEntry) {
          fField->Read(entry, &fValue);
          fLastEntry = entry;
@@ -278,6 +315,40 @@ RNTupleDS::RNTupleDS(std::unique_ptr<Detail::RPageSource> pageSource)
    AddField(descriptorGuard.GetRef(), "", descriptorGuard->GetFieldZeroId(), std::vector<DescriptorId_t>());
 }
 
+RNTupleDS::RNTupleDS(std::unique_ptr<Detail::RPageSource> pageSource, const RNTupleDescriptor &schema)
+   : fIsDeferred(true)
+{
+   fSources.emplace_back(std::move(pageSource));
+   AddField(schema, "", schema.GetFieldZeroId(), std::vector<DescriptorId_t>());
+}
+
+void RNTupleDS::AttachDeferred()
+{
+   for (auto &source : fSources)
+      source->Attach();
+
+   // The field IDs of the schema need not match the ones on disk, so the prototypes are recreated from the actual
+   // descriptor.  The columns, however, must be the ones already announced to RDataFrame.
+   auto expectedNames = std::move(fColumnNames);
+   auto expectedTypes = std::move(fColumnTypes);
+   fColumnNames.clear();
+   fColumnTypes.clear();
+   fColumnReaderPrototypes.clear();
+   {
+      auto descriptorGuard = fSources[0]->GetSharedDescriptorGuard();
+      AddField(descriptorGuard.GetRef(), "", descriptorGuard->GetFieldZeroId(), std::vector<DescriptorId_t>());
+   }
+   if (fColumnNames != expectedNames || fColumnTypes != expectedTypes)
+      throw RException(R__FAIL("RNTuple '" + fSources[0]->GetNTupleName() + "' does not match the expected schema"));
+
+   for (const auto &deferred : fDeferredReaders) {
+      deferred.fReader->ResetField(*fColumnReaderPrototypes[deferred.fColumnIndex]);
+      deferred.fReader->Connect(*fSources[deferred.fSlot]);
+   }
+   fDeferredReaders.clear();
+   fIsDeferred = false;
+}
+
 RDF::RDataSource::Record_t RNTupleDS::GetColumnReadersImpl(std::string_view /* name */, const std::type_info & /* ti */)
 {
    // This datasource uses the GetColumnReaders2 API instead (better name in the works)
@@ -291,7 +362,10 @@ RNTupleDS::GetColumnReaders(unsigned int slot, std::string_view name, const std:
    // TODO(jblomer): check incoming type
    const auto index = std::distance(fColumnNames.begin(), std::find(fColumnNames.begin(), fColumnNames.end(), name));
    auto clone = fColumnReaderPrototypes[index]->Clone();
-   clone->Connect(*fSources[slot]);
+   if (fIsDeferred)
+      fDeferredReaders.push_back({slot, static_cast<std::size_t>(index), clone.get()});
+   else
+      clone->Connect(*fSources[slot]);
    return clone;
 }
 
@@ -300,6 +374,14 @@ bool RNTupleDS::SetEntry(unsigned int, ULong64_t)
    return true;
 }
 
+void RNTupleDS::AddValueRangeFilter(std::string_view fieldName, double min, double max)
+{
+   auto fieldId = fSources[0]->GetSharedDescriptorGuard()->FindFieldId(fieldName);
+   if (fieldId == kInvalidDescriptorId)
+      throw RException(R__FAIL("no field named '" + std::string(fieldName) + "' in RNTuple"));
+   fValueRangeFilters.push_back({fieldId, min, max});
+}
+
 std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
 {
    // TODO(jblomer): use cluster boundaries for the entry ranges
@@ -307,6 +389,32 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
    if (fHasSeenAllRanges)
       return ranges;
 
+   if (!fValueRangeFilters.empty()) {
+      // One range per selected cluster, so that the clusters can be processed in parallel
+      auto descriptorGuard = fSources[0]->GetSharedDescriptorGuard();
+      std::vector<DescriptorId_t> clusterIds;
+      for (const auto &filter : fValueRangeFilters) {
+         auto selected = descriptorGuard->FindClusterIdsInValueRange(filter.fFieldId, filter.fMin, filter.fMax);
+         if (&filter == &fValueRangeFilters[0]) {
+            clusterIds = std::move(selected);
+            continue;
+         }
+         std::sort(selected.begin(), selected.end());
+         clusterIds.erase(std::remove_if(clusterIds.begin(), clusterIds.end(),
+                                         [&selected](DescriptorId_t id) {
+                                            return !std::binary_search(selected.begin(), selected.end(), id);
+                                         }),
+                          clusterIds.end());
+      }
+      for (auto clusterId : clusterIds) {
+         const auto &clusterDesc = descriptorGuard->GetClusterDescriptor(clusterId);
+         ranges.emplace_back(clusterDesc.GetFirstEntryIndex(),
+                             clusterDesc.GetFirstEntryIndex() + clusterDesc.GetNEntries());
+      }
+      fHasSeenAllRanges = true;
+      return ranges;
+   }
+
    auto nEntries = fSources[0]->GetNEntries();
    const auto chunkSize = nEntries / fNSlots;
    const auto reminder = 1U == fNSlots ? 0 : nEntries % fNSlots;
@@ -337,6 +445,8 @@ bool RNTupleDS::HasColumn(std::string_view colName) const
 void RNTupleDS::Initialize()
 {
    fHasSeenAllRanges = false;
+   if (fIsDeferred)
+      AttachDeferred();
 }
 
 void RNTupleDS::Finalize() {}
@@ -350,7 +460,8 @@ void RNTupleDS::SetNSlots(unsigned int nSlots)
    for (unsigned int i = 1; i < fNSlots; ++i) {
       fSources.emplace_back(fSources[0]->Clone());
       assert(i == (fSources.size() - 1));
-      fSources[i]->Attach();
+      if (!fIsDeferred)
+         fSources[i]->Attach();
    }
 }
 } // namespace Experimental
@@ -22,6 +22,7 @@ RRangeBase::RRangeBase(RLoopManager *implPtr, unsigned int start, unsigned int s
 void RRangeBase::ResetCounters()
 {
    fLastCheckedEntry = -1;
+   fBulkMask.SetFirstEntry(-1);
    fNProcessedEntries = 0;
    fHasStopped = false;
 }
@@ -0,0 +1,123 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RStealableRanges.hxx"
+
+#include <algorithm>
+
+using ROOT::Internal::RDF::RStealableRanges;
+
+namespace {
+/// Number of entries the owner of a range claims at once. Claiming more entries at once reduces the synchronization
+/// overhead, claiming fewer lets other tasks steal more precisely.
+constexpr Long64_t kClaimEntries = 64;
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Claim the next entries of the range, unless they have been stolen in the meantime.
+bool RStealableRanges::RRange::ClaimSlow(Long64_t entry)
+{
+   std::lock_guard<ROOT::TSpinMutex> lock(fMutex);
+   if (entry >= fEnd)
+      return false;
+   fClaimedEnd = std::min(entry + kClaimEntries, fEnd);
+   fOwnerClaimedEnd = fClaimedEnd;
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the current end of the range, which might be reduced by other tasks at any time.
+Long64_t RStealableRanges::RRange::GetEnd()
+{
+   std::lock_guard<ROOT::TSpinMutex> lock(fMutex);
+   return fEnd;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \param[in] nSlots The number of processing slots of the event loop.
+/// \param[in] nEntries The total number of entries processed by the event loop, or 0 if it is not known upfront.
+/// \param[in] minStealEntries Minimum number of entries that are worth taking over from another task.
+RStealableRanges::RStealableRanges(unsigned int nSlots, ULong64_t nEntries, Long64_t minStealEntries)
+   : fNSlots(nSlots), fNEntries(nEntries), fMinStealEntries(std::max(minStealEntries, 1ll))
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if all entries have been handed out to tasks, so that no new task will start.
+/// If the total number of entries is not known, the event loop is considered to be in its tail as soon as fewer
+/// tasks than processing slots are running: with queued tasks, a worker that is done immediately picks a new one.
+/// Must be called with fMutex locked.
+bool RStealableRanges::IsInTail() const
+{
+   if (fNEntries > 0)
+      return fNStartedEntries >= fNEntries;
+   return fRanges.size() < fNSlots;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Register the range of a task that starts processing entries [begin, end).
+/// \param[in] firstCount The value of the entry counter of the task for entry begin.
+/// \param[in] domain Tasks only steal from tasks with the same domain, i.e. that use the same entry numbers.
+RStealableRanges::RRange &
+RStealableRanges::Add(Long64_t begin, Long64_t end, ULong64_t firstCount, const std::string &domain)
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   fNStartedEntries += end - begin;
+   fRanges.emplace_back(begin, end, firstCount, domain);
+   return fRanges.back();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Unregister the range of a task that is done.
+void RStealableRanges::Remove(RRange &range)
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   fRanges.remove_if([&range](const RRange &r) { return &r == &range; });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Make the task that owns the thief range, which must be done with it, take over the second half of the unclaimed
+/// entries of the range with the most unclaimed entries. The thief range is updated with the stolen entries.
+/// \return False if the event loop is not in its tail yet, or if there is nothing worth stealing.
+bool RStealableRanges::Steal(RRange &thief)
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   if (!IsInTail())
+      return false;
+
+   RRange *victim = nullptr;
+   Long64_t maxUnclaimed = 0;
+   for (auto &range : fRanges) {
+      if (&range == &thief || range.fDomain != thief.fDomain)
+         continue;
+      std::lock_guard<ROOT::TSpinMutex> rangeLock(range.fMutex);
+      const auto unclaimed = range.fEnd - range.fClaimedEnd;
+      if (unclaimed > maxUnclaimed) {
+         maxUnclaimed = unclaimed;
+         victim = &range;
+      }
+   }
+   if (victim == nullptr)
+      return false;
+
+   // the steals are serialized by fMutex, and only the owner of the thief range changes it otherwise
+   std::lock_guard<ROOT::TSpinMutex> victimLock(victim->fMutex);
+   std::lock_guard<ROOT::TSpinMutex> thiefLock(thief.fMutex);
+   // the owner of the victim range might have claimed more entries in the meantime
+   const auto unclaimed = victim->fEnd - victim->fClaimedEnd;
+   if (unclaimed < 2 * fMinStealEntries)
+      return false;
+   const auto stolenBegin = victim->fEnd - unclaimed / 2;
+   thief.fBegin = stolenBegin;
+   thief.fEnd = victim->fEnd;
+   thief.fClaimedEnd = stolenBegin;
+   thief.fOwnerClaimedEnd = stolenBegin;
+   thief.fFirstCount = victim->fFirstCount + (stolenBegin - victim->fBegin);
+   victim->fEnd = stolenBegin;
+   return true;
+}
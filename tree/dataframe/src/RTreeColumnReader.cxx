@@ -0,0 +1,92 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RDF/RTreeColumnReader.hxx>
+
+#include <TBranch.h>
+#include <TClass.h>
+#include <TDataType.h>
+#include <TLeaf.h>
+#include <TMath.h>
+#include <TTree.h>
+
+#include <cstdint> // std::uintptr_t
+#include <cstring> // std::memcpy
+
+using ROOT::Internal::RDF::RTreeBulkBasketReader;
+
+RTreeBulkBasketReader::RTreeBulkBasketReader(TTreeReader &r, const std::string &branchName,
+                                             const std::type_info &type, bool isArray)
+   : fTreeReader(&r), fBranchName(branchName), fType(TDataType::GetType(type)), fElementSize(0), fIsArray(isArray)
+{
+   if (auto dataType = TDataType::GetDataType(fType))
+      fElementSize = dataType->Size();
+   fUseFallback = fElementSize <= 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Look up the branch in the tree the TTreeReader just switched to and check whether it can be read in bulk.
+/// Only plain branches holding a single leaf of exactly the requested type, without a leaf count, are read in bulk.
+/// Friend trees are excluded because their entry numbers are not necessarily the ones of the main tree.
+bool RTreeBulkBasketReader::SetTree(TTree *tree, Int_t treeNumber)
+{
+   fTree = tree;
+   fTreeNumber = treeNumber;
+   fFirstEntry = -1;
+   fNEntries = 0;
+   fBranch = tree ? tree->GetBranch(fBranchName.c_str()) : nullptr;
+
+   bool canReadBulk = fBranch && fBranch->IsA() == TBranch::Class() && fBranch->GetTree() == tree &&
+                      fBranch->GetBulkRead().SupportsBulkRead();
+   if (canReadBulk) {
+      auto leaf = static_cast<TLeaf *>(fBranch->GetListOfLeaves()->UncheckedAt(0));
+      TClass *expectedClass = nullptr;
+      EDataType expectedType = kOther_t;
+      fLen = leaf->GetLenStatic();
+      canReadBulk = !leaf->GetLeafCount() && (fIsArray ? fLen > 1 : fLen == 1) &&
+                    fBranch->GetExpectedType(expectedClass, expectedType) == 0 && !expectedClass &&
+                    expectedType == fType;
+   }
+   if (!canReadBulk) {
+      fBranch = nullptr;
+      fUseFallback = true;
+   }
+   return canReadBulk;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Decode the basket of the current branch that contains the given entry.
+/// In case of failure, switch permanently to the fallback reader.
+/// Values that are not aligned in the basket buffer are copied once per basket into an aligned buffer: clients access
+/// them through typed references and RVecs.
+bool RTreeBulkBasketReader::LoadBasket(Long64_t entry)
+{
+   Int_t nEntries = -1;
+   if (entry >= 0) {
+      const auto basketIdx = TMath::BinarySearch(fBranch->GetWriteBasket() + 1, fBranch->GetBasketEntry(), entry);
+      if (basketIdx >= 0) {
+         fFirstEntry = fBranch->GetBasketEntry()[basketIdx];
+         nEntries = fBranch->GetBulkRead().GetBulkEntries(fFirstEntry, fBuffer);
+      }
+   }
+   if (nEntries <= 0 || entry >= fFirstEntry + nEntries) {
+      fUseFallback = true;
+      fNEntries = 0;
+      return false;
+   }
+   fNEntries = nEntries;
+   fValues = fBuffer.GetCurrent();
+   // fundamental types are aligned to (at most) their size
+   if (reinterpret_cast<std::uintptr_t>(fValues) % fElementSize != 0) {
+      const std::size_t nBytes = std::size_t(nEntries) * fLen * fElementSize;
+      fAlignedValues.resize((nBytes + sizeof(Long64_t) - 1) / sizeof(Long64_t));
+      std::memcpy(fAlignedValues.data(), fValues, nBytes);
+      fValues = reinterpret_cast<char *>(fAlignedValues.data());
+   }
+   return true;
+}
@@ -0,0 +1,289 @@
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx"
+#include "ROOT/RVec.hxx"
+#include "TChain.h"
+#include "TFile.h"
+#include "TROOT.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using ROOT::RDF::RNode;
+using ROOT::RDF::Experimental::SetBulkSize;
+
+// Sums the values of a column, recording how many bulks it received.
+class BulkSumHelper : public ROOT::Detail::RDF::RActionImpl<BulkSumHelper> {
+   std::shared_ptr<double> fResult = std::make_shared<double>(0.);
+   std::vector<double> fSums;
+   std::shared_ptr<int> fNBulks;
+
+public:
+   using Result_t = double;
+   BulkSumHelper(unsigned int nSlots, std::shared_ptr<int> nBulks) : fSums(nSlots, 0.), fNBulks(std::move(nBulks)) {}
+   BulkSumHelper(BulkSumHelper &&) = default;
+   std::shared_ptr<double> GetResultPtr() const { return fResult; }
+   void Initialize() {}
+   void InitTask(TTreeReader *, unsigned int) {}
+   void Exec(unsigned int slot, double x) { fSums[slot] += x; }
+   void ExecBulk(unsigned int slot, const ROOT::Internal::RDF::RMaskedEntryRange &mask, std::size_t bulkSize,
+                 double *xs)
+   {
+      ++*fNBulks;
+      for (std::size_t i = 0u; i < bulkSize; ++i)
+         if (mask[i])
+            fSums[slot] += xs[i];
+   }
+   void Finalize()
+   {
+      for (auto s : fSums)
+         *fResult += s;
+   }
+   std::string GetActionName() { return "BulkSum"; }
+};
+
+struct RDFBulkModeResults {
+   ULong64_t fCount;
+   double fSum;
+   std::vector<double> fValues;
+   std::vector<ULong64_t> fEntries;
+   std::vector<int> fPerSample;
+   ULong64_t fRangeCount;
+   ULong64_t fPassedY;
+};
+
+RDFBulkModeResults RunBulkModeGraph(RNode df, std::size_t bulkSize)
+{
+   SetBulkSize(df, bulkSize);
+   auto withX = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+   auto filtered = withX.Filter([](double x) { return int(x) % 3 != 0; }, {"x"}, "notMultipleOf3")
+                      .Define("y", [](unsigned int, ULong64_t e, double x) { return x * 2. + double(e % 2); },
+                              {"rdfslot_", "rdfentry_", "x"})
+                      .Filter("y > 10", "yAbove10");
+   auto count = filtered.Count();
+   auto sum = filtered.Sum<double>("y");
+   auto values = filtered.Take<double>("y");
+   auto entries = filtered.Take<ULong64_t>("rdfentry_");
+   auto perSample = filtered.DefinePerSample("s", [](unsigned int, const ROOT::RDF::RSampleInfo &) { return 42; })
+                       .Take<int>("s");
+   auto report = filtered.Report();
+   RDFBulkModeResults res{*count, *sum, *values, *entries, *perSample, 0ull, 0ull};
+   if (!ROOT::IsImplicitMTEnabled())
+      res.fRangeCount = *withX.Range(5, 50, 3).Filter("x > 20").Count();
+   res.fPassedY = report->At("yAbove10").GetPass();
+   return res;
+}
+
+void CheckSameResults(const RDFBulkModeResults &expected, const RDFBulkModeResults &actual)
+{
+   EXPECT_EQ(expected.fCount, actual.fCount);
+   EXPECT_DOUBLE_EQ(expected.fSum, actual.fSum);
+   auto sortedValues = [](std::vector<double> v) {
+      std::sort(v.begin(), v.end());
+      return v;
+   };
+   auto sortedEntries = [](std::vector<ULong64_t> v) {
+      std::sort(v.begin(), v.end());
+      return v;
+   };
+   EXPECT_EQ(sortedValues(expected.fValues), sortedValues(actual.fValues));
+   EXPECT_EQ(sortedEntries(expected.fEntries), sortedEntries(actual.fEntries));
+   EXPECT_EQ(expected.fPerSample, actual.fPerSample);
+   EXPECT_EQ(expected.fRangeCount, actual.fRangeCount);
+   EXPECT_EQ(expected.fPassedY, actual.fPassedY);
+}
+
+void MakeBulkModeFile(const std::string &filename, int nEntries, int valueStart)
+{
+   TFile f(filename.c_str(), "RECREATE");
+   TTree t("t", "t");
+   double v;
+   int arr[2];
+   t.Branch("v", &v, "v/D", 1000);
+   t.Branch("arr", arr, "arr[2]/I", 1000);
+   for (int i = valueStart; i < valueStart + nEntries; ++i) {
+      v = i;
+      arr[0] = i;
+      arr[1] = -i;
+      t.Fill();
+   }
+   t.Write();
+}
+
+TEST(RDFBulkMode, EmptySource)
+{
+   const auto expected = RunBulkModeGraph(ROOT::RDataFrame(1000), 1);
+   EXPECT_EQ(expected.fCount, 663ull);
+   for (std::size_t bulkSize : {2u, 7u, 64u, 5000u})
+      CheckSameResults(expected, RunBulkModeGraph(ROOT::RDataFrame(1000), bulkSize));
+}
+
+TEST(RDFBulkMode, MultipleRuns)
+{
+   ROOT::RDataFrame df(100);
+   SetBulkSize(df, 16);
+   auto f = df.Define("x", [](ULong64_t e) { return e; }, {"rdfentry_"}).Filter([](ULong64_t x) { return x < 42; },
+                                                                               {"x"});
+   EXPECT_EQ(*f.Count(), 42ull);
+   EXPECT_EQ(*f.Sum<ULong64_t>("x"), 41ull * 42ull / 2ull);
+   SetBulkSize(df, 1);
+   EXPECT_EQ(*f.Count(), 42ull);
+   EXPECT_THROW(SetBulkSize(df, 0), std::invalid_argument);
+}
+
+TEST(RDFBulkMode, ExecBulk)
+{
+   ROOT::RDataFrame df(100);
+   SetBulkSize(df, 10);
+   auto nBulks = std::make_shared<int>(0);
+   auto sum = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                 .Filter([](double x) { return x >= 50; }, {"x"})
+                 .Book<double>(BulkSumHelper(df.GetNSlots(), nBulks), {"x"});
+   EXPECT_DOUBLE_EQ(*sum, 3725.);
+   EXPECT_EQ(*nBulks, 10);
+
+   // without bulk mode, the helper is called entry by entry
+   SetBulkSize(df, 1);
+   *nBulks = 0;
+   auto sum2 = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                  .Book<double>(BulkSumHelper(df.GetNSlots(), nBulks), {"x"});
+   EXPECT_DOUBLE_EQ(*sum2, 4950.);
+   EXPECT_EQ(*nBulks, 0);
+}
+
+TEST(RDFBulkMode, TreeAndChain)
+{
+   const std::vector<std::string> fileNames{"dataframe_bulkmode_0.root", "dataframe_bulkmode_1.root"};
+   MakeBulkModeFile(fileNames[0], 333, 0);
+   MakeBulkModeFile(fileNames[1], 222, 333);
+
+   TChain c("t");
+   for (const auto &fname : fileNames)
+      c.Add(fname.c_str());
+
+   auto runGraph = [](RNode df, std::size_t bulkSize) {
+      SetBulkSize(df, bulkSize);
+      auto f = df.Filter([](double v, const ROOT::RVecI &a) { return int(v) % 2 == 0 && a[1] == -a[0]; },
+                         {"v", "arr"})
+                  .Define("w", [](double v, const ROOT::RVecI &a) { return v + a[0]; }, {"v", "arr"});
+      auto files = f.DefinePerSample("file", [](unsigned int, const ROOT::RDF::RSampleInfo &id) {
+                       return id.Contains("dataframe_bulkmode_1.root") ? 1 : 0;
+                    }).Take<int>("file");
+      auto ws = f.Take<double>("w");
+      auto vs = f.Take<double>("v");
+      return std::make_tuple(*ws, *vs, *files);
+   };
+
+   const auto expected = runGraph(ROOT::RDataFrame(c), 1);
+   EXPECT_EQ(std::get<0>(expected).size(), 278u);
+   for (std::size_t bulkSize : {3u, 100u}) {
+      const auto tree = runGraph(ROOT::RDataFrame(c), bulkSize);
+      EXPECT_EQ(expected, tree);
+   }
+
+   TFile f(fileNames[0].c_str());
+   auto t = f.Get<TTree>("t");
+   ROOT::RDataFrame df(*t);
+   SetBulkSize(df, 64);
+   EXPECT_DOUBLE_EQ(*df.Sum<double>("v"), 332. * 333. / 2.);
+
+   for (const auto &fname : fileNames)
+      gSystem->Unlink(fname.c_str());
+}
+
+// Sum, Mean and the histogram-filling actions process whole bulks, reading the values of "v" directly from its
+// baskets: bulks that cross basket boundaries must give the same results as the entry-wise event loop
+TEST(RDFBulkMode, BuiltinActions)
+{
+   const std::string fname = "dataframe_bulkmode_actions.root";
+   MakeBulkModeFile(fname, 1000, 0);
+
+   auto runGraph = [&fname](std::size_t bulkSize) {
+      ROOT::RDataFrame df("t", fname);
+      SetBulkSize(df, bulkSize);
+      auto f = df.Filter([](double v) { return int(v) % 3 != 0; }, {"v"}).Define("w", "v / 10.");
+      auto sum = f.Sum<double>("v");
+      auto mean = f.Mean<double>("v");
+      auto h = f.Histo1D<double>({"h", "h", 100, 0., 1000.}, "v");
+      auto hw = f.Histo1D<double, double>({"hw", "hw", 100, 0., 1000.}, "v", "w");
+      auto hb = f.Histo1D<double>("v");
+      return std::make_tuple(*sum, *mean, h->GetEntries(), h->GetMean(), hw->GetSumOfWeights(), hw->GetMean(),
+                             hb->GetEntries(), hb->GetMean());
+   };
+
+   const auto expected = runGraph(1);
+   EXPECT_DOUBLE_EQ(std::get<0>(expected), 999. * 1000. / 2. - 3. * 333. * 334. / 2.);
+   EXPECT_EQ(std::get<2>(expected), 666.);
+   for (std::size_t bulkSize : {7u, 100u, 2000u})
+      EXPECT_EQ(expected, runGraph(bulkSize));
+
+   gSystem->Unlink(fname.c_str());
+}
+
+// The second column of a profile is the profiled value, not a weight: profiles must not take the TH1::FillN path
+TEST(RDFBulkMode, Profile1D)
+{
+   const std::string fname = "dataframe_bulkmode_profile.root";
+   MakeBulkModeFile(fname, 1000, 0);
+
+   auto runGraph = [&fname](std::size_t bulkSize) {
+      ROOT::RDataFrame df("t", fname);
+      SetBulkSize(df, bulkSize);
+      auto f = df.Filter([](double v) { return int(v) % 3 != 0; }, {"v"}).Define("y", "v / 10.");
+      auto p = f.Profile1D<double, double>({"p", "p", 100, 0., 1000.}, "v", "y");
+      return std::make_tuple(p->GetEntries(), p->GetMean(), p->GetMean(2), p->GetBinContent(50));
+   };
+
+   const auto expected = runGraph(1);
+   EXPECT_EQ(std::get<0>(expected), 666.);
+   for (std::size_t bulkSize : {7u, 100u, 2000u})
+      EXPECT_EQ(expected, runGraph(bulkSize));
+
+   gSystem->Unlink(fname.c_str());
+}
+
+TEST(RDFBulkMode, SnapshotRunsEntryByEntry)
+{
+   const std::string fname = "dataframe_bulkmode_snapshot.root";
+   ROOT::RDataFrame df(50);
+   SetBulkSize(df, 8);
+   auto out = df.Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"}).Snapshot<int>("t", fname, {"x"});
+   auto xs = out->Take<int>("x");
+   ASSERT_EQ(xs->size(), 50u);
+   for (int i = 0; i < 50; ++i)
+      EXPECT_EQ((*xs)[i], i);
+   gSystem->Unlink(fname.c_str());
+}
+
+#ifdef R__USE_IMT
+TEST(RDFBulkMode, EmptySourceMT)
+{
+   ROOT::EnableImplicitMT(4);
+   const auto expected = RunBulkModeGraph(ROOT::RDataFrame(10000), 1);
+   for (std::size_t bulkSize : {7u, 128u})
+      CheckSameResults(expected, RunBulkModeGraph(ROOT::RDataFrame(10000), bulkSize));
+   ROOT::DisableImplicitMT();
+}
+
+TEST(RDFBulkMode, TreeMT)
+{
+   const std::string fname = "dataframe_bulkmode_mt.root";
+   MakeBulkModeFile(fname, 5000, 0);
+   ROOT::EnableImplicitMT(4);
+   {
+      ROOT::RDataFrame df("t", fname);
+      SetBulkSize(df, 32);
+      auto f = df.Filter([](double v) { return v > 100; }, {"v"});
+      EXPECT_EQ(*f.Count(), 4899ull);
+      EXPECT_DOUBLE_EQ(*f.Sum<double>("v"), 4999. * 5000. / 2. - 100. * 101. / 2.);
+   }
+   ROOT::DisableImplicitMT();
+   gSystem->Unlink(fname.c_str());
+}
+#endif
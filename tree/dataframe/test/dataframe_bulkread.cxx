@@ -0,0 +1,153 @@
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDF/RTreeColumnReader.hxx"
+#include "ROOT/RVec.hxx"
+#include "TChain.h"
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeReader.h"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using ROOT::RVecD;
+using ROOT::RVecF;
+using ROOT::Internal::RDF::RTreeBulkColumnReader;
+
+// Write a tree "t" with a scalar, a fixed-size array, a variable-size array and a leaf list branch, with baskets
+// small enough to span many of them.
+void MakeBulkReadFile(const std::string &filename, int nEntries, int valueStart = 0)
+{
+   TFile f(filename.c_str(), "RECREATE");
+   TTree t("t", "t");
+   float x;
+   double arr[3];
+   int n;
+   float jagged[5];
+   struct {
+      int a;
+      int b;
+   } ab;
+   t.Branch("x", &x, "x/F", 1000);
+   t.Branch("arr", arr, "arr[3]/D", 1000);
+   t.Branch("n", &n, "n/I", 1000);
+   t.Branch("jagged", jagged, "jagged[n]/F", 1000);
+   t.Branch("ab", &ab, "a/I:b/I", 1000);
+   for (int i = valueStart; i < valueStart + nEntries; ++i) {
+      x = i;
+      for (int j = 0; j < 3; ++j)
+         arr[j] = i * 10 + j;
+      n = i % 5;
+      for (int j = 0; j < n; ++j)
+         jagged[j] = i + j;
+      ab.a = i;
+      ab.b = -i;
+      t.Fill();
+   }
+   t.Write();
+}
+
+void CheckBulkReadValues(ROOT::RDataFrame &df, int nEntries, int valueStart = 0)
+{
+   auto xs = df.Take<float>("x");
+   auto arrs = df.Take<RVecD>("arr");
+   auto jaggeds = df.Take<RVecF>("jagged");
+   auto as = df.Take<int>("ab.a");
+   ASSERT_EQ(static_cast<std::size_t>(nEntries), xs->size());
+   for (int i = 0; i < nEntries; ++i) {
+      const int v = valueStart + i;
+      EXPECT_FLOAT_EQ(v, (*xs)[i]);
+      ASSERT_EQ(3u, (*arrs)[i].size());
+      for (int j = 0; j < 3; ++j)
+         EXPECT_DOUBLE_EQ(v * 10 + j, (*arrs)[i][j]);
+      ASSERT_EQ(static_cast<std::size_t>(v % 5), (*jaggeds)[i].size());
+      for (int j = 0; j < v % 5; ++j)
+         EXPECT_FLOAT_EQ(v + j, (*jaggeds)[i][j]);
+      EXPECT_EQ(v, (*as)[i]);
+   }
+}
+
+TEST(RDFBulkRead, Tree)
+{
+   const auto filename = "dataframe_bulkread_tree.root";
+   MakeBulkReadFile(filename, 5000);
+   ROOT::RDataFrame df("t", filename);
+   CheckBulkReadValues(df, 5000);
+   EXPECT_DOUBLE_EQ(4999. * 5000. / 2., *df.Sum<float>("x"));
+   gSystem->Unlink(filename);
+}
+
+TEST(RDFBulkRead, Chain)
+{
+   const auto filename1 = "dataframe_bulkread_chain1.root";
+   const auto filename2 = "dataframe_bulkread_chain2.root";
+   MakeBulkReadFile(filename1, 3000);
+   MakeBulkReadFile(filename2, 2000, 3000);
+   TChain c("t");
+   c.Add(filename1);
+   c.Add(filename2);
+   ROOT::RDataFrame df(c);
+   CheckBulkReadValues(df, 5000);
+   gSystem->Unlink(filename1);
+   gSystem->Unlink(filename2);
+}
+
+TEST(RDFBulkRead, Range)
+{
+   const auto filename = "dataframe_bulkread_range.root";
+   MakeBulkReadFile(filename, 5000);
+   ROOT::RDataFrame df("t", filename);
+   auto xs = df.Range(1234, 4321).Take<float>("x");
+   ASSERT_EQ(4321u - 1234u, xs->size());
+   for (std::size_t i = 0; i < xs->size(); ++i)
+      EXPECT_FLOAT_EQ(1234 + i, (*xs)[i]);
+   gSystem->Unlink(filename);
+}
+
+TEST(RDFBulkRead, ServesValuesFromBasket)
+{
+   const auto filename = "dataframe_bulkread_reader.root";
+   MakeBulkReadFile(filename, 100);
+   TFile f(filename);
+   std::unique_ptr<TTree> t(f.Get<TTree>("t"));
+   TTreeReader r(t.get());
+   RTreeBulkColumnReader<float> x(r, "x");
+   RTreeBulkColumnReader<RVecD> arr(r, "arr");
+   // A leaf list branch cannot be read in bulk and is served by the fallback reader
+   RTreeBulkColumnReader<int> a(r, "ab.a");
+
+   ASSERT_TRUE(r.Next());
+   const float *x0 = &x.Get<float>(0);
+   const double *arr0 = arr.Get<RVecD>(0).data();
+   EXPECT_EQ(0, a.Get<int>(0));
+   ASSERT_TRUE(r.Next());
+   // Consecutive entries of the same basket are adjacent in memory
+   EXPECT_EQ(x0 + 1, &x.Get<float>(1));
+   EXPECT_EQ(arr0 + 3, arr.Get<RVecD>(1).data());
+   EXPECT_FLOAT_EQ(1.f, x.Get<float>(1));
+   EXPECT_DOUBLE_EQ(12., arr.Get<RVecD>(1)[2]);
+   EXPECT_EQ(1, a.Get<int>(1));
+   gSystem->Unlink(filename);
+}
+
+TEST(RDFBulkRead, ValuesAreAligned)
+{
+   const auto filename = "dataframe_bulkread_aligned.root";
+   MakeBulkReadFile(filename, 1000);
+   TFile f(filename);
+   std::unique_ptr<TTree> t(f.Get<TTree>("t"));
+   TTreeReader r(t.get());
+   RTreeBulkColumnReader<float> x(r, "x");
+   RTreeBulkColumnReader<RVecD> arr(r, "arr");
+   // the values of each basket start at an arbitrary offset in the basket buffer
+   for (int i = 0; r.Next(); ++i) {
+      EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(&x.Get<float>(i)) % alignof(float));
+      EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(arr.Get<RVecD>(i).data()) % alignof(double));
+      EXPECT_FLOAT_EQ(i, x.Get<float>(i));
+      EXPECT_DOUBLE_EQ(i * 10 + 2, arr.Get<RVecD>(i)[2]);
+   }
+   gSystem->Unlink(filename);
+}
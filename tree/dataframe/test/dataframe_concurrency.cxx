@@ -1,8 +1,12 @@
 #include <ROOT/RConfig.hxx>
 #include <ROOT/RDataFrame.hxx>
 #include <ROOT/RDF/RInterface.hxx>
+#include <ROOT/RTrivialDS.hxx>
 #include <ROOT/TThreadExecutor.hxx>
+#include <TSystem.h>
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <thread>
 #include <vector>
 #include <string>
@@ -235,3 +239,61 @@ TEST(RDFConcurrency, ParallelRDFCachesEnableImplicitMT)
 }
 
 #endif
+
+#ifdef R__USE_IMT
+// The task that processes the first entry is blocked until the other tasks processed all entries but the few that
+// the blocked task already claimed or that are not worth stealing: this only happens if they take over its range.
+void CheckUnevenWorkload(ROOT::RDF::RNode df, const std::string &col, ULong64_t nEntries)
+{
+   const ULong64_t maxKept = 4096; // more than the entries claimed at once plus twice the minimum steal
+   std::atomic<ULong64_t> nProcessed{0ull};
+   std::atomic<bool> released{false};
+   auto blocking = df.Filter(
+      [&](ULong64_t x) {
+         if (x != 0) {
+            ++nProcessed;
+            return true;
+         }
+         // the deadline only turns a failure to steal into a test failure rather than a hang
+         const auto deadline = std::chrono::steady_clock::now() + std::chrono::minutes(5);
+         while (nProcessed < nEntries - maxKept && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::yield();
+         released = nProcessed >= nEntries - maxKept;
+         return true;
+      },
+      {col});
+   auto count = blocking.Count();
+   auto sum = blocking.Sum<ULong64_t>(col);
+   auto entries = blocking.Take<ULong64_t>("rdfentry_");
+   EXPECT_EQ(*count, nEntries);
+   EXPECT_TRUE(released);
+   EXPECT_EQ(*sum, nEntries * (nEntries - 1) / 2);
+   // the values of rdfentry_ are still unique
+   auto e = *entries;
+   std::sort(e.begin(), e.end());
+   EXPECT_EQ(std::unique(e.begin(), e.end()), e.end());
+}
+
+TEST(RDFConcurrency, WorkStealingTree)
+{
+   const auto fileName = "dataframe_concurrency_workstealing.root";
+   const ULong64_t nEntries = 100000ull;
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fAutoFlush = 10000; // several clusters, hence several tasks
+   ROOT::RDataFrame(nEntries)
+      .Define("x", [](ULong64_t e) { return e; }, {"rdfentry_"})
+      .Snapshot("t", fileName, {"x"}, opts);
+   ROOT::EnableImplicitMT(4);
+   CheckUnevenWorkload(ROOT::RDataFrame("t", fileName), "x", nEntries);
+   ROOT::DisableImplicitMT();
+   gSystem->Unlink(fileName);
+}
+
+TEST(RDFConcurrency, WorkStealingDataSource)
+{
+   const ULong64_t nEntries = 100000ull;
+   ROOT::EnableImplicitMT(4);
+   CheckUnevenWorkload(ROOT::RDF::MakeTrivialDataFrame(nEntries), "col0", nEntries);
+   ROOT::DisableImplicitMT();
+}
+#endif
@@ -0,0 +1,167 @@
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx"
+#include "ROOT/RDF/Utils.hxx" // RDFLogChannel
+#include "ROOT/RLogger.hxx"
+#include "TInterpreter.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+using ROOT::RDF::Experimental::VariationsFor;
+
+// RDFGraphOptCount returns its argument and counts how many times it has been called
+class RDFGraphOptimization : public ::testing::Test {
+protected:
+   static void SetUpTestCase()
+   {
+      gInterpreter->Declare("int rdfgraphoptcalls = 0;\n"
+                            "int RDFGraphOptCount(int x) { ++rdfgraphoptcalls; return x; }");
+   }
+
+   void SetUp() override { gInterpreter->ProcessLine("rdfgraphoptcalls = 0;"); }
+
+   int GetNCalls() const { return int(gInterpreter->Calc("rdfgraphoptcalls")); }
+};
+
+// Collects the debug messages of the RDataFrame log channel while in scope, instead of printing them
+class RDFLogCollector {
+   class RHandler : public ROOT::Experimental::RLogHandler {
+      std::vector<std::string> &fMessages;
+
+   public:
+      explicit RHandler(std::vector<std::string> &messages) : fMessages(messages) {}
+      bool Emit(const ROOT::Experimental::RLogEntry &entry) override
+      {
+         if (entry.fChannel != &ROOT::Detail::RDF::RDFLogChannel())
+            return true;
+         fMessages.emplace_back(entry.fMessage);
+         return false;
+      }
+   };
+
+   std::vector<std::string> fMessages;
+   RHandler *fHandler;
+   ROOT::Experimental::RLogScopedVerbosity fVerbosity{ROOT::Detail::RDF::RDFLogChannel(),
+                                                      ROOT::Experimental::ELogLevel::kDebug};
+
+public:
+   RDFLogCollector()
+   {
+      auto handler = std::make_unique<RHandler>(fMessages);
+      fHandler = handler.get();
+      ROOT::Experimental::RLogManager::Get().PushFront(std::move(handler));
+   }
+   ~RDFLogCollector() { ROOT::Experimental::RLogManager::Get().Remove(fHandler); }
+
+   bool Contains(const std::string &text) const
+   {
+      return std::any_of(fMessages.begin(), fMessages.end(),
+                         [&text](const std::string &m) { return m.find(text) != std::string::npos; });
+   }
+};
+
+TEST_F(RDFGraphOptimization, IdenticalDefinesAreEvaluatedOnce)
+{
+   ROOT::RDataFrame df(10);
+   auto sumx = df.Define("x", "RDFGraphOptCount(int(rdfentry_))").Sum<int>("x");
+   auto sumy = df.Filter("rdfentry_ > 4").Define("y", "RDFGraphOptCount(int(rdfentry_))").Sum<int>("y");
+   EXPECT_EQ(*sumx, 45);
+   EXPECT_EQ(*sumy, 5 + 6 + 7 + 8 + 9);
+   EXPECT_EQ(GetNCalls(), 10);
+}
+
+TEST_F(RDFGraphOptimization, ChainsOfIdenticalDefinesAreEvaluatedOnce)
+{
+   ROOT::RDataFrame df(10);
+   auto branch1 = df.Define("x", "RDFGraphOptCount(int(rdfentry_))").Define("y", "RDFGraphOptCount(x) * 2");
+   auto branch2 = df.Define("a", "RDFGraphOptCount(int(rdfentry_))").Define("b", "RDFGraphOptCount(a) * 2");
+   auto sum1 = branch1.Sum<int>("y");
+   auto sum2 = branch2.Filter("a % 2 == 0").Sum<int>("b");
+   EXPECT_EQ(*sum1, 90);
+   EXPECT_EQ(*sum2, 2 * (2 + 4 + 6 + 8));
+   EXPECT_EQ(GetNCalls(), 20);
+}
+
+TEST_F(RDFGraphOptimization, IdenticalFiltersAreEvaluatedOnce)
+{
+   ROOT::RDataFrame df(10);
+   auto c1 = df.Filter("RDFGraphOptCount(int(rdfentry_)) > 4").Count();
+   auto c2 = df.Filter("RDFGraphOptCount(int(rdfentry_)) > 4").Define("x", "1").Sum<int>("x");
+   // filters with a different previous node are not shared
+   auto c3 = df.Range(2).Filter("RDFGraphOptCount(int(rdfentry_)) > 4").Count();
+   EXPECT_EQ(*c1, 5u);
+   EXPECT_EQ(*c2, 5);
+   EXPECT_EQ(*c3, 0u);
+   EXPECT_EQ(GetNCalls(), 12);
+}
+
+TEST_F(RDFGraphOptimization, DifferentInputsAreNotShared)
+{
+   ROOT::RDataFrame df(3);
+   auto sum1 = df.Define("x", "1").Define("y", "x * 2").Sum<int>("y");
+   auto sum2 = df.Define("x", "2").Define("y", "x * 2").Sum<int>("y");
+   auto sum3 = df.Define("x", "1").Define("z", "x * 2").Alias("w", "z").Define("y", "w * 2").Sum<int>("y");
+   EXPECT_EQ(*sum1, 6);
+   EXPECT_EQ(*sum2, 12);
+   EXPECT_EQ(*sum3, 12);
+}
+
+TEST_F(RDFGraphOptimization, VariedInputsAreNotShared)
+{
+   ROOT::RDataFrame df(3);
+   auto x = df.Define("x", "double(rdfentry_)");
+   auto nominal = x.Define("y", "x + 1").Sum<double>("y");
+   auto varied = x.Vary("x", "ROOT::RVecD{x * 2, x * 3}", 2).Define("y", "x + 1").Sum<double>("y");
+   auto variations = VariationsFor(varied);
+   EXPECT_DOUBLE_EQ(*nominal, 6.);
+   EXPECT_DOUBLE_EQ(variations["nominal"], 6.);
+   EXPECT_DOUBLE_EQ(variations["x:0"], 9.);
+   EXPECT_DOUBLE_EQ(variations["x:1"], 12.);
+}
+
+TEST_F(RDFGraphOptimization, UnusedDefines)
+{
+   ROOT::RDataFrame df(4);
+   auto d = df.Define("x", "RDFGraphOptCount(int(rdfentry_))").Define("y", "x * 2").Define("z", "3");
+   {
+      RDFLogCollector log;
+      EXPECT_EQ(*d.Sum<int>("z"), 12);
+      EXPECT_TRUE(log.Contains("Skipping the initialization of 2 unused Define(s)."));
+   }
+   EXPECT_EQ(GetNCalls(), 0);
+   // defines unused in a previous event loop work as usual once an action reads them
+   {
+      RDFLogCollector log;
+      EXPECT_EQ(*d.Sum<int>("y"), 12);
+      EXPECT_FALSE(log.Contains("unused Define(s)"));
+   }
+   EXPECT_EQ(GetNCalls(), 4);
+   EXPECT_EQ(*d.Sum<int>("z"), 12);
+   EXPECT_EQ(GetNCalls(), 4);
+}
+
+TEST_F(RDFGraphOptimization, RandomExpressionsAreNotShared)
+{
+   ROOT::RDataFrame df(10);
+   auto r1 = df.Define("r1", "gRandom->Rndm()").Take<double>("r1");
+   auto r2 = df.Define("r2", "gRandom->Rndm()").Take<double>("r2");
+   auto s1 = df.Define("s1", "rdfentry_ + gRandom->Rndm()").Take<double>("s1");
+   auto s2 = df.Define("s2", "rdfentry_ + gRandom->Rndm()").Take<double>("s2");
+   EXPECT_NE(*r1, *r2);
+   EXPECT_NE(*s1, *s2);
+}
+
+TEST_F(RDFGraphOptimization, SharingCanBeDisabled)
+{
+   ROOT::RDF::Experimental::SetJittedNodeSharing(false);
+   ROOT::RDataFrame df(10);
+   auto sumx = df.Define("x", "RDFGraphOptCount(int(rdfentry_))").Sum<int>("x");
+   auto sumy = df.Define("y", "RDFGraphOptCount(int(rdfentry_))").Sum<int>("y");
+   EXPECT_EQ(*sumx, 45);
+   EXPECT_EQ(*sumy, 45);
+   EXPECT_EQ(GetNCalls(), 20);
+   ROOT::RDF::Experimental::SetJittedNodeSharing(true);
+}
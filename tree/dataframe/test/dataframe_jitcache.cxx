@@ -0,0 +1,92 @@
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx"
+#include "TInterpreter.h"
+#include "TSystem.h"
+#include "gtest/gtest.h"
+
+#include <filesystem>
+#include <string>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using ROOT::RDF::Experimental::SetJitCacheDir;
+
+class RDFJitCache : public ::testing::Test {
+protected:
+   const std::string fCacheDir = "dataframe_jitcache_dir";
+
+   void SetUp() override
+   {
+      gSystem->mkdir(fCacheDir.c_str());
+      SetJitCacheDir(fCacheDir);
+   }
+
+   void TearDown() override
+   {
+      SetJitCacheDir("");
+      std::filesystem::remove_all(fCacheDir);
+   }
+
+   int CountFiles(const std::string &ext) const
+   {
+      int n = 0;
+      void *dir = gSystem->OpenDirectory(fCacheDir.c_str());
+      while (const char *entry = gSystem->GetDirEntry(dir)) {
+         const std::string name(entry);
+         if (name.size() > ext.size() && name.compare(name.size() - ext.size(), ext.size(), ext) == 0)
+            ++n;
+      }
+      gSystem->FreeDirectory(dir);
+      return n;
+   }
+};
+
+TEST_F(RDFJitCache, CompiledFunctionsAreCached)
+{
+   ROOT::RDataFrame df(10);
+   auto d = df.Define("x", "int(rdfentry_)").Define("y", "ROOT::RVecD{x * 0.5, x * 1.5}");
+   auto sum = d.Filter("x % 2 == 0 && y[1] > 0").Define("z", "Sum(y)").Sum<double>("z");
+   EXPECT_DOUBLE_EQ(*sum, 2. * (2 + 4 + 6 + 8));
+   // one library and one prototype per expression
+   EXPECT_EQ(CountFiles(".h"), 4);
+   EXPECT_EQ(CountFiles(std::string("_C.") + gSystem->GetSoExt()), 4);
+}
+
+TEST_F(RDFJitCache, InterpreterOnlyFunctions)
+{
+   gInterpreter->Declare("int RDFJitCacheTimesThree(int x) { return 3 * x; }");
+   ROOT::RDataFrame df(4);
+   auto sum = df.Define("x", "RDFJitCacheTimesThree(int(rdfentry_) + 100)").Sum<int>("x");
+   EXPECT_EQ(*sum, 3 * (100 + 101 + 102 + 103));
+   // the function is only known to the interpreter: it is jitted as usual and never compiled again
+   EXPECT_EQ(CountFiles(".failed"), 1);
+   EXPECT_EQ(CountFiles(".h"), 0);
+}
+
+#ifndef _WIN32
+TEST_F(RDFJitCache, LoadFromCache)
+{
+   const auto runDefine = [] {
+      ROOT::RDataFrame df(4);
+      return *df.Define("x", "int(rdfentry_) * 7 + 1").Sum<int>("x");
+   };
+
+   // A child process populates the cache; its jitted expressions are unknown to this process
+   const pid_t pid = fork();
+   ASSERT_NE(pid, -1);
+   if (pid == 0)
+      _exit(runDefine() == 46 ? 0 : 1);
+   int status = 0;
+   waitpid(pid, &status, 0);
+   ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+   EXPECT_EQ(CountFiles(".h"), 1);
+
+   // the compiled function is loaded from the cache instead of being compiled again
+   EXPECT_EQ(runDefine(), 46);
+   EXPECT_EQ(CountFiles(".h"), 1);
+   EXPECT_NE(std::string(gSystem->GetLibraries()).find("rdfjit_"), std::string::npos);
+}
+#endif
@@ -0,0 +1,145 @@
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx"
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using ROOT::RDF::Experimental::PersistentCache;
+
+class RDFPersistentCache : public ::testing::Test {
+protected:
+   const std::string fCacheDir = "dataframe_persistentcache_dir";
+   const std::string fFileName = "dataframe_persistentcache.root";
+
+   void SetUp() override
+   {
+      gSystem->mkdir(fCacheDir.c_str());
+      TFile f(fFileName.c_str(), "RECREATE");
+      TTree t("t", "t");
+      int x;
+      t.Branch("x", &x);
+      for (x = 0; x < 100; ++x)
+         t.Fill();
+      t.Write();
+   }
+
+   void TearDown() override
+   {
+      std::filesystem::remove_all(fCacheDir);
+      gSystem->Unlink(fFileName.c_str());
+   }
+};
+
+TEST_F(RDFPersistentCache, ReuseCache)
+{
+   auto nCalls = std::make_shared<std::atomic<int>>(0);
+   auto makeGraph = [&]() {
+      return ROOT::RDataFrame("t", fFileName)
+         .Define("y",
+                 [nCalls](int x) {
+                    ++*nCalls;
+                    return x * 2;
+                 },
+                 {"x"})
+         .Filter("y > 50");
+   };
+
+   auto cached = PersistentCache(makeGraph(), {"x", "y"}, fCacheDir, "v1");
+   EXPECT_EQ(*nCalls, 100);
+   EXPECT_EQ(*cached.Count(), 74ull);
+   EXPECT_EQ(*cached.Sum<int>("y"), 2 * (99 * 100 / 2 - 25 * 26 / 2));
+
+   // same graph, same dataset: the cached result is read back and nothing is recomputed
+   auto cachedAgain = PersistentCache(makeGraph(), {"x", "y"}, fCacheDir, "v1");
+   EXPECT_EQ(*nCalls, 100);
+   EXPECT_EQ(*cachedAgain.Count(), 74ull);
+   EXPECT_EQ(*cachedAgain.Take<int>("y"), *cached.Take<int>("y"));
+
+   // a different tag invalidates the cache
+   PersistentCache(makeGraph(), {"x", "y"}, fCacheDir, "v2");
+   EXPECT_EQ(*nCalls, 200);
+}
+
+TEST_F(RDFPersistentCache, KeyDependsOnExpressionsAndData)
+{
+   auto cached = PersistentCache(ROOT::RDataFrame("t", fFileName).Filter("x > 10"), {"x"}, fCacheDir);
+   EXPECT_EQ(*cached.Count(), 89ull);
+
+   // different filter expression
+   auto other = PersistentCache(ROOT::RDataFrame("t", fFileName).Filter("x > 20"), {"x"}, fCacheDir);
+   EXPECT_EQ(*other.Count(), 79ull);
+
+   // different define expression with the same name
+   auto d1 = PersistentCache(ROOT::RDataFrame("t", fFileName).Define("z", "x + 1"), {"z"}, fCacheDir);
+   auto d2 = PersistentCache(ROOT::RDataFrame("t", fFileName).Define("z", "x + 2"), {"z"}, fCacheDir);
+   EXPECT_EQ(*d1.Max<int>("z"), 100);
+   EXPECT_EQ(*d2.Max<int>("z"), 101);
+
+   // different entry range
+   auto ranged = PersistentCache(ROOT::RDataFrame("t", fFileName).Range(50).Filter("x > 10"), {"x"}, fCacheDir);
+   EXPECT_EQ(*ranged.Count(), 39ull);
+
+   // the input file changes
+   const auto mtime = std::filesystem::last_write_time(fFileName);
+   {
+      TFile f(fFileName.c_str(), "RECREATE");
+      TTree t("t", "t");
+      int x;
+      t.Branch("x", &x);
+      for (x = 0; x < 50; ++x)
+         t.Fill();
+      t.Write();
+   }
+   auto updated = PersistentCache(ROOT::RDataFrame("t", fFileName).Filter("x > 10"), {"x"}, fCacheDir);
+   EXPECT_EQ(*updated.Count(), 39ull);
+
+   // only the modification time changes
+   std::filesystem::last_write_time(fFileName, mtime + std::chrono::seconds(10));
+   auto touched = PersistentCache(ROOT::RDataFrame("t", fFileName).Filter("x > 10"), {"x"}, fCacheDir);
+   EXPECT_EQ(*touched.Count(), 39ull);
+   EXPECT_EQ(std::distance(std::filesystem::directory_iterator(fCacheDir), std::filesystem::directory_iterator()),
+             7);
+}
+
+TEST_F(RDFPersistentCache, EmptySource)
+{
+   auto makeGraph = [](int n) { return ROOT::RDataFrame(n).Define("e", [](ULong64_t e) { return e; }, {"rdfentry_"}); };
+   EXPECT_EQ(*PersistentCache(makeGraph(10), {"e"}, fCacheDir, "e").Count(), 10ull);
+   EXPECT_EQ(*PersistentCache(makeGraph(20), {"e"}, fCacheDir, "e").Count(), 20ull);
+}
+
+TEST_F(RDFPersistentCache, CompiledCallables)
+{
+   auto twice = [](int v) { return v * 2; };
+   auto df = ROOT::RDataFrame("t", fFileName).Define("a", "x").Define("b", "x * 10");
+
+   // compiled callables cannot be identified without a tag
+   EXPECT_THROW(PersistentCache(df.Define("y", twice, {"a"}), {"y"}, fCacheDir), std::runtime_error);
+   EXPECT_THROW(PersistentCache(df.Filter([](int v) { return v > 10; }, {"a"}), {"a"}, fCacheDir),
+                std::runtime_error);
+
+   // the same callable on different input columns does not share the cache entry
+   auto ya = PersistentCache(df.Define("y", twice, {"a"}), {"y"}, fCacheDir, "twice");
+   auto yb = PersistentCache(df.Define("y", twice, {"b"}), {"y"}, fCacheDir, "twice");
+   EXPECT_EQ(*ya.Max<int>("y"), 198);
+   EXPECT_EQ(*yb.Max<int>("y"), 1980);
+}
+
+TEST_F(RDFPersistentCache, InMemoryTree)
+{
+   TTree t("t", "t");
+   int x = 0;
+   t.Branch("x", &x);
+   t.Fill();
+   EXPECT_THROW(PersistentCache(ROOT::RDataFrame(t), {"x"}, fCacheDir), std::runtime_error);
+}
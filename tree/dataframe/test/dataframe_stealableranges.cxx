@@ -0,0 +1,92 @@
+#include "ROOT/RDF/RStealableRanges.hxx"
+#include "gtest/gtest.h"
+
+using ROOT::Internal::RDF::RStealableRangeRAII;
+using ROOT::Internal::RDF::RStealableRanges;
+
+TEST(RDFStealableRanges, ClaimUntilTheEnd)
+{
+   RStealableRanges ranges(2, 10, 1);
+   RStealableRangeRAII r(ranges, 0, 10, 0);
+   Long64_t entry = 0;
+   while (r.fRange.Claim(entry))
+      ++entry;
+   EXPECT_EQ(entry, 10);
+}
+
+TEST(RDFStealableRanges, StealTail)
+{
+   // 3 ranges of 1000 entries: all entries are handed out once the 3 ranges are registered
+   RStealableRanges ranges(4, 3000, 100);
+   RStealableRangeRAII r1(ranges, 0, 1000, 0);
+   RStealableRangeRAII r2(ranges, 1000, 2000, 5000);
+   auto &r1Range = r1.fRange;
+   auto &r2Range = r2.fRange;
+   // r1 is done, but it cannot steal before all ranges have started
+   EXPECT_FALSE(ranges.Steal(r1Range));
+
+   RStealableRangeRAII r3(ranges, 2000, 3000, 10000);
+   // r2 has processed its first 200 entries, r3 its first 100
+   for (Long64_t e = 1000; e < 1200; ++e)
+      EXPECT_TRUE(r2Range.Claim(e));
+   for (Long64_t e = 2000; e < 2100; ++e)
+      EXPECT_TRUE(r3.fRange.Claim(e));
+
+   // r1 takes over the second half of the unclaimed entries of r3, which has the most
+   ASSERT_TRUE(ranges.Steal(r1Range));
+   const auto stolenBegin = r1Range.GetBegin();
+   EXPECT_GT(stolenBegin, 2100);
+   EXPECT_LT(stolenBegin, 3000);
+   EXPECT_EQ(r1Range.GetEnd(), 3000);
+   EXPECT_EQ(r1Range.GetFirstCount(), 10000ull + (stolenBegin - 2000));
+   EXPECT_EQ(r3.fRange.GetEnd(), stolenBegin);
+
+   // r3 stops where the stolen entries begin
+   Long64_t entry = 2100;
+   while (r3.fRange.Claim(entry))
+      ++entry;
+   EXPECT_EQ(entry, stolenBegin);
+
+   // r1 processes the stolen entries
+   entry = stolenBegin;
+   while (r1Range.Claim(entry))
+      ++entry;
+   EXPECT_EQ(entry, 3000);
+}
+
+TEST(RDFStealableRanges, NothingWorthStealing)
+{
+   RStealableRanges ranges(4, 1100, 100);
+   RStealableRangeRAII r1(ranges, 0, 1000, 0);
+   RStealableRangeRAII r2(ranges, 1000, 1100, 1000);
+   // r1 has 100 unclaimed entries left: less than twice the minimum number of stolen entries
+   for (Long64_t e = 0; e < 900; ++e)
+      EXPECT_TRUE(r1.fRange.Claim(e));
+   EXPECT_FALSE(ranges.Steal(r2.fRange));
+}
+
+TEST(RDFStealableRanges, DifferentDomains)
+{
+   RStealableRanges ranges(4, 2000, 10);
+   RStealableRangeRAII r1(ranges, 0, 1000, 0, "a.root");
+   RStealableRangeRAII r2(ranges, 0, 1000, 1000, "b.root");
+   EXPECT_FALSE(ranges.Steal(r2.fRange));
+   RStealableRangeRAII r3(ranges, 500, 500, 2000, "a.root");
+   EXPECT_TRUE(ranges.Steal(r3.fRange));
+   EXPECT_EQ(r3.fRange.GetEnd(), 1000);
+}
+
+TEST(RDFStealableRanges, UnknownNumberOfEntries)
+{
+   // without the total number of entries, the tail starts when fewer ranges than slots are processed
+   RStealableRanges ranges(3, 0, 10);
+   RStealableRangeRAII r1(ranges, 0, 1000, 0);
+   RStealableRangeRAII r2(ranges, 1000, 1000, 1000);
+   {
+      RStealableRangeRAII r3(ranges, 2000, 2000, 2000);
+      EXPECT_FALSE(ranges.Steal(r3.fRange));
+   }
+   EXPECT_TRUE(ranges.Steal(r2.fRange));
+   EXPECT_EQ(r2.fRange.GetBegin(), 500);
+   EXPECT_EQ(r2.fRange.GetFirstCount(), 500ull);
+}
@@ -8,7 +8,10 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdio>
+
 using ROOT::Experimental::RNTupleDS;
+using ROOT::Experimental::RNTupleReader;
 using ROOT::Experimental::RNTupleWriter;
 using ROOT::Experimental::RNTupleModel;
 using ROOT::Experimental::Detail::RPageSource;
@@ -135,3 +138,111 @@ TEST_F(RNTupleDSTest, ReadMT)
 
    ReadTest(fNtplName, fFileName);
 }
+
+static void SnapshotTest(const std::string &fileName)
+{
+   auto df = ROOT::RDataFrame(100)
+                .Define("i", [](ULong64_t e) { return static_cast<int>(e); }, {"rdfentry_"})
+                .Define("rvec", [](int i) { return ROOT::RVecF(i % 3, i); }, {"i"});
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+
+   auto checkOutput = [&fileName](ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager> &snap) {
+      EXPECT_EQ(100u, snap.Count().GetValue());
+      EXPECT_EQ(4950, snap.Sum<int>("i").GetValue());
+      auto sizes = snap.Define("n", [](const ROOT::RVecF &v) { return v.size(); }, {"rvec"}).Sum<std::size_t>("n");
+      EXPECT_EQ(99u, sizes.GetValue());
+
+      auto reader = RNTupleReader::Open("ntuple", fileName);
+      EXPECT_EQ(100u, reader->GetNEntries());
+      EXPECT_EQ(std::string("ROOT::VecOps::RVec<float>"), reader->GetModel()->GetField("rvec")->GetType());
+   };
+
+   auto snap = df.Snapshot<int, ROOT::RVecF>("ntuple", fileName, {"i", "rvec"}, opts);
+   checkOutput(*snap);
+   std::remove(fileName.c_str());
+
+   // jitted column types
+   auto snapJit = df.Snapshot("ntuple", fileName, {"i", "rvec"}, opts);
+   checkOutput(*snapJit);
+   std::remove(fileName.c_str());
+}
+
+TEST(RNTupleDSSnapshot, Snapshot)
+{
+   SnapshotTest("RNTupleDS_snapshot.root");
+}
+
+TEST(RNTupleDSSnapshot, SnapshotMT)
+{
+   IMTRAII _;
+
+   SnapshotTest("RNTupleDS_snapshot_mt.root");
+}
+
+TEST(RNTupleDSSnapshot, LazySnapshot)
+{
+   const std::string fileName = "RNTupleDS_snapshot_lazy.root";
+   auto df = ROOT::RDataFrame(10).Define("x", [](ULong64_t e) { return float(e); }, {"rdfentry_"});
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   opts.fLazy = true;
+
+   // results booked on the output before the Snapshot ran read the output once it is written
+   auto snap = df.Snapshot<float>("ntuple", fileName, {"x"}, opts);
+   auto count = snap->Count();
+   auto sum = snap->Sum<float>("x");
+   auto snapJit = df.Snapshot("ntuple", fileName + ".jit", {"x"}, opts);
+   auto sumJit = snapJit->Sum<float>("x");
+   EXPECT_EQ(std::string("float"), snap->GetColumnType("x"));
+
+   *snap;
+   EXPECT_EQ(10u, count.GetValue());
+   EXPECT_FLOAT_EQ(45.f, sum.GetValue());
+   *snapJit;
+   EXPECT_FLOAT_EQ(45.f, sumJit.GetValue());
+
+   std::remove(fileName.c_str());
+   std::remove((fileName + ".jit").c_str());
+}
+
+TEST(RNTupleDSSnapshot, SubDirectory)
+{
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   auto df = ROOT::RDataFrame(1).Define("x", [] { return 1.f; });
+   EXPECT_THROW(df.Snapshot<float>("dir/ntuple", "RNTupleDS_snapshot_dir.root", {"x"}, opts), std::runtime_error);
+   std::remove("RNTupleDS_snapshot_dir.root");
+}
+
+TEST(RNTupleDS, ValueRangeFilter)
+{
+   const std::string fileName = "RNTupleDS_value_range_filter.root";
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrEta = model->MakeField<float>("eta");
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetEnablePageStatistics(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileName, options);
+      for (int i = 0; i < 1000; ++i) {
+         *wrPt = i;
+         *wrEta = i % 100;
+         ntuple->Fill();
+         if (i % 100 == 99)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ds = std::make_unique<RNTupleDS>(RPageSource::Create("ntuple", fileName));
+   ds->AddValueRangeFilter("pt", 150, 320);
+   // Does not skip any cluster
+   ds->AddValueRangeFilter("eta", 0, 10);
+   EXPECT_THROW(ds->AddValueRangeFilter("nonexistent", 0, 1), ROOT::Experimental::RException);
+   ROOT::RDataFrame df(std::move(ds));
+   // Clusters 1, 2, and 3 are processed
+   EXPECT_EQ(300u, df.Count().GetValue());
+   EXPECT_EQ(171u, df.Filter([](float pt) { return pt >= 150 && pt <= 320; }, {"pt"}).Count().GetValue());
+
+   std::remove(fileName.c_str());
+}
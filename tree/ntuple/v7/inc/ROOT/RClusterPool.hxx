@@ -46,6 +46,12 @@ and pushes them into the page pool. The actual logic of reading and unzipping is
 The cluster pool only orchestrates the work queues for reading and unzipping. It uses two threads, one for
 each pipeline step. The I/O thread for reading waits for data from storage and generates no CPU load. In contrast,
 the unzip thread is supposed to submit multi-threaded, CPU heavy work to the application's task scheduler.
+All the clusters that arrived from the I/O thread in the meantime are unzipped in a single batch, i.e. the pages
+of several clusters are decompressed concurrently.
+
+Clusters are read in bunches of fClusterBunchSize clusters per vector read. Besides the bunch of the requested
+cluster, the pool keeps fPrefetchDepth bunches in flight, so that reading and unzipping of the following clusters
+overlap with the processing of the current one.
 
 The unzipping step of the pipeline therefore behaves differently depending on whether or not implicit multi-threadin
 is turned on. If it is turned off, i.e. in a single-threaded environment, the cluster pool will only read the
@@ -95,6 +101,8 @@ private:
    unsigned int fWindowPre = 0;
    /// The number of clusters that are being read in a single vector read.
    unsigned int fClusterBunchSize;
+   /// The number of cluster bunches that are preloaded after the bunch of the requested cluster
+   unsigned int fPrefetchDepth;
    /// Used as an ever-growing counter in GetCluster() to separate bunches of clusters from each other
    std::int64_t fBunchId = 0;
    /// The cache of clusters around the currently active cluster
@@ -116,12 +124,12 @@ private:
    /// The communication channel between the I/O thread and the unzip thread
    std::queue<RUnzipItem> fUnzipQueue;
 
-   /// The I/O thread calls RPageSource::LoadClusters() asynchronously.  The thread is mostly waiting for the
+   /// The I/O thread calls RPageSource::StreamClusters() asynchronously.  The thread is mostly waiting for the
    /// data to arrive (blocked by the kernel) and therefore can safely run in addition to the application
    /// main threads.
    std::thread fThreadIo;
-   /// The unzip thread takes a loaded cluster and passes it to fPageSource->UnzipCluster() on it. If implicit
-   /// multi-threading is turned off, the UnzipCluster() call is a no-op. Otherwise, the UnzipCluster() call
+   /// The unzip thread takes the loaded clusters and passes them to fPageSource->UnzipClusters(). If implicit
+   /// multi-threading is turned off, the UnzipClusters() call is a no-op. Otherwise, the UnzipClusters() call
    /// schedules the unzipping of pages using the application's task scheduler.
    std::thread fThreadUnzip;
 
@@ -132,8 +140,8 @@ private:
    size_t FindFreeSlot() const;
    /// The I/O thread routine, there is exactly one I/O thread in-flight for every cluster pool
    void ExecReadClusters();
-   /// The unzip thread routine which takes a loaded cluster and passes it to fPageSource.UnzipCluster (which
-   /// might be a no-op if IMT is off). Marks the cluster as ready to be picked up by the main thread.
+   /// The unzip thread routine which takes the loaded clusters and passes them to fPageSource.UnzipClusters (which
+   /// might be a no-op if IMT is off). Marks the clusters as ready to be picked up by the main thread.
    void ExecUnzipClusters();
    /// Returns the given cluster from the pool, which needs to contain at least the columns `columns`.
    /// Executed at the end of GetCluster when all missing data pieces have been sent to the load queue.
@@ -142,7 +150,12 @@ private:
 
 public:
    static constexpr unsigned int kDefaultClusterBunchSize = 1;
-   RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize);
+   static constexpr unsigned int kDefaultPrefetchDepth = 1;
+   RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize, unsigned int prefetchDepth);
+   RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize)
+      : RClusterPool(pageSource, clusterBunchSize, kDefaultPrefetchDepth)
+   {
+   }
    explicit RClusterPool(RPageSource &pageSource) : RClusterPool(pageSource, kDefaultClusterBunchSize) {}
    RClusterPool(const RClusterPool &other) = delete;
    RClusterPool &operator =(const RClusterPool &other) = delete;
@@ -150,7 +163,7 @@ public:
 
    /// Returns the requested cluster either from the pool or, in case of a cache miss, lets the I/O thread load
    /// the cluster in the pool, blocks until done, and then returns it.  Triggers along the way the background loading
-   /// of the following fWindowPost number of clusters.  The returned cluster has at least all the pages of `columns`
+   /// of the following fPrefetchDepth bunches of clusters.  The returned cluster has at least all the pages of `columns`
    /// and possibly pages of other columns, too.  If implicit multi-threading is turned on, the uncompressed pages
    /// of the returned cluster are already pushed into the page pool associated with the page source upon return.
    /// The cluster remains valid until the next call to GetCluster().
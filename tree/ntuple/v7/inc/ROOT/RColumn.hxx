@@ -64,6 +64,8 @@ private:
    /// For writing, the targeted number of elements, given by `fApproxNElementsPerPage` (in the write options) and the element size.
    /// We ensure this value to be >= 2 in Connect() so that we have meaningful
    /// "page full" and "page half full" events when writing the page.
+   /// The page sink can change the target between clusters (see RPageSink::GetApproxNElementsPerPage()); the new
+   /// target is picked up whenever a fresh write page is started.
    std::uint32_t fApproxNElementsPerPage = 0;
    /// The number of elements written resp. available in the column
    NTupleSize_t fNElements = 0;
@@ -84,9 +86,17 @@ private:
 
       fWritePageIdx = 1 - fWritePageIdx; // == (fWritePageIdx + 1) % 2
       R__ASSERT(fWritePage[fWritePageIdx].IsEmpty());
+      fApproxNElementsPerPage = fPageSink->GetApproxNElementsPerPage(fHandleSink);
+      if (R__unlikely(fWritePage[fWritePageIdx].GetMaxElements() !=
+                      fApproxNElementsPerPage + fApproxNElementsPerPage / 2)) {
+         ResizeWritePage(fWritePageIdx);
+      }
       fWritePage[fWritePageIdx].Reset(fNElements);
    }
 
+   /// Replaces the given (empty) write page by one that fits the current fApproxNElementsPerPage
+   void ResizeWritePage(int idx);
+
    /// When the main write page surpasses the 50% fill level, the (full) shadow write page gets flushed
    void FlushShadowWritePage() {
       auto otherIdx = 1 - fWritePageIdx;
@@ -112,6 +122,8 @@ public:
    ~RColumn();
 
    void Connect(DescriptorId_t fieldId, RPageStorage *pageStorage);
+   /// Before anything is written, re-reserves the write pages if the page sink changed the page size of the column
+   void UpdateWritePageSize();
 
    void Append(const RColumnElementBase &element) {
       void *dst = fWritePage[fWritePageIdx].GrowUnchecked(1);
@@ -245,6 +257,17 @@ public:
          (clusterIndex.GetIndex() - fReadPage.GetClusterRangeFirst()) * RColumnElement<CppT>::kSize);
    }
 
+   /// Type-erased version of MapV() for callers that only know the element size at run time, such as the bulk
+   /// readers of simple fields
+   void *MapRawV(const NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      if (R__unlikely(!fReadPage.Contains(globalIndex))) {
+         MapPage(globalIndex);
+      }
+      nItems = fReadPage.GetGlobalRangeLast() - globalIndex + 1;
+      return static_cast<unsigned char *>(fReadPage.GetBuffer()) +
+             (globalIndex - fReadPage.GetGlobalRangeFirst()) * fReadPage.GetElementSize();
+   }
+
    NTupleSize_t GetGlobalIndex(const RClusterIndex &clusterIndex) {
       if (!fReadPage.Contains(clusterIndex)) {
          MapPage(clusterIndex);
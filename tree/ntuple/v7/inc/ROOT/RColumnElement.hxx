@@ -23,8 +23,11 @@
 #include <Byteswap.h>
 #include <TError.h>
 
+#include <algorithm>
+#include <cmath>
 #include <cstring> // for memcpy
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -127,11 +130,51 @@ public:
       std::memcpy(destination, source, count);
    }
 
+   /// Elements of arithmetic type compute the range of `count` in-memory values in `source`, ignoring NaN values.
+   /// Returns false if the values do not have a meaningful order, e.g. for offset columns.
+   virtual bool GetValueRange(const void * /* source */, std::size_t /* count */, double & /* min */,
+                              double & /* max */) const
+   {
+      return false;
+   }
+
    void *GetRawContent() const { return fRawContent; }
    std::size_t GetSize() const { return fSize; }
    std::size_t GetPackedSize(std::size_t nElements) const { return (nElements * GetBitsOnStorage() + 7) / 8; }
 };
 
+/// Computes the range of the values of an in-memory page of arithmetic type, see RColumnElementBase::GetValueRange().
+/// The range of 64bit integers is widened by one unit in the last place because their conversion to double rounds.
+template <typename CppT>
+bool GetValueRangeOf(const void *source, std::size_t count, double &min, double &max)
+{
+   static_assert(std::is_arithmetic<CppT>::value, "value ranges require an arithmetic type");
+   auto values = reinterpret_cast<const CppT *>(source);
+   CppT lo = std::numeric_limits<CppT>::max();
+   CppT hi = std::numeric_limits<CppT>::lowest();
+   bool hasValues = false;
+   for (std::size_t i = 0; i < count; ++i) {
+      // Comparisons with NaN are false
+      if (!(values[i] == values[i]))
+         continue;
+      lo = std::min(lo, values[i]);
+      hi = std::max(hi, values[i]);
+      hasValues = true;
+   }
+   if (!hasValues) {
+      min = std::numeric_limits<double>::infinity();
+      max = -std::numeric_limits<double>::infinity();
+      return true;
+   }
+   min = static_cast<double>(lo);
+   max = static_cast<double>(hi);
+   if (std::is_integral<CppT>::value && sizeof(CppT) == 8) {
+      min = std::nextafter(min, -std::numeric_limits<double>::infinity());
+      max = std::nextafter(max, std::numeric_limits<double>::infinity());
+   }
+   return true;
+}
+
 /**
  * Base class for columns whose on-storage representation is little-endian.
  * The implementation of `Pack` and `Unpack` takes care of byteswap if the memory page is big-endian.
@@ -142,6 +185,11 @@ public:
    static constexpr bool kIsMappable = (R__LITTLE_ENDIAN == 1);
    RColumnElementLE(void *rawContent, std::size_t size) : RColumnElementBase(rawContent, size) {}
 
+   bool GetValueRange(const void *source, std::size_t count, double &min, double &max) const override
+   {
+      return GetValueRangeOf<CppT>(source, count, min, max);
+   }
+
    void Pack(void *dst, void *src, std::size_t count) const final
    {
 #if R__LITTLE_ENDIAN == 1
@@ -160,6 +208,80 @@ public:
    }
 };
 
+/// \brief Kernels for the split encodings of column pages, see EColumnType.
+///
+/// The packed representation stores byte `b` of element `i` at position `b * count + i`, starting with the least
+/// significant byte.  It is independent of the host byte order. The element size has to be 2, 4, or 8 bytes.
+void SplitPack(void *dst, const void *src, std::size_t count, std::size_t elementSize);
+void SplitUnpack(void *dst, const void *src, std::size_t count, std::size_t elementSize);
+/// Like SplitPack() but zigzag encodes the integer elements first, such that small negative numbers have small
+/// (unsigned) representations
+void ZigzagSplitPack(void *dst, const void *src, std::size_t count, std::size_t elementSize);
+void ZigzagSplitUnpack(void *dst, const void *src, std::size_t count, std::size_t elementSize);
+/// Like SplitPack() but stores the differences between consecutive elements; the first element of the page is stored
+/// as a difference to zero.  Used for offset columns, which are sorted within a cluster.
+void DeltaSplitPack(void *dst, const void *src, std::size_t count, std::size_t elementSize);
+void DeltaSplitUnpack(void *dst, const void *src, std::size_t count, std::size_t elementSize);
+
+/**
+ * Base class for columns whose on-storage representation is little-endian in split encoding.
+ */
+template <typename CppT>
+class RColumnElementSplitLE : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   RColumnElementSplitLE(void *rawContent, std::size_t size) : RColumnElementBase(rawContent, size) {}
+
+   bool GetValueRange(const void *source, std::size_t count, double &min, double &max) const final
+   {
+      return GetValueRangeOf<CppT>(source, count, min, max);
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final { SplitPack(dst, src, count, sizeof(CppT)); }
+   void Unpack(void *dst, void *src, std::size_t count) const final { SplitUnpack(dst, src, count, sizeof(CppT)); }
+};
+
+/**
+ * Base class for signed integer columns whose on-storage representation is little-endian in split + zigzag encoding.
+ * Unsigned integers use RColumnElementSplitLE, zigzag encoding would only double their small values.
+ */
+template <typename CppT>
+class RColumnElementZigzagSplitLE : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   RColumnElementZigzagSplitLE(void *rawContent, std::size_t size) : RColumnElementBase(rawContent, size) {}
+
+   bool GetValueRange(const void *source, std::size_t count, double &min, double &max) const final
+   {
+      return GetValueRangeOf<CppT>(source, count, min, max);
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final
+   {
+      ZigzagSplitPack(dst, src, count, sizeof(CppT));
+   }
+   void Unpack(void *dst, void *src, std::size_t count) const final
+   {
+      ZigzagSplitUnpack(dst, src, count, sizeof(CppT));
+   }
+};
+
+/**
+ * Base class for offset columns whose on-storage representation is little-endian in split + delta encoding.
+ */
+template <typename CppT>
+class RColumnElementDeltaSplitLE : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   RColumnElementDeltaSplitLE(void *rawContent, std::size_t size) : RColumnElementBase(rawContent, size) {}
+
+   void Pack(void *dst, void *src, std::size_t count) const final { DeltaSplitPack(dst, src, count, sizeof(CppT)); }
+   void Unpack(void *dst, void *src, std::size_t count) const final
+   {
+      DeltaSplitUnpack(dst, src, count, sizeof(CppT));
+   }
+};
+
 /**
  * Pairs of C++ type and column type, like float and EColumnType::kReal32
  */
@@ -301,6 +423,10 @@ public:
    explicit RColumnElement(std::int8_t *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *source, std::size_t count, double &min, double &max) const final
+   {
+      return GetValueRangeOf<std::int8_t>(source, count, min, max);
+   }
 };
 
 template <>
@@ -312,6 +438,10 @@ public:
    explicit RColumnElement(std::uint8_t *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *source, std::size_t count, double &min, double &max) const final
+   {
+      return GetValueRangeOf<std::uint8_t>(source, count, min, max);
+   }
 };
 
 template <>
@@ -323,6 +453,10 @@ public:
    explicit RColumnElement(std::int8_t *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *source, std::size_t count, double &min, double &max) const final
+   {
+      return GetValueRangeOf<std::int8_t>(source, count, min, max);
+   }
 };
 
 template <>
@@ -334,6 +468,10 @@ public:
    explicit RColumnElement(std::uint8_t *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *source, std::size_t count, double &min, double &max) const final
+   {
+      return GetValueRangeOf<std::uint8_t>(source, count, min, max);
+   }
 };
 
 template <>
@@ -404,6 +542,7 @@ public:
    explicit RColumnElement(ClusterSize_t *value) : RColumnElementLE(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *, std::size_t, double &, double &) const final { return false; }
 };
 
 template <>
@@ -465,11 +604,106 @@ public:
    explicit RColumnElement(std::int64_t *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *source, std::size_t count, double &min, double &max) const final
+   {
+      return GetValueRangeOf<std::int64_t>(source, count, min, max);
+   }
 
    void Pack(void *dst, void *src, std::size_t count) const final;
    void Unpack(void *dst, void *src, std::size_t count) const final;
 };
 
+template <>
+class RColumnElement<float, EColumnType::kSplitReal32> : public RColumnElementSplitLE<float> {
+public:
+   static constexpr std::size_t kSize = sizeof(float);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(float *value) : RColumnElementSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<double, EColumnType::kSplitReal64> : public RColumnElementSplitLE<double> {
+public:
+   static constexpr std::size_t kSize = sizeof(double);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(double *value) : RColumnElementSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::int16_t, EColumnType::kSplitInt16> : public RColumnElementZigzagSplitLE<std::int16_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::int16_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int16_t *value) : RColumnElementZigzagSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::uint16_t, EColumnType::kSplitInt16> : public RColumnElementSplitLE<std::uint16_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::uint16_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::uint16_t *value) : RColumnElementSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::int32_t, EColumnType::kSplitInt32> : public RColumnElementZigzagSplitLE<std::int32_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::int32_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int32_t *value) : RColumnElementZigzagSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::uint32_t, EColumnType::kSplitInt32> : public RColumnElementSplitLE<std::uint32_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::uint32_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::uint32_t *value) : RColumnElementSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::int64_t, EColumnType::kSplitInt64> : public RColumnElementZigzagSplitLE<std::int64_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::int64_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int64_t *value) : RColumnElementZigzagSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::uint64_t, EColumnType::kSplitInt64> : public RColumnElementSplitLE<std::uint64_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::uint64_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::uint64_t *value) : RColumnElementSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<ClusterSize_t, EColumnType::kSplitIndex32>
+   : public RColumnElementDeltaSplitLE<ClusterSize_t::ValueType> {
+public:
+   static constexpr std::size_t kSize = sizeof(ROOT::Experimental::ClusterSize_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(ClusterSize_t *value) : RColumnElementDeltaSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
 } // namespace Detail
 } // namespace Experimental
 } // namespace ROOT
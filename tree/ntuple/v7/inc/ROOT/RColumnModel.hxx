@@ -50,6 +50,16 @@ enum class EColumnType {
    kInt32,
    kInt16,
    kInt8,
+   // The split encodings store the bytes of the elements of a page as separate byte streams, i.e. first all the
+   // least significant bytes, then all the second bytes etc.  Signed integers are zigzag encoded before splitting,
+   // index columns are delta encoded before splitting.  Together, these transformations typically improve the
+   // compression ratio of physics data.
+   kSplitIndex32,
+   kSplitReal64,
+   kSplitReal32,
+   kSplitInt64,
+   kSplitInt32,
+   kSplitInt16,
    kMax,
 };
 
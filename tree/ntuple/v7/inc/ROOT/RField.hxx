@@ -124,6 +124,8 @@ protected:
    int fTraits = 0;
    /// List of functions to be called after reading a value
    std::vector<ReadCallback_t> fReadCallbacks;
+   /// Whether GenerateColumnsImpl() creates split encoded columns, see RNTupleWriteOptions::SetUseSplitEncoding()
+   bool fUseSplitEncoding = true;
 
    /// Creates the backing columns corresponsing to the field type for writing
    virtual void GenerateColumnsImpl() = 0;
@@ -274,6 +276,15 @@ public:
          InvokeReadCallbacks(*value);
    }
 
+   /// Bulk access for simple fields: returns the address of the value at globalIndex inside the page buffer of the
+   /// principal column, without copying, and sets nItems to the number of consecutive values available from there
+   /// up to the end of the page.  The memory remains valid until the field reads from a different page.
+   void *MapRawV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      if (R__unlikely(!fIsSimple))
+         throw RException(R__FAIL("bulk access requires a simple field: " + fName));
+      return fPrincipalColumn->MapRawV(globalIndex, nItems);
+   }
+
    /// Ensure that all received items are written from page buffers to the storage.
    void Flush() const;
    /// Perform housekeeping tasks for global to cluster-local index translation
@@ -301,6 +312,9 @@ public:
    /// can be read or written.  In order to find the field in the page storage, the field's on-disk ID has to be set.
    void ConnectPageSink(RPageSink &pageSink);
    void ConnectPageSource(RPageSource &pageSource);
+   /// Makes the (empty) write pages of the columns fit the page size of the page sink, which the page sink can change
+   /// once all the fields are connected
+   void UpdateWritePageSizes();
 
    /// Indicates an evolution of the mapping scheme from C++ type to columns
    virtual std::uint32_t GetFieldVersion() const { return 0; }
@@ -223,8 +223,9 @@ public:
    std::uint64_t WriteNTupleHeader(const void *data, size_t nbytes, size_t lenHeader);
    /// Writes the compressed footer and registeres its location; lenFooter is the size of the uncompressed footer.
    std::uint64_t WriteNTupleFooter(const void *data, size_t nbytes, size_t lenFooter);
-   /// Writes a new record as an RBlob key into the file
-   std::uint64_t WriteBlob(const void *data, size_t nbytes, size_t len);
+   /// Writes a new record as an RBlob key into the file.  For files written through a C stream, the record is aligned
+   /// to the given alignment (in bytes), which allows for using uncompressed records in place from a memory mapping.
+   std::uint64_t WriteBlob(const void *data, size_t nbytes, size_t len, size_t alignment = 1);
    /// Writes the RNTuple key to the file so that the header and footer keys can be found
    void Commit();
 };
@@ -34,6 +34,7 @@
 #include <memory>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 class TFile;
 
@@ -285,6 +286,27 @@ public:
    /// ~~~
    RNTupleGlobalRange GetEntryRange() { return RNTupleGlobalRange(0, GetNEntries()); }
 
+   /// Returns the entry ranges of the clusters that may contain entries with values of the given field in [min, max].
+   /// Clusters are skipped based on the value statistics of the field's principal column, which are only available
+   /// if the ntuple was written with RNTupleWriteOptions::SetEnablePageStatistics().  Clusters without statistics
+   /// are never skipped.  Adjacent clusters are combined into a single range.  The entries in the returned ranges
+   /// still need to be checked individually.
+   ///
+   /// Raises an exception if there is no field with the given name.
+   ///
+   /// **Example: only process the clusters that can contain events with pt >= 100**
+   /// ~~~ {.cpp}
+   /// auto ntuple = RNTupleReader::Open("myNTuple", "some/file.root");
+   /// auto pt = ntuple->GetView<float>("pt");
+   /// for (auto range : ntuple->GetEntryRanges("pt", 100, std::numeric_limits<double>::infinity())) {
+   ///    for (auto i : range) {
+   ///       if (pt(i) >= 100)
+   ///          std::cout << i << ": " << pt(i) << "\n";
+   ///    }
+   /// }
+   /// ~~~
+   std::vector<RNTupleGlobalRange> GetEntryRanges(std::string_view fieldName, double min, double max);
+
    /// Provides access to an individual field that can contain either a scalar value or a collection, e.g.
    /// GetView<double>("particles.pt") or GetView<std::vector<double>>("particle").  It can as well be the index
    /// field of a collection itself, like GetView<NTupleSize_t>("particle").
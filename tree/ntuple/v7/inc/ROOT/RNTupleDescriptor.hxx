@@ -27,6 +27,7 @@
 #include <chrono>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -194,6 +195,33 @@ class RClusterDescriptor {
    friend class RClusterDescriptorBuilder;
 
 public:
+   /// Optional value statistics of the elements of a page or of a column range.  They are only recorded for columns
+   /// of arithmetic type if RNTupleWriteOptions::GetEnablePageStatistics() is set.  NaN values are not taken into
+   /// account, so that a page consisting only of NaN values has an empty range (fMin > fMax).
+   struct RValueRange {
+      /// If false, nothing is known about the values
+      bool fIsValid = false;
+      double fMin = -std::numeric_limits<double>::infinity();
+      double fMax = std::numeric_limits<double>::infinity();
+
+      RValueRange() = default;
+      RValueRange(double min, double max) : fIsValid(true), fMin(min), fMax(max) {}
+
+      bool operator==(const RValueRange &other) const
+      {
+         return fIsValid == other.fIsValid && (!fIsValid || (fMin == other.fMin && fMax == other.fMax));
+      }
+      /// Widens the range such that it includes the other range; the result is invalid if either range is invalid
+      void Merge(const RValueRange &other)
+      {
+         fIsValid = fIsValid && other.fIsValid;
+         fMin = std::min(fMin, other.fMin);
+         fMax = std::max(fMax, other.fMax);
+      }
+      /// Returns false only if it is known that none of the values lie in [min, max]
+      bool Overlaps(double min, double max) const { return !fIsValid || (fMin <= max && fMax >= min); }
+   };
+
    /// The window of element indexes of a particular column in a particular cluster
    struct RColumnRange {
       DescriptorId_t fColumnId = kInvalidDescriptorId;
@@ -204,13 +232,13 @@ public:
       /// The usual format for ROOT compression settings (see Compression.h).
       /// The pages of a particular column in a particular cluster are all compressed with the same settings.
       std::int64_t fCompressionSettings = 0;
-
-      // TODO(jblomer): we perhaps want to store summary information, such as average, min/max, etc.
-      // Should this be done on the field level?
+      /// The union of the value ranges of the pages; only valid if all the pages have statistics
+      RValueRange fValueRange;
 
       bool operator==(const RColumnRange &other) const {
          return fColumnId == other.fColumnId && fFirstElementIndex == other.fFirstElementIndex &&
-                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings;
+                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings &&
+                fValueRange == other.fValueRange;
       }
 
       bool Contains(NTupleSize_t index) const {
@@ -227,9 +255,11 @@ public:
          ClusterSize_t fNElements = kInvalidClusterIndex;
          /// The meaning of fLocator depends on the storage backend.
          RNTupleLocator fLocator;
+         /// The range of the values in the page, if statistics are available
+         RValueRange fValueRange;
 
          bool operator==(const RPageInfo &other) const {
-            return fNElements == other.fNElements && fLocator == other.fLocator;
+            return fNElements == other.fNElements && fLocator == other.fLocator && fValueRange == other.fValueRange;
          }
       };
       struct RPageInfoExtended : RPageInfo {
@@ -706,6 +736,10 @@ public:
    DescriptorId_t FindClusterId(DescriptorId_t columnId, NTupleSize_t index) const;
    DescriptorId_t FindNextClusterId(DescriptorId_t clusterId) const;
    DescriptorId_t FindPrevClusterId(DescriptorId_t clusterId) const;
+   /// Returns the IDs of the clusters, ordered by entry number, whose value statistics of the principal column of
+   /// the given field allow for values in [min, max].  Clusters without statistics or without page locations are
+   /// always included.
+   std::vector<DescriptorId_t> FindClusterIdsInValueRange(DescriptorId_t fieldId, double min, double max) const;
 
    /// Walks up the parents of the field ID and returns a field name of the form a.b.c.d
    /// In case of invalid field ID, an empty string is returned.
@@ -976,6 +1010,8 @@ public:
    /// Used during writing. For reading, cluster summaries are added in the builder and cluster details are added
    /// on demand through the RNTupleDescriptor.
    RResult<void> AddClusterWithDetails(RClusterDescriptor &&clusterDesc);
+   /// Forgets the so-far stored clusters, e.g. in page sinks that hand over their clusters to another sink
+   void ClearClusters() { fDescriptor.fClusterDescriptors.clear(); }
 
    /// Clears so-far stored clusters, fields, and columns and return to a pristine ntuple descriptor
    void Reset();
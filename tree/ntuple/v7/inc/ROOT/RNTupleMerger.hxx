@@ -19,10 +19,16 @@
 #include <ROOT/RError.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
 
 namespace ROOT {
 namespace Experimental {
 
+namespace Detail {
+class RPageSink;
+class RPageSource;
+} // namespace Detail
+
 // clang-format off
 /**
 \class ROOT::Experimental::RFieldMerger
@@ -38,6 +44,27 @@ public:
    static RResult<RFieldMerger> Merge(const RFieldDescriptor &lhs, const RFieldDescriptor &rhs);
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleMerger
+\ingroup NTuple
+\brief Concatenates RNTuples with the same schema by copying their sealed pages
+
+The merger is the RNTuple counterpart of TTree fast cloning.  Every cluster of every source becomes a cluster of the
+destination.  The compressed pages of the sources are appended to the destination as they are, only the page
+locations and the cluster meta-data are rewritten.  Pages are decompressed and recompressed only if their
+compression settings differ from the compression settings of the destination.  The page value statistics of the
+sources are carried over.
+*/
+// clang-format on
+class RNTupleMerger {
+public:
+   /// Merges the given sources, in order, into the destination.  The sources must be attached and must all have
+   /// the schema of the first source.  The destination is created from the schema of the first source; it must not
+   /// have been created before.  Throws an RException if a source is incompatible.
+   void Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination);
+};
+
 } // namespace Experimental
 } // namespace ROOT
 
@@ -59,7 +59,23 @@ class RNTupleWriteOptions {
    /// fApproxUnzippedPageSize in size and tail pages (the last page in a cluster) is between
    /// fApproxUnzippedPageSize/2 and fApproxUnzippedPageSize * 1.5 in size.
    std::size_t fApproxUnzippedPageSize = 64 * 1024;
+   /// If set, the page sink adapts the page size of every column at each cluster boundary: pages of columns that
+   /// compress well grow (up to fMaxUnzippedPageSize) so that their compressed pages do not end up tiny, and pages
+   /// are never larger than the data the column fills into a single cluster.
+   bool fUseAdaptivePageSize = false;
+   /// Upper limit of the page size of a single column when adaptive page sizes are used
+   std::size_t fMaxUnzippedPageSize = 1024 * 1024;
+   /// Memory budget for the write pages of all the columns of a page sink.  If the page sizes of the columns
+   /// add up to more than the budget, all page sizes are scaled down proportionally.  Zero means no limit.
+   std::size_t fPageBufferBudget = 0;
    bool fUseBufferedWrite = true;
+   /// If set, the minimum and maximum value of every page of columns of arithmetic type are stored in the page list.
+   /// Readers can use these statistics to skip clusters, see RNTupleReader::GetEntryRanges().
+   bool fEnablePageStatistics = false;
+   /// If set, floating point, integer and collection offset columns are written in split encoding, which usually
+   /// compresses better.  Otherwise they are written in plain encoding: uncompressed pages of plain columns can be
+   /// used in place by readers that map the file, see RNTupleReadOptions::SetUseMmap().
+   bool fUseSplitEncoding = true;
 
 public:
    virtual ~RNTupleWriteOptions() = default;
@@ -83,8 +99,23 @@ public:
    std::size_t GetApproxUnzippedPageSize() const { return fApproxUnzippedPageSize; }
    void SetApproxUnzippedPageSize(std::size_t val);
 
+   bool GetUseAdaptivePageSize() const { return fUseAdaptivePageSize; }
+   void SetUseAdaptivePageSize(bool val) { fUseAdaptivePageSize = val; }
+
+   std::size_t GetMaxUnzippedPageSize() const { return fMaxUnzippedPageSize; }
+   void SetMaxUnzippedPageSize(std::size_t val);
+
+   std::size_t GetPageBufferBudget() const { return fPageBufferBudget; }
+   void SetPageBufferBudget(std::size_t val) { fPageBufferBudget = val; }
+
    bool GetUseBufferedWrite() const { return fUseBufferedWrite; }
    void SetUseBufferedWrite(bool val) { fUseBufferedWrite = val; }
+
+   bool GetEnablePageStatistics() const { return fEnablePageStatistics; }
+   void SetEnablePageStatistics(bool val) { fEnablePageStatistics = val; }
+
+   bool GetUseSplitEncoding() const { return fUseSplitEncoding; }
+   void SetUseSplitEncoding(bool val) { fUseSplitEncoding = val; }
 };
 
 // clang-format off
@@ -129,12 +160,22 @@ public:
 private:
    EClusterCache fClusterCache = EClusterCache::kDefault;
    unsigned int fClusterBunchSize = 1;
+   /// The number of cluster bunches that are read and unzipped ahead of the bunch containing the requested cluster
+   unsigned int fClusterPrefetchDepth = 1;
+   /// If the storage supports it, read through a memory mapping of the file instead of issuing read requests.
+   /// Pages of uncompressed columns whose on-disk layout is identical to the in-memory layout are then not copied.
+   /// For most column types, this requires the plain encoding, see RNTupleWriteOptions::SetUseSplitEncoding().
+   bool fUseMmap = false;
 
 public:
    EClusterCache GetClusterCache() const { return fClusterCache; }
    void SetClusterCache(EClusterCache val) { fClusterCache = val; }
    unsigned int GetClusterBunchSize() const  { return fClusterBunchSize; }
    void SetClusterBunchSize(unsigned int val) { fClusterBunchSize = val; }
+   unsigned int GetClusterPrefetchDepth() const { return fClusterPrefetchDepth; }
+   void SetClusterPrefetchDepth(unsigned int val) { fClusterPrefetchDepth = val; }
+   bool GetUseMmap() const { return fUseMmap; }
+   void SetUseMmap(bool val) { fUseMmap = val; }
 };
 
 } // namespace Experimental
@@ -0,0 +1,200 @@
+/// \file ROOT/RNTupleParallelWriter.hxx
+/// \ingroup NTuple ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RNTupleParallelWriter
+#define ROOT7_RNTupleParallelWriter
+
+#include <ROOT/RConfig.hxx> // for R__unlikely
+#include <ROOT/REntry.hxx>
+#include <ROOT/RError.hxx>
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+class TFile;
+
+namespace ROOT {
+namespace Experimental {
+
+namespace Detail {
+class RPageSink;
+} // namespace Detail
+
+class RNTupleParallelWriter;
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleFillContext
+\ingroup NTuple
+\brief A per-thread context to fill entries into an ntuple written by an RNTupleParallelWriter
+
+Every fill context owns a private clone of the writer's model and a private page sink that buffers and seals
+(packs and compresses) the pages of the currently open cluster.  Filling and sealing thus run without any
+synchronization.  Only when a cluster is committed, the already sealed pages of the entire cluster are handed over
+to the writer's shared page sink under a short lock.  Entries of a cluster are therefore always contiguous on disk
+but the order of clusters from different fill contexts is unspecified.
+
+A fill context must only be used by one thread at a time and it must be destructed before its parent writer.
+*/
+// clang-format on
+class RNTupleFillContext {
+   friend class RNTupleParallelWriter;
+
+private:
+   /// Buffers the sealed pages of the current cluster until they are committed to the shared sink
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// Needs to be destructed before fSink
+   std::unique_ptr<RNTupleModel> fModel;
+   /// The first top-level field of fModel.  The models of all the fill contexts of a writer are clones with the same
+   /// model id, so entries are also checked to use the fields of this context's model.
+   const Detail::RFieldBase *fFirstField = nullptr;
+   NTupleSize_t fLastCommitted = 0;
+   NTupleSize_t fNEntries = 0;
+   /// Keeps track of the number of bytes written into the current cluster
+   std::size_t fUnzippedClusterSize = 0;
+   /// The total number of bytes written to storage (i.e., after compression)
+   std::uint64_t fNBytesCommitted = 0;
+   /// The total number of bytes filled into all the so far committed clusters,
+   /// i.e. the uncompressed size of the written clusters
+   std::uint64_t fNBytesFilled = 0;
+   /// Limit for committing cluster no matter the other tunables
+   std::size_t fMaxUnzippedClusterSize;
+   /// Estimator of uncompressed cluster size, taking into account the estimated compression ratio
+   NTupleSize_t fUnzippedClusterSizeEst;
+
+   RNTupleFillContext(std::unique_ptr<RNTupleModel> model, RNTupleParallelWriter &writer);
+
+public:
+   RNTupleFillContext(const RNTupleFillContext &) = delete;
+   RNTupleFillContext &operator=(const RNTupleFillContext &) = delete;
+   ~RNTupleFillContext();
+
+   /// The simplest user interface if the default entry that comes with the context's model is used.
+   /// \return The number of uncompressed bytes written.
+   std::size_t Fill() { return Fill(*fModel->GetDefaultEntry()); }
+   /// Multiple entries can have been instantiated from the context's model.  This method will perform
+   /// a light check whether the entry comes from the ntuple's model.
+   /// \return The number of uncompressed bytes written.
+   std::size_t Fill(REntry &entry)
+   {
+      if (R__unlikely(entry.GetModelId() != fModel->GetModelId() ||
+                      (entry.begin() != entry.end() && entry.begin()->GetField() != fFirstField)))
+         throw RException(R__FAIL("mismatch between entry and model"));
+
+      std::size_t bytesWritten = 0;
+      for (auto &value : entry) {
+         bytesWritten += value.GetField()->Append(value);
+      }
+      fUnzippedClusterSize += bytesWritten;
+      fNEntries++;
+      if ((fUnzippedClusterSize >= fMaxUnzippedClusterSize) || (fUnzippedClusterSize >= fUnzippedClusterSizeEst))
+         CommitCluster();
+      return bytesWritten;
+   }
+   /// Seal the pages of the so far filled entries and append them as a new cluster to the shared page sink
+   void CommitCluster();
+
+   std::unique_ptr<REntry> CreateEntry() { return fModel->CreateEntry(); }
+
+   /// The number of entries filled through this context
+   NTupleSize_t GetNEntries() const { return fNEntries; }
+   const RNTupleModel *GetModel() const { return fModel.get(); }
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleParallelWriter
+\ingroup NTuple
+\brief An RNTuple that gets filled concurrently from multiple threads
+
+Each filling thread obtains its own RNTupleFillContext through CreateFillContext().  All the contexts append whole
+clusters to a single, shared page sink.  The shared sink only serializes the final write of already compressed
+clusters; packing and compression of the pages happen in the filling threads.  The fill contexts always buffer
+the sealed pages of a cluster, so the buffered write option (RNTupleWriteOptions::SetUseBufferedWrite()) has no effect.
+
+~~~ {.cpp}
+auto model = RNTupleModel::Create();
+model->MakeField<float>("pt");
+auto writer = RNTupleParallelWriter::Recreate(std::move(model), "myNTuple", "myFile.root");
+std::vector<std::thread> threads;
+for (int t = 0; t < 4; ++t) {
+   threads.emplace_back([&writer] {
+      auto context = writer->CreateFillContext();
+      auto entry = context->CreateEntry();
+      auto pt = entry->Get<float>("pt");
+      for (int i = 0; i < 1000; ++i) {
+         *pt = i;
+         context->Fill(*entry);
+      }
+   });
+}
+for (auto &t : threads)
+   t.join();
+~~~
+
+The data set is finalized when the writer is destructed.  At this point, all fill contexts must be gone.
+*/
+// clang-format on
+class RNTupleParallelWriter {
+   friend class RNTupleFillContext;
+
+private:
+   /// Serializes access to fSink and fNEntries from the fill contexts
+   std::mutex fMutex;
+   /// The shared, unbuffered page sink that writes the clusters committed by the fill contexts
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// The frozen prototype model, cloned for every fill context. Needs to be destructed before fSink.
+   std::unique_ptr<RNTupleModel> fModel;
+   Detail::RNTupleMetrics fMetrics;
+   /// The total number of entries committed to fSink by all the fill contexts
+   NTupleSize_t fNEntries = 0;
+
+public:
+   /// Throws an exception if the model is null.
+   static std::unique_ptr<RNTupleParallelWriter> Recreate(std::unique_ptr<RNTupleModel> model,
+                                                          std::string_view ntupleName, std::string_view storage,
+                                                          const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   /// Throws an exception if the model is null.
+   static std::unique_ptr<RNTupleParallelWriter> Append(std::unique_ptr<RNTupleModel> model,
+                                                        std::string_view ntupleName, TFile &file,
+                                                        const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   /// Throws an exception if the model or the sink is null.  The sink must not buffer pages itself; buffering
+   /// is provided by the fill contexts.
+   RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+   RNTupleParallelWriter(const RNTupleParallelWriter &) = delete;
+   RNTupleParallelWriter &operator=(const RNTupleParallelWriter &) = delete;
+   ~RNTupleParallelWriter();
+
+   /// Create a new fill context for the calling thread.  Thread-safe.
+   std::unique_ptr<RNTupleFillContext> CreateFillContext();
+
+   /// The number of entries committed so far by all the fill contexts.  Thread-safe.
+   NTupleSize_t GetNEntries();
+
+   void EnableMetrics() { fMetrics.Enable(); }
+   const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
+
+   const RNTupleModel *GetModel() const { return fModel.get(); }
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -65,6 +65,9 @@ public:
    static constexpr std::uint32_t kFlagSortDesColumn     = 0x02;
    static constexpr std::uint32_t kFlagNonNegativeColumn = 0x04;
 
+   /// Set in the optional flags at the end of a column's page list frame if it is followed by the page value ranges
+   static constexpr std::uint32_t kFlagPageValueRanges = 0x01;
+
    static constexpr DescriptorId_t kZeroFieldId = std::uint64_t(-2);
 
    struct REnvelopeLink {
@@ -161,6 +164,9 @@ public:
    static std::uint32_t DeserializeInt64(const void *buffer, std::int64_t &val);
    static std::uint32_t SerializeUInt64(std::uint64_t val, void *buffer);
    static std::uint32_t DeserializeUInt64(const void *buffer, std::uint64_t &val);
+   /// Doubles are stored as the little-endian 64bit integer of their IEEE 754 binary representation
+   static std::uint32_t SerializeDouble(double val, void *buffer);
+   static std::uint32_t DeserializeDouble(const void *buffer, double &val);
 
    static std::uint32_t SerializeString(const std::string &val, void *buffer);
    static RResult<std::uint32_t> DeserializeString(const void *buffer, std::uint32_t bufSize, std::string &val);
@@ -18,10 +18,14 @@
 
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <unordered_map>
@@ -145,7 +149,8 @@ The view owns a field and its underlying columns in order to fill an ntuple valu
 accessed by index. For top-level fields, the index refers to the entry number. Fields that are part of
 nested collections have global index numbers that are derived from their parent indexes.
 
-Fields of simple types with a Map() method will use that and thus expose zero-copy access.
+Fields of simple types with a Map() method will use that and thus expose zero-copy access.  For such fields,
+GetSpan() provides bulk access to a range of consecutive values, e.g. an entire page or cluster, in a single call.
 */
 // clang-format on
 template <typename T>
@@ -159,6 +164,9 @@ private:
    FieldT fField;
    /// Used as a Read() destination for fields that are not mappable
    Detail::RFieldValue fValue;
+   /// Used by GetSpan() to gather values of ranges that cross page boundaries
+   std::unique_ptr<T[]> fBulkBuffer;
+   std::size_t fBulkBufferSize = 0;
 
 public:
    RNTupleView(DescriptorId_t fieldId, Detail::RPageSource *pageSource)
@@ -218,6 +226,39 @@ public:
    MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
       return fField.MapV(clusterIndex, nItems);
    }
+
+   /// Returns the `count` consecutive values starting at `globalIndex` as a contiguous array.  If the range lies within
+   /// a single page, the span points directly into the page buffer (zero-copy); otherwise, the values of the touched
+   /// pages are gathered in a buffer owned by the view.  The span is valid until the next read through the view.
+   template <typename C = T>
+   typename std::enable_if_t<Internal::IsMappable<FieldT>::value, std::span<const C>>
+   GetSpan(NTupleSize_t globalIndex, NTupleSize_t count) {
+      if (count == 0)
+         return std::span<const C>();
+      if (globalIndex + count > fField.GetNElements())
+         throw RException(R__FAIL("range out of bounds: [" + std::to_string(globalIndex) + ", " +
+                                  std::to_string(globalIndex + count) + ")"));
+
+      NTupleSize_t nItems;
+      const C *values = fField.MapV(globalIndex, nItems);
+      if (nItems >= count)
+         return std::span<const C>(values, count);
+
+      if (fBulkBufferSize < count) {
+         fBulkBuffer = std::make_unique<C[]>(count);
+         fBulkBufferSize = count;
+      }
+      NTupleSize_t nCopied = 0;
+      while (true) {
+         const auto nBatch = std::min(nItems, count - nCopied);
+         std::copy(values, values + nBatch, fBulkBuffer.get() + nCopied);
+         nCopied += nBatch;
+         if (nCopied == count)
+            break;
+         values = fField.MapV(globalIndex + nCopied, nItems);
+      }
+      return std::span<const C>(fBulkBuffer.get(), count);
+   }
 };
 
 
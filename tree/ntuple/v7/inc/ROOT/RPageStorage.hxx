@@ -87,6 +87,8 @@ public:
       const void *fBuffer = nullptr;
       std::uint32_t fSize = 0;
       std::uint32_t fNElements = 0;
+      /// Set by page sinks that record page statistics, see RNTupleWriteOptions::SetEnablePageStatistics()
+      RClusterDescriptor::RValueRange fValueRange;
 
       RSealedPage() = default;
       RSealedPage(const void *b, std::uint32_t s, std::uint32_t n) : fBuffer(b), fSize(s), fNElements(n) {}
@@ -167,6 +169,16 @@ up to the given entry number are committed.
 */
 // clang-format on
 class RPageSink : public RPageStorage {
+public:
+   /// The amount of data committed for a column in the currently open cluster
+   struct RColumnWriteStats {
+      std::uint64_t fNElements = 0;
+      /// Only known for pages committed through CommitPage()
+      std::uint64_t fNBytesUnzipped = 0;
+      /// Only known if the concrete page sink provides the size of the written pages
+      std::uint64_t fNBytesZipped = 0;
+   };
+
 private:
    /// Used to map the IDs of the descriptor to the physical IDs issued during header/footer serialization
    Internal::RNTupleSerializer::RContext fSerializationContext;
@@ -200,6 +212,10 @@ protected:
    std::vector<RClusterDescriptor::RColumnRange> fOpenColumnRanges;
    /// Keeps track of the written pages in the currently open cluster. Indexed by column id.
    std::vector<RClusterDescriptor::RPageRange> fOpenPageRanges;
+   /// Keeps track of the written bytes in the currently open cluster. Indexed by column id.
+   std::vector<RColumnWriteStats> fColumnWriteStats;
+   /// The current target page size in bytes. Indexed by column id.
+   std::vector<std::size_t> fUnzippedPageSizes;
    RNTupleDescriptorBuilder fDescriptorBuilder;
 
    virtual void CreateImpl(const RNTupleModel &model, unsigned char *serializedHeader, std::uint32_t length) = 0;
@@ -231,6 +247,10 @@ protected:
    static RSealedPage SealPage(const RPage &page, const RColumnElementBase &element,
       int compressionSetting, void *buf);
 
+   /// Returns the value statistics of the given in-memory page if page statistics are enabled in the write options
+   /// and the column is of arithmetic type; otherwise returns an invalid range.
+   RClusterDescriptor::RValueRange GetValueRange(ColumnHandle_t columnHandle, const RPage &page) const;
+
    /// Enables the default set of metrics provided by RPageSink. `prefix` will be used as the prefix for
    /// the counters registered in the internal RNTupleMetrics object.
    /// This set of counters can be extended by a subclass by calling `fMetrics.MakeCounter<...>()`.
@@ -242,6 +262,10 @@ protected:
    /// GetMetrics() member function.
    void EnableDefaultMetrics(const std::string &prefix);
 
+   /// Recalculates the target page sizes of the columns from the statistics of the cluster that has just been
+   /// committed, according to the adaptive page size and page buffer budget settings of the write options.
+   void UpdatePageSizes();
+
 public:
    RPageSink(std::string_view ntupleName, const RNTupleWriteOptions &options);
 
@@ -257,10 +281,21 @@ public:
    EPageStorageType GetType() final { return EPageStorageType::kSink; }
    /// Returns the sink's write options.
    const RNTupleWriteOptions &GetWriteOptions() const { return *fOptions; }
+   /// Returns the descriptor of the data written so far; the schema is known after Create()
+   const RNTupleDescriptor &GetDescriptor() const { return fDescriptorBuilder.GetDescriptor(); }
 
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
    void DropColumn(ColumnHandle_t /*columnHandle*/) final {}
 
+   /// Returns the number of elements that the pages of the given column should contain. Unless adaptive page sizes
+   /// or a page buffer budget are used, the target is given by the approximate unzipped page size of the write
+   /// options. The target may change after every committed cluster; it is at least 2.
+   std::uint32_t GetApproxNElementsPerPage(ColumnHandle_t columnHandle) const;
+   const RColumnWriteStats &GetColumnWriteStats(DescriptorId_t columnId) const
+   {
+      return fColumnWriteStats.at(columnId);
+   }
+
    /// Physically creates the storage container to hold the ntuple (e.g., a keys a TFile or an S3 bucket)
    /// To do so, Create() calls CreateImpl() after updating the descriptor.
    /// Create() associates column handles to the columns referenced by the model
@@ -381,7 +416,9 @@ protected:
    std::unique_ptr<RNTupleDecompressor> fDecompressor;
 
    virtual RNTupleDescriptor AttachImpl() = 0;
-   // Only called if a task scheduler is set. No-op be default.
+   // Only called if a task scheduler is set. No-op be default.  Implementations add the unzip tasks for the
+   // pages of the cluster to fTaskScheduler; resetting and waiting for the task scheduler is done by the caller,
+   // so that the pages of several clusters can be unzipped concurrently.
    virtual void UnzipClusterImpl(RCluster * /* cluster */)
       { }
 
@@ -459,13 +496,26 @@ public:
    /// LoadClusters() is typically called from the I/O thread of a cluster pool, i.e. the method runs
    /// concurrently to other methods of the page source.
    virtual std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) = 0;
+   /// Receives the clusters from StreamClusters(); the first argument is the index of the cluster in the request
+   using ClusterCallback_t = std::function<void(std::size_t, std::unique_ptr<RCluster>)>;
+   /// Like LoadClusters() but hands over every cluster through the callback as soon as its pages are read, in the
+   /// order of `clusterKeys`.  That allows the caller to decompress a cluster while the reads of the following
+   /// clusters are still in flight.  The default implementation calls LoadClusters() and passes on the result.
+   virtual void StreamClusters(std::span<RCluster::RKey> clusterKeys, const ClusterCallback_t &callback);
 
    /// Parallel decompression and unpacking of the pages in the given cluster. The unzipped pages are supposed
    /// to be preloaded in a page pool attached to the source. The method is triggered by the cluster pool's
    /// unzip thread. It is an optional optimization, the method can safely do nothing. In particular, the
    /// actual implementation will only run if a task scheduler is set. In practice, a task scheduler is set
    /// if implicit multi-threading is turned on.
-   void UnzipCluster(RCluster *cluster);
+   void UnzipCluster(RCluster *cluster) { UnzipClusters(std::span<RCluster *>(&cluster, 1)); }
+   /// Called with the index of a cluster passed to UnzipClusters() once all of its pages are in the page pool
+   using UnzipCallback_t = std::function<void(std::size_t)>;
+   /// Like UnzipCluster() for several clusters at once.  The pages of all the given clusters are decompressed
+   /// concurrently; the method returns when all of them are in the page pool.  If given, `onClusterUnzipped` is
+   /// called for every cluster as soon as the cluster is ready, possibly from one of the unzip tasks, so that the
+   /// caller does not need to wait for the whole batch.
+   void UnzipClusters(std::span<RCluster *> clusters, const UnzipCallback_t &onClusterUnzipped = UnzipCallback_t());
 
    /// Returns the default metrics object.  Subclasses might alternatively override the method and provide their own metrics object.
    RNTupleMetrics &GetMetrics() override { return fMetrics; };
@@ -65,8 +65,9 @@ private:
    std::uint64_t fNBytesCurrentCluster = 0;
    RPageSinkFile(std::string_view ntupleName, const RNTupleWriteOptions &options);
 
+   /// Uncompressed pages are aligned to the given alignment in the file so that they can be mapped
    RNTupleLocator WriteSealedPage(const RPageStorage::RSealedPage &sealedPage,
-                                                std::size_t bytesPacked);
+                                                std::size_t bytesPacked, std::size_t alignment = 1);
 
 protected:
    void CreateImpl(const RNTupleModel &model, unsigned char *serializedHeader, std::uint32_t length) final;
@@ -139,6 +140,15 @@ private:
    Internal::RMiniFileReader fReader;
    /// The descriptor is created from the header and footer either in AttachImpl or in CreateFromAnchor
    RNTupleDescriptorBuilder fDescriptorBuilder;
+   /// The read-only memory mapping of the entire file, used if RNTupleReadOptions::GetUseMmap() is set and fFile
+   /// supports it.  Clusters and pages may point into the mapping, so it is unmapped after the cluster pool is gone.
+   struct RFileMapping {
+      ROOT::Internal::RRawFile *fFile = nullptr;
+      unsigned char *fAddress = nullptr;
+      std::size_t fSize = 0;
+      ~RFileMapping();
+   };
+   std::unique_ptr<RFileMapping> fMapping;
    /// The cluster pool asynchronously preloads the next few clusters
    std::unique_ptr<RClusterPool> fClusterPool;
 
@@ -151,6 +161,11 @@ private:
                                                             std::string_view path, const RNTupleReadOptions &options);
    RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterInfo &clusterInfo,
                                  ClusterSize_t::ValueType idxInCluster);
+   /// In mmap mode, pages of uncompressed, mappable columns are not unsealed but point directly into the file
+   /// mapping.  Returns a null page if the on-disk page cannot be used as-is.
+   RPage MapSealedPage(ColumnId_t columnId, const RSealedPage &sealedPage, const RColumnElementBase &element);
+   /// In mmap mode, the on-disk pages of a cluster are registered with their address in the file mapping
+   std::unique_ptr<RCluster> PrepareMappedCluster(const RCluster::RKey &clusterKey);
 
    /// Helper function for LoadClusters: it prepares the memory buffer (page map) and the
    /// read requests for a given cluster and columns.  The reead requests are appended to
@@ -184,6 +199,8 @@ public:
                        RSealedPage &sealedPage) final;
 
    std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) final;
+   /// If the file supports asynchronous I/O, the vector reads of all the clusters are submitted at once
+   void StreamClusters(std::span<RCluster::RKey> clusterKeys, const ClusterCallback_t &callback) final;
 };
 
 
@@ -49,10 +49,12 @@ bool ROOT::Experimental::Detail::RClusterPool::RInFlightCluster::operator <(cons
    return fClusterKey.fClusterId < other.fClusterKey.fClusterId;
 }
 
-ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize)
+ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize,
+                                                       unsigned int prefetchDepth)
    : fPageSource(pageSource)
    , fClusterBunchSize(clusterBunchSize)
-   , fPool(2 * clusterBunchSize)
+   , fPrefetchDepth(prefetchDepth)
+   , fPool((1 + prefetchDepth) * clusterBunchSize)
    , fThreadIo(&RClusterPool::ExecReadClusters, this)
    , fThreadUnzip(&RClusterPool::ExecUnzipClusters, this)
 {
@@ -91,15 +93,27 @@ void ROOT::Experimental::Detail::RClusterPool::ExecUnzipClusters()
          }
       }
 
+      // The unzip work of all the clusters that piled up is submitted as a single batch.  That gives the task
+      // scheduler enough pages to keep all cores busy even if the individual clusters are small.
+      bool isShutdown = false;
+      std::vector<RCluster *> clusters;
       for (auto &item : unzipItems) {
-         if (!item.fCluster)
-            return;
-
-         fPageSource.UnzipCluster(item.fCluster.get());
+         if (!item.fCluster) {
+            isShutdown = true;
+            break;
+         }
+         clusters.emplace_back(item.fCluster.get());
+      }
 
+      // Every cluster is handed over as soon as its own pages are unzipped, not only once the whole batch is done.
+      // The promises of different clusters may be fulfilled concurrently from the unzip tasks.
+      fPageSource.UnzipClusters(clusters, [&unzipItems](std::size_t i) {
          // Afterwards the GetCluster() method in the main thread can pick-up the cluster
-         item.fPromise.set_value(std::move(item.fCluster));
-      }
+         unzipItems[i].fPromise.set_value(std::move(unzipItems[i].fCluster));
+      });
+
+      if (isShutdown)
+         return;
    } // while (true)
 }
 
@@ -127,31 +141,31 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
          }
       }
 
-      auto clusters = fPageSource.LoadClusters(clusterKeys);
-
-      for (std::size_t i = 0; i < clusters.size(); ++i) {
+      // Every cluster is handed over to the unzip thread as soon as it is read, so that decompression overlaps
+      // with the I/O of the remaining clusters of the bunch
+      fPageSource.StreamClusters(clusterKeys, [&](std::size_t i, std::unique_ptr<RCluster> cluster) {
          // Meanwhile, the user might have requested clusters outside the look-ahead window, so that we don't
          // need the cluster anymore, in which case we simply discard it right away, before moving it to the pool
          bool discard = false;
          {
             std::unique_lock<std::mutex> lock(fLockWorkQueue);
             for (auto &inFlight : fInFlightClusters) {
-               if (inFlight.fClusterKey.fClusterId != clusters[i]->GetId())
+               if (inFlight.fClusterKey.fClusterId != cluster->GetId())
                   continue;
                discard = inFlight.fIsExpired;
                break;
             }
          }
          if (discard) {
-            clusters[i].reset();
-            readItems[i].fPromise.set_value(std::move(clusters[i]));
+            cluster.reset();
+            readItems[i].fPromise.set_value(std::move(cluster));
          } else {
             // Hand-over the loaded cluster pages to the unzip thread
             std::unique_lock<std::mutex> lock(fLockUnzipQueue);
-            fUnzipQueue.emplace(RUnzipItem{std::move(clusters[i]), std::move(readItems[i].fPromise)});
+            fUnzipQueue.emplace(RUnzipItem{std::move(cluster), std::move(readItems[i].fPromise)});
             fCvHasUnzipWork.notify_one();
          }
-      }
+      });
    } // while (true)
 }
 
@@ -254,8 +268,8 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(
       provideInfo.fColumnSet = columns;
       provideInfo.fBunchId = fBunchId;
       provideInfo.fFlags = RProvides::kFlagRequired;
-      for (DescriptorId_t i = 0, next = clusterId; i < 2 * fClusterBunchSize; ++i) {
-         if (i == fClusterBunchSize)
+      for (DescriptorId_t i = 0, next = clusterId; i < (1 + fPrefetchDepth) * fClusterBunchSize; ++i) {
+         if ((i > 0) && (i % fClusterBunchSize == 0))
             provideInfo.fBunchId = ++fBunchId;
 
          auto cid = next;
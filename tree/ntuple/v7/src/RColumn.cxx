@@ -46,9 +46,9 @@ void ROOT::Experimental::Detail::RColumn::Connect(DescriptorId_t fieldId, RPageS
    case EPageStorageType::kSink:
       fPageSink = static_cast<RPageSink*>(pageStorage); // the page sink initializes fWritePage on AddColumn
       fHandleSink = fPageSink->AddColumn(fieldId, *this);
-      fApproxNElementsPerPage = fPageSink->GetWriteOptions().GetApproxUnzippedPageSize() / fElement->GetSize();
-      if (fApproxNElementsPerPage < 2)
+      if (fPageSink->GetWriteOptions().GetApproxUnzippedPageSize() / fElement->GetSize() < 2)
          throw RException(R__FAIL("page size too small for writing"));
+      fApproxNElementsPerPage = fPageSink->GetApproxNElementsPerPage(fHandleSink);
       // We now have 0 < fApproxNElementsPerPage / 2 < fApproxNElementsPerPage
       fWritePage[0] = fPageSink->ReservePage(fHandleSink, fApproxNElementsPerPage + fApproxNElementsPerPage / 2);
       fWritePage[1] = fPageSink->ReservePage(fHandleSink, fApproxNElementsPerPage + fApproxNElementsPerPage / 2);
@@ -70,8 +70,11 @@ void ROOT::Experimental::Detail::RColumn::Flush()
    if (fWritePage[fWritePageIdx].IsEmpty() && fWritePage[otherIdx].IsEmpty())
       return;
 
-   if ((fWritePage[fWritePageIdx].GetNElements() < fApproxNElementsPerPage / 2) && !fWritePage[otherIdx].IsEmpty()) {
-      // Small tail page: merge with previously used page; we know that there is enough space in the shadow page
+   if ((fWritePage[fWritePageIdx].GetNElements() < fApproxNElementsPerPage / 2) && !fWritePage[otherIdx].IsEmpty() &&
+       (fWritePage[otherIdx].GetNElements() + fWritePage[fWritePageIdx].GetNElements() <=
+        fWritePage[otherIdx].GetMaxElements())) {
+      // Small tail page: merge with previously used page.  Unless the target page size changed in between,
+      // there is enough space in the shadow page.
       void *dst = fWritePage[otherIdx].GrowUnchecked(fWritePage[fWritePageIdx].GetNElements());
       RColumnElementBase elem(fWritePage[fWritePageIdx].GetBuffer(), fWritePage[fWritePageIdx].GetElementSize());
       elem.WriteTo(dst, fWritePage[fWritePageIdx].GetNElements());
@@ -79,11 +82,31 @@ void ROOT::Experimental::Detail::RColumn::Flush()
       std::swap(fWritePageIdx, otherIdx);
    }
 
-   R__ASSERT(fWritePage[otherIdx].IsEmpty());
+   if (!fWritePage[otherIdx].IsEmpty()) {
+      // Only if the shadow page was too small to take the tail page
+      fPageSink->CommitPage(fHandleSink, fWritePage[otherIdx]);
+      fWritePage[otherIdx].Reset(0);
+   }
    fPageSink->CommitPage(fHandleSink, fWritePage[fWritePageIdx]);
    fWritePage[fWritePageIdx].Reset(fNElements);
 }
 
+void ROOT::Experimental::Detail::RColumn::UpdateWritePageSize()
+{
+   R__ASSERT(fWritePage[0].IsEmpty() && fWritePage[1].IsEmpty());
+   fApproxNElementsPerPage = fPageSink->GetApproxNElementsPerPage(fHandleSink);
+   for (int idx : {0, 1}) {
+      if (fWritePage[idx].GetMaxElements() != fApproxNElementsPerPage + fApproxNElementsPerPage / 2)
+         ResizeWritePage(idx);
+   }
+}
+
+void ROOT::Experimental::Detail::RColumn::ResizeWritePage(int idx)
+{
+   fPageSink->ReleasePage(fWritePage[idx]);
+   fWritePage[idx] = fPageSink->ReservePage(fHandleSink, fApproxNElementsPerPage + fApproxNElementsPerPage / 2);
+}
+
 void ROOT::Experimental::Detail::RColumn::MapPage(const NTupleSize_t index)
 {
    fPageSource->ReleasePage(fReadPage);
@@ -23,6 +23,124 @@
 #include <memory>
 #include <utility>
 
+namespace {
+
+/// Calls `fn` with a value-initialized unsigned integer of the given size; the type of the integer selects the kernel
+template <typename FnT>
+void DispatchOnElementSize(std::size_t elementSize, FnT &&fn)
+{
+   switch (elementSize) {
+   case 2: fn(std::uint16_t{}); break;
+   case 4: fn(std::uint32_t{}); break;
+   case 8: fn(std::uint64_t{}); break;
+   default: R__ASSERT(false);
+   }
+}
+
+/// Writes the bytes of the encoded elements into sizeof(UIntT) byte streams, least significant byte first.
+/// The loops run over contiguous memory in the inner loop and the encoding is inlined, so that the compiler
+/// can vectorize them.
+template <typename UIntT, typename EncodeT>
+void SplitEncode(unsigned char *dst, const UIntT *src, std::size_t count, EncodeT encode)
+{
+   for (std::size_t b = 0; b < sizeof(UIntT); ++b) {
+      unsigned char *stream = dst + b * count;
+      for (std::size_t i = 0; i < count; ++i)
+         stream[i] = static_cast<unsigned char>(encode(src, i) >> (8 * b));
+   }
+}
+
+/// Reassembles the elements from sizeof(UIntT) byte streams, least significant byte first
+template <typename UIntT>
+void SplitDecode(UIntT *dst, const unsigned char *src, std::size_t count)
+{
+   std::fill(dst, dst + count, UIntT(0));
+   for (std::size_t b = 0; b < sizeof(UIntT); ++b) {
+      const unsigned char *stream = src + b * count;
+      for (std::size_t i = 0; i < count; ++i)
+         dst[i] |= static_cast<UIntT>(static_cast<UIntT>(stream[i]) << (8 * b));
+   }
+}
+
+/// Maps signed integers (interpreted as two's complement) to unsigned integers such that small absolute values
+/// have small representations: 0 --> 0, -1 --> 1, 1 --> 2, -2 --> 3, ...
+template <typename UIntT>
+UIntT ZigzagEncode(UIntT x)
+{
+   constexpr auto kBits = 8 * sizeof(UIntT);
+   return static_cast<UIntT>(static_cast<UIntT>(x << 1) ^ static_cast<UIntT>(UIntT(0) - (x >> (kBits - 1))));
+}
+
+template <typename UIntT>
+UIntT ZigzagDecode(UIntT x)
+{
+   return static_cast<UIntT>((x >> 1) ^ static_cast<UIntT>(UIntT(0) - (x & 1)));
+}
+
+} // anonymous namespace
+
+void ROOT::Experimental::Detail::SplitPack(void *dst, const void *src, std::size_t count, std::size_t elementSize)
+{
+   DispatchOnElementSize(elementSize, [&](auto tag) {
+      using UIntT = decltype(tag);
+      SplitEncode(reinterpret_cast<unsigned char *>(dst), reinterpret_cast<const UIntT *>(src), count,
+                  [](const UIntT *v, std::size_t i) { return v[i]; });
+   });
+}
+
+void ROOT::Experimental::Detail::SplitUnpack(void *dst, const void *src, std::size_t count, std::size_t elementSize)
+{
+   DispatchOnElementSize(elementSize, [&](auto tag) {
+      using UIntT = decltype(tag);
+      SplitDecode(reinterpret_cast<UIntT *>(dst), reinterpret_cast<const unsigned char *>(src), count);
+   });
+}
+
+void ROOT::Experimental::Detail::ZigzagSplitPack(void *dst, const void *src, std::size_t count,
+                                                 std::size_t elementSize)
+{
+   DispatchOnElementSize(elementSize, [&](auto tag) {
+      using UIntT = decltype(tag);
+      SplitEncode(reinterpret_cast<unsigned char *>(dst), reinterpret_cast<const UIntT *>(src), count,
+                  [](const UIntT *v, std::size_t i) { return ZigzagEncode(v[i]); });
+   });
+}
+
+void ROOT::Experimental::Detail::ZigzagSplitUnpack(void *dst, const void *src, std::size_t count,
+                                                   std::size_t elementSize)
+{
+   DispatchOnElementSize(elementSize, [&](auto tag) {
+      using UIntT = decltype(tag);
+      auto values = reinterpret_cast<UIntT *>(dst);
+      SplitDecode(values, reinterpret_cast<const unsigned char *>(src), count);
+      for (std::size_t i = 0; i < count; ++i)
+         values[i] = ZigzagDecode(values[i]);
+   });
+}
+
+void ROOT::Experimental::Detail::DeltaSplitPack(void *dst, const void *src, std::size_t count,
+                                                std::size_t elementSize)
+{
+   DispatchOnElementSize(elementSize, [&](auto tag) {
+      using UIntT = decltype(tag);
+      // Differences are computed modulo 2^n, so the encoding is lossless for unsorted input, too
+      SplitEncode(reinterpret_cast<unsigned char *>(dst), reinterpret_cast<const UIntT *>(src), count,
+                  [](const UIntT *v, std::size_t i) { return static_cast<UIntT>((i == 0) ? v[0] : v[i] - v[i - 1]); });
+   });
+}
+
+void ROOT::Experimental::Detail::DeltaSplitUnpack(void *dst, const void *src, std::size_t count,
+                                                  std::size_t elementSize)
+{
+   DispatchOnElementSize(elementSize, [&](auto tag) {
+      using UIntT = decltype(tag);
+      auto values = reinterpret_cast<UIntT *>(dst);
+      SplitDecode(values, reinterpret_cast<const unsigned char *>(src), count);
+      for (std::size_t i = 1; i < count; ++i)
+         values[i] += values[i - 1];
+   });
+}
+
 std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase>
 ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
    switch (type) {
@@ -48,6 +166,18 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
       return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kIndex>>(nullptr);
    case EColumnType::kSwitch:
       return std::make_unique<RColumnElement<RColumnSwitch, EColumnType::kSwitch>>(nullptr);
+   case EColumnType::kSplitIndex32:
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kSplitIndex32>>(nullptr);
+   case EColumnType::kSplitReal64:
+      return std::make_unique<RColumnElement<double, EColumnType::kSplitReal64>>(nullptr);
+   case EColumnType::kSplitReal32:
+      return std::make_unique<RColumnElement<float, EColumnType::kSplitReal32>>(nullptr);
+   case EColumnType::kSplitInt64:
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kSplitInt64>>(nullptr);
+   case EColumnType::kSplitInt32:
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kSplitInt32>>(nullptr);
+   case EColumnType::kSplitInt16:
+      return std::make_unique<RColumnElement<std::int16_t, EColumnType::kSplitInt16>>(nullptr);
    default:
       R__ASSERT(false);
    }
@@ -79,6 +209,18 @@ std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(ECo
       return 32;
    case EColumnType::kSwitch:
       return 64;
+   case EColumnType::kSplitIndex32:
+      return 32;
+   case EColumnType::kSplitReal64:
+      return 64;
+   case EColumnType::kSplitReal32:
+      return 32;
+   case EColumnType::kSplitInt64:
+      return 64;
+   case EColumnType::kSplitInt32:
+      return 32;
+   case EColumnType::kSplitInt16:
+      return 16;
    default:
       R__ASSERT(false);
    }
@@ -110,6 +252,18 @@ std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnT
       return "Index";
    case EColumnType::kSwitch:
       return "Switch";
+   case EColumnType::kSplitIndex32:
+      return "SplitIndex32";
+   case EColumnType::kSplitReal64:
+      return "SplitReal64";
+   case EColumnType::kSplitReal32:
+      return "SplitReal32";
+   case EColumnType::kSplitInt64:
+      return "SplitInt64";
+   case EColumnType::kSplitInt32:
+      return "SplitInt32";
+   case EColumnType::kSplitInt16:
+      return "SplitInt16";
    default:
       return "UNKNOWN";
    }
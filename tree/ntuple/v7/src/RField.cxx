@@ -173,6 +173,27 @@ std::tuple<void **, std::int32_t *, std::int32_t *> GetRVecDataMembers(void *rve
    return {begin, size, capacity};
 }
 
+/// Creates a column for the C++ type `CppT` either in split encoding (the default for writing) or in plain encoding.
+/// Both representations are supported for reading.
+template <typename CppT, ROOT::Experimental::EColumnType SplitT, ROOT::Experimental::EColumnType PlainT>
+std::unique_ptr<ROOT::Experimental::Detail::RColumn>
+CreateSplitOrPlainColumn(ROOT::Experimental::EColumnType type, bool isSorted, std::uint32_t index)
+{
+   using ROOT::Experimental::Detail::RColumn;
+   ROOT::Experimental::RColumnModel model(type, isSorted);
+   if (type == SplitT)
+      return std::unique_ptr<RColumn>(RColumn::Create<CppT, SplitT>(model, index));
+   return std::unique_ptr<RColumn>(RColumn::Create<CppT, PlainT>(model, index));
+}
+
+/// The principal column of collections, which is sorted within a cluster
+std::unique_ptr<ROOT::Experimental::Detail::RColumn> CreateIndexColumn(ROOT::Experimental::EColumnType type)
+{
+   using EColumnType = ROOT::Experimental::EColumnType;
+   return CreateSplitOrPlainColumn<ROOT::Experimental::ClusterSize_t, EColumnType::kSplitIndex32,
+                                   EColumnType::kIndex>(type, true /* isSorted */, 0);
+}
+
 } // anonymous namespace
 
 
@@ -420,6 +441,7 @@ void ROOT::Experimental::Detail::RFieldBase::RemoveReadCallback(size_t idx)
 void ROOT::Experimental::Detail::RFieldBase::ConnectPageSink(RPageSink &pageSink)
 {
    R__ASSERT(fColumns.empty());
+   fUseSplitEncoding = pageSink.GetWriteOptions().GetUseSplitEncoding();
    GenerateColumnsImpl();
    if (!fColumns.empty())
       fPrincipalColumn = fColumns[0].get();
@@ -428,6 +450,13 @@ void ROOT::Experimental::Detail::RFieldBase::ConnectPageSink(RPageSink &pageSink
 }
 
 
+void ROOT::Experimental::Detail::RFieldBase::UpdateWritePageSizes()
+{
+   for (auto &column : fColumns)
+      column->UpdateWritePageSize();
+}
+
+
 void ROOT::Experimental::Detail::RFieldBase::ConnectPageSource(RPageSource &pageSource)
 {
    R__ASSERT(fColumns.empty());
@@ -511,15 +540,13 @@ void ROOT::Experimental::RFieldZero::AcceptVisitor(Detail::RFieldVisitor &visito
 
 void ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(model, 0)));
+   fColumns.emplace_back(CreateIndexColumn(fUseSplitEncoding ? EColumnType::kSplitIndex32 : EColumnType::kIndex));
 }
 
 void ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kSplitIndex32, EColumnType::kIndex}, 0, desc);
+   fColumns.emplace_back(CreateIndexColumn(type));
 }
 
 void ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -613,15 +640,15 @@ void ROOT::Experimental::RField<bool>::AcceptVisitor(Detail::RFieldVisitor &visi
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kReal32, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<float, EColumnType::kReal32>(model, 0)));
+   fColumns.emplace_back(CreateSplitOrPlainColumn<float, EColumnType::kSplitReal32, EColumnType::kReal32>(
+      fUseSplitEncoding ? EColumnType::kSplitReal32 : EColumnType::kReal32, false /* isSorted*/, 0));
 }
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kReal32}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kSplitReal32, EColumnType::kReal32}, 0, desc);
+   fColumns.emplace_back(CreateSplitOrPlainColumn<float, EColumnType::kSplitReal32, EColumnType::kReal32>(
+      type, false /* isSorted*/, 0));
 }
 
 void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -634,15 +661,15 @@ void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &vis
 
 void ROOT::Experimental::RField<double>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kReal64, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<double, EColumnType::kReal64>(model, 0)));
+   fColumns.emplace_back(CreateSplitOrPlainColumn<double, EColumnType::kSplitReal64, EColumnType::kReal64>(
+      fUseSplitEncoding ? EColumnType::kSplitReal64 : EColumnType::kReal64, false /* isSorted*/, 0));
 }
 
 void ROOT::Experimental::RField<double>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kReal64}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kSplitReal64, EColumnType::kReal64}, 0, desc);
+   fColumns.emplace_back(CreateSplitOrPlainColumn<double, EColumnType::kSplitReal64, EColumnType::kReal64>(
+      type, false /* isSorted*/, 0));
 }
 
 void ROOT::Experimental::RField<double>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -654,15 +681,15 @@ void ROOT::Experimental::RField<double>::AcceptVisitor(Detail::RFieldVisitor &vi
 
 void ROOT::Experimental::RField<std::int16_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt16, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
-      std::int16_t, EColumnType::kInt16>(model, 0)));
+   fColumns.emplace_back(CreateSplitOrPlainColumn<std::int16_t, EColumnType::kSplitInt16, EColumnType::kInt16>(
+      fUseSplitEncoding ? EColumnType::kSplitInt16 : EColumnType::kInt16, false /* isSorted*/, 0));
 }
 
 void ROOT::Experimental::RField<std::int16_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt16}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kSplitInt16, EColumnType::kInt16}, 0, desc);
+   fColumns.emplace_back(CreateSplitOrPlainColumn<std::int16_t, EColumnType::kSplitInt16, EColumnType::kInt16>(
+      type, false /* isSorted*/, 0));
 }
 
 void ROOT::Experimental::RField<std::int16_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -674,15 +701,15 @@ void ROOT::Experimental::RField<std::int16_t>::AcceptVisitor(Detail::RFieldVisit
 
 void ROOT::Experimental::RField<std::uint16_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt16, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
-      std::uint16_t, EColumnType::kInt16>(model, 0)));
+   fColumns.emplace_back(CreateSplitOrPlainColumn<std::uint16_t, EColumnType::kSplitInt16, EColumnType::kInt16>(
+      fUseSplitEncoding ? EColumnType::kSplitInt16 : EColumnType::kInt16, false /* isSorted*/, 0));
 }
 
 void ROOT::Experimental::RField<std::uint16_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt16}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kSplitInt16, EColumnType::kInt16}, 0, desc);
+   fColumns.emplace_back(CreateSplitOrPlainColumn<std::uint16_t, EColumnType::kSplitInt16, EColumnType::kInt16>(
+      type, false /* isSorted*/, 0));
 }
 
 void ROOT::Experimental::RField<std::uint16_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -694,15 +721,15 @@ void ROOT::Experimental::RField<std::uint16_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::int32_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt32, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
-      std::int32_t, EColumnType::kInt32>(model, 0)));
+   fColumns.emplace_back(CreateSplitOrPlainColumn<std::int32_t, EColumnType::kSplitInt32, EColumnType::kInt32>(
+      fUseSplitEncoding ? EColumnType::kSplitInt32 : EColumnType::kInt32, false /* isSorted*/, 0));
 }
 
 void ROOT::Experimental::RField<std::int32_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt32}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kSplitInt32, EColumnType::kInt32}, 0, desc);
+   fColumns.emplace_back(CreateSplitOrPlainColumn<std::int32_t, EColumnType::kSplitInt32, EColumnType::kInt32>(
+      type, false /* isSorted*/, 0));
 }
 
 void ROOT::Experimental::RField<std::int32_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -714,15 +741,15 @@ void ROOT::Experimental::RField<std::int32_t>::AcceptVisitor(Detail::RFieldVisit
 
 void ROOT::Experimental::RField<std::uint32_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt32, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<std::uint32_t, EColumnType::kInt32>(model, 0)));
+   fColumns.emplace_back(CreateSplitOrPlainColumn<std::uint32_t, EColumnType::kSplitInt32, EColumnType::kInt32>(
+      fUseSplitEncoding ? EColumnType::kSplitInt32 : EColumnType::kInt32, false /* isSorted*/, 0));
 }
 
 void ROOT::Experimental::RField<std::uint32_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt32}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kSplitInt32, EColumnType::kInt32}, 0, desc);
+   fColumns.emplace_back(CreateSplitOrPlainColumn<std::uint32_t, EColumnType::kSplitInt32, EColumnType::kInt32>(
+      type, false /* isSorted*/, 0));
 }
 
 void ROOT::Experimental::RField<std::uint32_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -734,15 +761,15 @@ void ROOT::Experimental::RField<std::uint32_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::uint64_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt64, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<std::uint64_t, EColumnType::kInt64>(model, 0)));
+   fColumns.emplace_back(CreateSplitOrPlainColumn<std::uint64_t, EColumnType::kSplitInt64, EColumnType::kInt64>(
+      fUseSplitEncoding ? EColumnType::kSplitInt64 : EColumnType::kInt64, false /* isSorted*/, 0));
 }
 
 void ROOT::Experimental::RField<std::uint64_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt64}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kSplitInt64, EColumnType::kInt64}, 0, desc);
+   fColumns.emplace_back(CreateSplitOrPlainColumn<std::uint64_t, EColumnType::kSplitInt64, EColumnType::kInt64>(
+      type, false /* isSorted*/, 0));
 }
 
 void ROOT::Experimental::RField<std::uint64_t>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -754,16 +781,18 @@ void ROOT::Experimental::RField<std::uint64_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::int64_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt64, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<std::int64_t, EColumnType::kInt64>(model, 0)));
+   fColumns.emplace_back(CreateSplitOrPlainColumn<std::int64_t, EColumnType::kSplitInt64, EColumnType::kInt64>(
+      fUseSplitEncoding ? EColumnType::kSplitInt64 : EColumnType::kInt64, false /* isSorted*/, 0));
 }
 
 void ROOT::Experimental::RField<std::int64_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   auto type = EnsureColumnType({EColumnType::kInt64, EColumnType::kInt32}, 0, desc);
+   auto type = EnsureColumnType({EColumnType::kSplitInt64, EColumnType::kInt64, EColumnType::kInt32}, 0, desc);
    RColumnModel model(type, false /* isSorted*/);
-   if (type == EColumnType::kInt64) {
+   if (type == EColumnType::kSplitInt64) {
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::int64_t, EColumnType::kSplitInt64>(model, 0)));
+   } else if (type == EColumnType::kInt64) {
       fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
          Detail::RColumn::Create<std::int64_t, EColumnType::kInt64>(model, 0)));
    } else {
@@ -781,9 +810,7 @@ void ROOT::Experimental::RField<std::int64_t>::AcceptVisitor(Detail::RFieldVisit
 
 void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   fColumns.emplace_back(CreateIndexColumn(fUseSplitEncoding ? EColumnType::kSplitIndex32 : EColumnType::kIndex));
 
    RColumnModel modelChars(EColumnType::kChar, false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
@@ -792,9 +819,13 @@ void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl()
 
 void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
+   auto type = EnsureColumnType({EColumnType::kSplitIndex32, EColumnType::kIndex}, 0, desc);
    EnsureColumnType({EColumnType::kChar}, 1, desc);
-   GenerateColumnsImpl();
+   fColumns.emplace_back(CreateIndexColumn(type));
+
+   RColumnModel modelChars(EColumnType::kChar, false /* isSorted*/);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+      Detail::RColumn::Create<char, EColumnType::kChar>(modelChars, 1)));
 }
 
 std::size_t ROOT::Experimental::RField<std::string>::AppendImpl(const ROOT::Experimental::Detail::RFieldValue& value)
@@ -1094,15 +1125,13 @@ void ROOT::Experimental::RCollectionClassField::ReadGlobalImpl(NTupleSize_t glob
 
 void ROOT::Experimental::RCollectionClassField::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(
-      std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   fColumns.emplace_back(CreateIndexColumn(fUseSplitEncoding ? EColumnType::kSplitIndex32 : EColumnType::kIndex));
 }
 
 void ROOT::Experimental::RCollectionClassField::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kSplitIndex32, EColumnType::kIndex}, 0, desc);
+   fColumns.emplace_back(CreateIndexColumn(type));
 }
 
 ROOT::Experimental::Detail::RFieldValue ROOT::Experimental::RCollectionClassField::GenerateValue(void *where)
@@ -1350,15 +1379,13 @@ void ROOT::Experimental::RVectorField::ReadGlobalImpl(NTupleSize_t globalIndex,
 
 void ROOT::Experimental::RVectorField::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   fColumns.emplace_back(CreateIndexColumn(fUseSplitEncoding ? EColumnType::kSplitIndex32 : EColumnType::kIndex));
 }
 
 void ROOT::Experimental::RVectorField::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kSplitIndex32, EColumnType::kIndex}, 0, desc);
+   fColumns.emplace_back(CreateIndexColumn(type));
 }
 
 ROOT::Experimental::Detail::RFieldValue ROOT::Experimental::RVectorField::GenerateValue(void* where)
@@ -1516,15 +1543,13 @@ void ROOT::Experimental::RRVecField::ReadGlobalImpl(NTupleSize_t globalIndex, De
 
 void ROOT::Experimental::RRVecField::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(
-      std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   fColumns.emplace_back(CreateIndexColumn(fUseSplitEncoding ? EColumnType::kSplitIndex32 : EColumnType::kIndex));
 }
 
 void ROOT::Experimental::RRVecField::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kSplitIndex32, EColumnType::kIndex}, 0, desc);
+   fColumns.emplace_back(CreateIndexColumn(type));
 }
 
 ROOT::Experimental::Detail::RFieldValue ROOT::Experimental::RRVecField::GenerateValue(void *where)
@@ -1698,15 +1723,13 @@ void ROOT::Experimental::RField<std::vector<bool>>::ReadGlobalImpl(NTupleSize_t
 
 void ROOT::Experimental::RField<std::vector<bool>>::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   fColumns.emplace_back(CreateIndexColumn(fUseSplitEncoding ? EColumnType::kSplitIndex32 : EColumnType::kIndex));
 }
 
 void ROOT::Experimental::RField<std::vector<bool>>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kSplitIndex32, EColumnType::kIndex}, 0, desc);
+   fColumns.emplace_back(CreateIndexColumn(type));
 }
 
 std::vector<ROOT::Experimental::Detail::RFieldValue>
@@ -2123,15 +2146,13 @@ ROOT::Experimental::RCollectionField::RCollectionField(
 
 void ROOT::Experimental::RCollectionField::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   fColumns.emplace_back(CreateIndexColumn(fUseSplitEncoding ? EColumnType::kSplitIndex32 : EColumnType::kIndex));
 }
 
 void ROOT::Experimental::RCollectionField::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
-   GenerateColumnsImpl();
+   auto type = EnsureColumnType({EColumnType::kSplitIndex32, EColumnType::kIndex}, 0, desc);
+   fColumns.emplace_back(CreateIndexColumn(type));
 }
 
 
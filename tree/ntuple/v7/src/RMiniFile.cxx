@@ -31,6 +31,7 @@
 #include <iostream>
 #include <string>
 #include <utility>
+#include <vector>
 #include <chrono>
 
 namespace {
@@ -1289,15 +1290,24 @@ void ROOT::Experimental::Internal::RNTupleFileWriter::Commit()
 }
 
 
-std::uint64_t ROOT::Experimental::Internal::RNTupleFileWriter::WriteBlob(const void *data, size_t nbytes, size_t len)
+std::uint64_t ROOT::Experimental::Internal::RNTupleFileWriter::WriteBlob(const void *data, size_t nbytes, size_t len,
+                                                                         size_t alignment)
 {
    std::uint64_t offset;
    if (fFileSimple) {
       if (fIsBare) {
+         const auto padding = (alignment - fFileSimple.fFilePos % alignment) % alignment;
+         if (padding > 0) {
+            const std::vector<unsigned char> zeros(padding, 0);
+            fFileSimple.Write(zeros.data(), padding);
+         }
          offset = fFileSimple.fFilePos;
          fFileSimple.Write(data, nbytes);
       } else {
-         offset = fFileSimple.WriteKey(data, nbytes, len, -1, 100, kBlobClassName);
+         // The title of the key is used as padding such that the data record starts at a multiple of the alignment
+         RTFKey key(fFileSimple.fFilePos, 100, RTFString{kBlobClassName}, RTFString{}, RTFString{}, len, nbytes);
+         const std::string title((alignment - (fFileSimple.fFilePos + key.fKeyLen) % alignment) % alignment, ' ');
+         offset = fFileSimple.WriteKey(data, nbytes, len, -1, 100, kBlobClassName, "", title);
       }
    } else {
       offset = fFileProper.WriteKey(data, nbytes, len);
@@ -289,6 +289,32 @@ const ROOT::Experimental::RNTupleDescriptor *ROOT::Experimental::RNTupleReader::
    return fCachedDescriptor.get();
 }
 
+std::vector<ROOT::Experimental::RNTupleGlobalRange>
+ROOT::Experimental::RNTupleReader::GetEntryRanges(std::string_view fieldName, double min, double max)
+{
+   std::vector<RNTupleGlobalRange> ranges;
+   NTupleSize_t start = 0;
+   NTupleSize_t end = 0;
+   auto descriptorGuard = fSource->GetSharedDescriptorGuard();
+   auto fieldId = descriptorGuard->FindFieldId(fieldName);
+   if (fieldId == kInvalidDescriptorId) {
+      throw RException(R__FAIL("no field named '" + std::string(fieldName) + "' in RNTuple '" +
+                               descriptorGuard->GetName() + "'"));
+   }
+   for (auto clusterId : descriptorGuard->FindClusterIdsInValueRange(fieldId, min, max)) {
+      const auto &clusterDesc = descriptorGuard->GetClusterDescriptor(clusterId);
+      if (clusterDesc.GetFirstEntryIndex() != end) {
+         if (end > start)
+            ranges.emplace_back(start, end);
+         start = clusterDesc.GetFirstEntryIndex();
+      }
+      end = clusterDesc.GetFirstEntryIndex() + clusterDesc.GetNEntries();
+   }
+   if (end > start)
+      ranges.emplace_back(start, end);
+   return ranges;
+}
+
 //------------------------------------------------------------------------------
 
 
@@ -27,6 +27,7 @@
 #include <cstdint>
 #include <deque>
 #include <iostream>
+#include <limits>
 #include <set>
 #include <utility>
 
@@ -315,6 +316,33 @@ ROOT::Experimental::RNTupleDescriptor::FindPrevClusterId(DescriptorId_t clusterI
    return kInvalidDescriptorId;
 }
 
+std::vector<ROOT::Experimental::DescriptorId_t>
+ROOT::Experimental::RNTupleDescriptor::FindClusterIdsInValueRange(DescriptorId_t fieldId, double min,
+                                                                 double max) const
+{
+   const auto columnId = FindColumnId(fieldId, 0);
+
+   std::vector<const RClusterDescriptor *> clusters;
+   for (const auto &cd : fClusterDescriptors) {
+      const auto &clusterDesc = cd.second;
+      if ((columnId != kInvalidDescriptorId) && clusterDesc.HasPageLocations() &&
+          clusterDesc.ContainsColumn(columnId) &&
+          !clusterDesc.GetColumnRange(columnId).fValueRange.Overlaps(min, max)) {
+         continue;
+      }
+      clusters.emplace_back(&clusterDesc);
+   }
+   std::sort(clusters.begin(), clusters.end(), [](const RClusterDescriptor *a, const RClusterDescriptor *b) {
+      return a->GetFirstEntryIndex() < b->GetFirstEntryIndex();
+   });
+
+   std::vector<DescriptorId_t> clusterIds;
+   clusterIds.reserve(clusters.size());
+   for (auto c : clusters)
+      clusterIds.emplace_back(c->GetId());
+   return clusterIds;
+}
+
 ROOT::Experimental::RResult<void>
 ROOT::Experimental::RNTupleDescriptor::AddClusterDetails(RClusterDescriptor &&clusterDesc)
 {
@@ -407,8 +435,11 @@ ROOT::Experimental::RClusterDescriptorBuilder::CommitColumnRange(
       return R__FAIL("column ID conflict");
    RClusterDescriptor::RColumnRange columnRange{columnId, firstElementIndex, RClusterSize(0)};
    columnRange.fCompressionSettings = compressionSettings;
+   columnRange.fValueRange = RClusterDescriptor::RValueRange(std::numeric_limits<double>::infinity(),
+                                                             -std::numeric_limits<double>::infinity());
    for (const auto &pi : pageRange.fPageInfos) {
       columnRange.fNElements += pi.fNElements;
+      columnRange.fValueRange.Merge(pi.fValueRange);
    }
    fCluster.fPageRanges[columnId] = pageRange.Clone();
    fCluster.fColumnRanges[columnId] = columnRange;
@@ -13,19 +13,161 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RError.hxx>
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMerger.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RPageStorageFile.hxx>
 
-Long64_t ROOT::Experimental::RNTuple::Merge(TCollection* inputs, TFileMergeInfo* mergeInfo) {
-   if (inputs == nullptr || mergeInfo == nullptr) {
-      return -1;
+#include <TCollection.h>
+#include <TDirectory.h>
+#include <TError.h>
+#include <TFile.h>
+#include <TFileMergeInfo.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using ROOT::Experimental::DescriptorId_t;
+using ROOT::Experimental::RException;
+using ROOT::Experimental::RNTupleDescriptor;
+using ROOT::Experimental::kInvalidDescriptorId;
+
+/// Maps the column ids of the source's field sub-tree rooted at `srcFieldId` to the column ids of the corresponding
+/// destination sub-tree.  Fields are matched by name; their types and their column models must be identical.
+void MapColumns(const RNTupleDescriptor &src, DescriptorId_t srcFieldId, const RNTupleDescriptor &dst,
+                DescriptorId_t dstFieldId, std::map<DescriptorId_t, DescriptorId_t> &columnMap)
+{
+   const auto &srcField = src.GetFieldDescriptor(srcFieldId);
+   const auto &dstField = dst.GetFieldDescriptor(dstFieldId);
+   const auto fieldName = src.GetQualifiedFieldName(srcFieldId);
+   if (srcField.GetLinkIds().size() != dstField.GetLinkIds().size()) {
+      throw RException(R__FAIL("incompatible RNTuple schema: different number of sub fields in field '" + fieldName +
+                                "'"));
+   }
+
+   for (std::uint32_t i = 0;; ++i) {
+      const auto srcColumnId = src.FindColumnId(srcFieldId, i);
+      const auto dstColumnId = dst.FindColumnId(dstFieldId, i);
+      if (srcColumnId == kInvalidDescriptorId && dstColumnId == kInvalidDescriptorId)
+         break;
+      if (srcColumnId == kInvalidDescriptorId || dstColumnId == kInvalidDescriptorId ||
+          !(src.GetColumnDescriptor(srcColumnId).GetModel() == dst.GetColumnDescriptor(dstColumnId).GetModel())) {
+         throw RException(R__FAIL("incompatible RNTuple schema: different column representation of field '" +
+                                  fieldName + "'"));
+      }
+      columnMap[srcColumnId] = dstColumnId;
+   }
+
+   for (const auto &srcChild : src.GetFieldIterable(srcFieldId)) {
+      const auto dstChildId = dst.FindFieldId(srcChild.GetFieldName(), dstFieldId);
+      const auto childName = src.GetQualifiedFieldName(srcChild.GetId());
+      if (dstChildId == kInvalidDescriptorId)
+         throw RException(R__FAIL("incompatible RNTuple schema: unexpected field '" + childName + "'"));
+      if (srcChild.GetTypeName() != dst.GetFieldDescriptor(dstChildId).GetTypeName()) {
+         throw RException(R__FAIL("incompatible RNTuple schema: field '" + childName + "' has type " +
+                                  srcChild.GetTypeName() + " instead of " +
+                                  dst.GetFieldDescriptor(dstChildId).GetTypeName()));
+      }
+      MapColumns(src, srcChild.GetId(), dst, dstChildId, columnMap);
+   }
+}
+
+/// Returns the compression settings of the first column range of the first cluster, or -1 if the source is empty
+int GetCompressionSettings(const RNTupleDescriptor &desc)
+{
+   for (const auto &clusterDesc : desc.GetClusterIterable()) {
+      for (DescriptorId_t columnId = 0; columnId < desc.GetNColumns(); ++columnId) {
+         if (clusterDesc.ContainsColumn(columnId))
+            return clusterDesc.GetColumnRange(columnId).fCompressionSettings;
+      }
    }
    return -1;
 }
 
+} // anonymous namespace
+
+Long64_t ROOT::Experimental::RNTuple::Merge(TCollection *inputs, TFileMergeInfo *mergeInfo)
+{
+   // The inputs are the name of the RNTuple followed by the source directories that contain it
+   if (inputs == nullptr || mergeInfo == nullptr || inputs->GetSize() < 2) {
+      return -1;
+   }
+
+   TIter itr(inputs);
+   const std::string ntupleName = itr()->GetName();
+   auto outFile = dynamic_cast<TFile *>(mergeInfo->fOutputDirectory);
+   if (!outFile) {
+      Error("RNTuple::Merge", "merging RNTuple '%s' into a sub-directory is not supported", ntupleName.c_str());
+      return -1;
+   }
+
+   // If the output file already contains the RNTuple (hadd -a, incremental merging), it is merged as the first
+   // source.  The anchor of the merged RNTuple is written as a new cycle of the key; the previous cycle is left in
+   // place because the caller may be iterating over the keys of the output file.
+   std::unique_ptr<RNTuple> outNTuple;
+   if (outFile->GetKey(ntupleName.c_str())) {
+      outNTuple.reset(outFile->Get<RNTuple>(ntupleName.c_str()));
+      if (!outNTuple) {
+         Error("RNTuple::Merge", "cannot read RNTuple '%s' from the output file", ntupleName.c_str());
+         return -1;
+      }
+   }
+
+   try {
+      std::vector<std::unique_ptr<Detail::RPageSource>> sources;
+      std::vector<Detail::RPageSource *> sourcePtrs;
+      if (outNTuple) {
+         sources.emplace_back(outNTuple->MakePageSource());
+         sources.back()->Attach();
+         sourcePtrs.emplace_back(sources.back().get());
+      }
+      while (auto obj = itr()) {
+         auto dir = dynamic_cast<TDirectory *>(obj);
+         std::unique_ptr<RNTuple> ntuple(dir ? dir->Get<RNTuple>(ntupleName.c_str()) : nullptr);
+         if (!ntuple) {
+            Error("RNTuple::Merge", "cannot read RNTuple '%s' from %s", ntupleName.c_str(), obj->GetName());
+            return -1;
+         }
+         sources.emplace_back(ntuple->MakePageSource());
+         sources.back()->Attach();
+         sourcePtrs.emplace_back(sources.back().get());
+      }
+
+      // Like for TTree fast cloning, the "fast" option indicates that the compression of the input is kept.
+      // Otherwise, the pages are recompressed with the compression settings of the output file.
+      RNTupleWriteOptions writeOptions;
+      writeOptions.SetCompression(outFile->GetCompressionSettings());
+      if (mergeInfo->fOptions.Contains("fast")) {
+         const auto compression = GetCompressionSettings(sourcePtrs[0]->GetSharedDescriptorGuard().GetRef());
+         if (compression >= 0)
+            writeOptions.SetCompression(compression);
+      }
+
+      Detail::RPageSinkFile sink(ntupleName, *outFile, writeOptions);
+      RNTupleMerger merger;
+      merger.Merge(sourcePtrs, sink);
+   } catch (const RException &e) {
+      Error("RNTuple::Merge", "cannot merge RNTuple '%s': %s", ntupleName.c_str(), e.GetError().GetReport().c_str());
+      return -1;
+   }
+   return 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 
@@ -36,3 +178,102 @@ ROOT::Experimental::RFieldMerger::Merge(const ROOT::Experimental::RFieldDescript
    return R__FAIL("couldn't merge field " + lhs.GetFieldName() + " with field "
       + rhs.GetFieldName() + " (unimplemented!)");
 }
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+void ROOT::Experimental::RNTupleMerger::Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination)
+{
+   if (sources.empty())
+      throw RException(R__FAIL("no RNTuple sources to merge"));
+
+   // The fields of the model are connected to the destination; the model needs to outlive the merge
+   auto model = sources[0]->GetSharedDescriptorGuard()->GenerateModel();
+   destination.Create(*model);
+   const auto &dstDescriptor = destination.GetDescriptor();
+   const auto dstCompression = destination.GetWriteOptions().GetCompression();
+
+   Detail::RNTupleDecompressor decompressor;
+   NTupleSize_t nEntries = 0;
+   for (auto source : sources) {
+      // Maps the source column ids to the destination column ids
+      std::map<DescriptorId_t, DescriptorId_t> columnMap;
+      std::vector<std::unique_ptr<RClusterDescriptor>> clusterDescriptors;
+      {
+         auto descriptorGuard = source->GetSharedDescriptorGuard();
+         MapColumns(descriptorGuard.GetRef(), descriptorGuard->GetFieldZeroId(), dstDescriptor,
+                    dstDescriptor.GetFieldZeroId(), columnMap);
+         for (const auto &clusterDesc : descriptorGuard->GetClusterIterable())
+            clusterDescriptors.emplace_back(std::make_unique<RClusterDescriptor>(clusterDesc.Clone()));
+      }
+      std::sort(clusterDescriptors.begin(), clusterDescriptors.end(),
+                [](const auto &a, const auto &b) { return a->GetFirstEntryIndex() < b->GetFirstEntryIndex(); });
+
+      for (const auto &clusterDesc : clusterDescriptors) {
+         Detail::RCluster::RKey clusterKey;
+         clusterKey.fClusterId = clusterDesc->GetId();
+         for (const auto &[srcColumnId, _] : columnMap) {
+            if (clusterDesc->ContainsColumn(srcColumnId))
+               clusterKey.fColumnSet.insert(srcColumnId);
+         }
+         // A single vector read for the pages of all the columns of the cluster
+         auto cluster = std::move(source->LoadClusters(std::span<Detail::RCluster::RKey>(&clusterKey, 1))[0]);
+
+         Detail::RPageStorage::SealedPageSequence_t sealedPages;
+         // Owns the buffers of the pages that needed recompression
+         std::vector<std::unique_ptr<unsigned char[]>> zipBuffers;
+         // The destination column id and the number of pages for every group of sealed pages
+         std::vector<std::pair<DescriptorId_t, std::size_t>> groupSizes;
+         for (const auto &[srcColumnId, dstColumnId] : columnMap) {
+            if (!clusterDesc->ContainsColumn(srcColumnId))
+               continue;
+            const auto &columnRange = clusterDesc->GetColumnRange(srcColumnId);
+            const auto &pageRange = clusterDesc->GetPageRange(srcColumnId);
+            std::unique_ptr<Detail::RColumnElementBase> element;
+            if (columnRange.fCompressionSettings != dstCompression) {
+               element = Detail::RColumnElementBase::Generate(
+                  dstDescriptor.GetColumnDescriptor(dstColumnId).GetModel().GetType());
+            }
+
+            std::uint64_t pageNo = 0;
+            for (const auto &pageInfo : pageRange.fPageInfos) {
+               auto onDiskPage = cluster->GetOnDiskPage(Detail::ROnDiskPage::Key(srcColumnId, pageNo++));
+               if (!onDiskPage)
+                  throw RException(R__FAIL("cannot load page of column " + std::to_string(srcColumnId)));
+
+               Detail::RPageStorage::RSealedPage sealedPage(onDiskPage->GetAddress(), onDiskPage->GetSize(),
+                                                            pageInfo.fNElements);
+               sealedPage.fValueRange = pageInfo.fValueRange;
+               const auto nBytesPacked = element ? element->GetPackedSize(pageInfo.fNElements) : 0;
+               if (nBytesPacked > 0) {
+                  // The packed representation does not depend on the compression, so the page only needs to be
+                  // unzipped and zipped again
+                  auto packedBuffer = std::make_unique<unsigned char[]>(nBytesPacked);
+                  decompressor.Unzip(sealedPage.fBuffer, sealedPage.fSize, nBytesPacked, packedBuffer.get());
+                  auto zipBuffer = std::make_unique<unsigned char[]>(nBytesPacked);
+                  sealedPage.fSize =
+                     Detail::RNTupleCompressor::Zip(packedBuffer.get(), nBytesPacked, dstCompression, zipBuffer.get());
+                  sealedPage.fBuffer = zipBuffer.get();
+                  zipBuffers.emplace_back(std::move(zipBuffer));
+               }
+               sealedPages.emplace_back(std::move(sealedPage));
+            }
+            groupSizes.emplace_back(dstColumnId, pageRange.fPageInfos.size());
+         }
+
+         // The iterators are taken only now because adding pages to the deque invalidates them
+         std::vector<Detail::RPageStorage::RSealedPageGroup> sealedPageGroups;
+         auto itrPage = sealedPages.cbegin();
+         for (const auto &[dstColumnId, nPages] : groupSizes) {
+            sealedPageGroups.emplace_back(dstColumnId, itrPage, itrPage + nPages);
+            itrPage += nPages;
+         }
+         destination.CommitSealedPageV(sealedPageGroups);
+
+         nEntries += clusterDesc->GetNEntries();
+         destination.CommitCluster(nEntries);
+      }
+      destination.CommitClusterGroup();
+   }
+   destination.CommitDataset();
+}
@@ -64,3 +64,14 @@ void ROOT::Experimental::RNTupleWriteOptions::SetApproxUnzippedPageSize(std::siz
    EnsureValidTunables(fApproxZippedClusterSize, fMaxUnzippedClusterSize, val);
    fApproxUnzippedPageSize = val;
 }
+
+void ROOT::Experimental::RNTupleWriteOptions::SetMaxUnzippedPageSize(std::size_t val)
+{
+   if (val == 0)
+      throw RException(R__FAIL("invalid maximum page size: 0"));
+   if (val > fMaxUnzippedClusterSize) {
+      throw RException(R__FAIL("maximum page size must not be larger than "
+                               "maximum uncompressed cluster size"));
+   }
+   fMaxUnzippedPageSize = val;
+}
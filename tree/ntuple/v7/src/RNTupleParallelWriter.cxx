@@ -0,0 +1,268 @@
+/// \file RNTupleParallelWriter.cxx
+/// \ingroup NTuple ROOT7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RNTupleParallelWriter.hxx>
+
+#include <ROOT/RColumn.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RPageAllocator.hxx>
+#include <ROOT/RPageSinkBuf.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RPageStorageFile.hxx>
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using ROOT::Experimental::DescriptorId_t;
+using ROOT::Experimental::NTupleSize_t;
+using ROOT::Experimental::RNTupleLocator;
+using ROOT::Experimental::RNTupleModel;
+using ROOT::Experimental::RNTupleWriteOptions;
+using ROOT::Experimental::Detail::RPage;
+using ROOT::Experimental::Detail::RPageAllocatorHeap;
+using ROOT::Experimental::Detail::RPageSink;
+
+/// The page sink of a fill context.  Pages are sealed as soon as they are committed by the columns, i.e. in the
+/// filling thread.  The sealed pages are buffered until the end of the cluster, when the entire cluster is handed
+/// over in a single step to the shared page sink of the parallel writer.  Nothing is written by this sink itself.
+class RPageSinkFillContext final : public RPageSink {
+private:
+   /// The sealed pages of a column in the currently open cluster, together with the memory they point to
+   struct RBufferedColumn {
+      SealedPageSequence_t fSealedPages;
+      std::vector<std::unique_ptr<unsigned char[]>> fBuffers;
+
+      RBufferedColumn() = default;
+      RBufferedColumn(const RBufferedColumn &) = delete;
+      RBufferedColumn &operator=(const RBufferedColumn &) = delete;
+      RBufferedColumn(RBufferedColumn &&) = default;
+      RBufferedColumn &operator=(RBufferedColumn &&) = default;
+   };
+
+   /// The shared sink of the parallel writer; only accessed under fMutex
+   RPageSink &fMainSink;
+   std::mutex &fMutex;
+   /// The total number of entries committed to fMainSink; only accessed under fMutex
+   NTupleSize_t &fMainNEntries;
+   /// Indexed by column id
+   std::vector<RBufferedColumn> fBufferedColumns;
+
+   void BufferSealedPage(DescriptorId_t columnId, std::unique_ptr<unsigned char[]> buf, const RSealedPage &sealedPage)
+   {
+      auto &column = fBufferedColumns.at(columnId);
+      column.fSealedPages.emplace_back(buf.get(), sealedPage.fSize, sealedPage.fNElements);
+      column.fSealedPages.back().fValueRange = sealedPage.fValueRange;
+      column.fBuffers.emplace_back(std::move(buf));
+   }
+
+protected:
+   void CreateImpl(const RNTupleModel & /* model */, unsigned char * /* serializedHeader */,
+                   std::uint32_t /* length */) final
+   {
+      fBufferedColumns.resize(fDescriptorBuilder.GetDescriptor().GetNColumns());
+   }
+
+   RNTupleLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final
+   {
+      // The packed and compressed page is never larger than the in-memory page
+      auto buf = std::make_unique<unsigned char[]>(page.GetNBytes());
+      auto sealedPage =
+         SealPage(page, *columnHandle.fColumn->GetElement(), GetWriteOptions().GetCompression(), buf.get());
+      // Uncompressed, mappable pages are not copied by SealPage() but the column reuses its page buffer
+      if (sealedPage.fBuffer != buf.get())
+         memcpy(buf.get(), sealedPage.fBuffer, sealedPage.fSize);
+      sealedPage.fValueRange = GetValueRange(columnHandle, page);
+      BufferSealedPage(columnHandle.fId, std::move(buf), sealedPage);
+      // The locators of this sink are never written out; the size is only used to adapt the page sizes
+      RNTupleLocator locator;
+      locator.fBytesOnStorage = sealedPage.fSize;
+      return locator;
+   }
+
+   RNTupleLocator CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage) final
+   {
+      auto buf = std::make_unique<unsigned char[]>(sealedPage.fSize);
+      memcpy(buf.get(), sealedPage.fBuffer, sealedPage.fSize);
+      BufferSealedPage(columnId, std::move(buf), sealedPage);
+      return RNTupleLocator{};
+   }
+
+   std::uint64_t CommitClusterImpl(NTupleSize_t nEntries) final
+   {
+      // The cluster descriptors of this sink are never serialized; keep only the one of the last cluster so that
+      // the memory does not grow with the number of committed clusters
+      fDescriptorBuilder.ClearClusters();
+
+      std::vector<RSealedPageGroup> toCommit;
+      toCommit.reserve(fBufferedColumns.size());
+      for (DescriptorId_t i = 0; i < fBufferedColumns.size(); ++i) {
+         const auto &sealedPages = fBufferedColumns[i].fSealedPages;
+         toCommit.emplace_back(i, sealedPages.cbegin(), sealedPages.cend());
+      }
+
+      std::uint64_t nbytes;
+      {
+         std::lock_guard<std::mutex> guard(fMutex);
+         fMainSink.CommitSealedPageV(toCommit);
+         // fPrevClusterNEntries is updated by RPageSink::CommitCluster() only after this call
+         fMainNEntries += nEntries - fPrevClusterNEntries;
+         nbytes = fMainSink.CommitCluster(fMainNEntries);
+      }
+
+      for (auto &column : fBufferedColumns) {
+         column.fSealedPages.clear();
+         column.fBuffers.clear();
+      }
+      return nbytes;
+   }
+
+   RNTupleLocator CommitClusterGroupImpl(unsigned char * /* serializedPageList */, std::uint32_t /* length */) final
+   {
+      // Cluster groups are committed by the parallel writer on the shared sink
+      return RNTupleLocator{};
+   }
+
+   void CommitDatasetImpl(unsigned char * /* serializedFooter */, std::uint32_t /* length */) final {}
+
+public:
+   RPageSinkFillContext(RPageSink &mainSink, std::mutex &mutex, NTupleSize_t &mainNEntries)
+      : RPageSink(mainSink.GetNTupleName(), mainSink.GetWriteOptions()),
+        fMainSink(mainSink),
+        fMutex(mutex),
+        fMainNEntries(mainNEntries)
+   {
+   }
+
+   RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final
+   {
+      if (nElements == 0)
+         throw ROOT::Experimental::RException(R__FAIL("invalid call: request empty page"));
+      auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+      return RPageAllocatorHeap::NewPage(columnHandle.fId, elementSize, nElements);
+   }
+
+   void ReleasePage(RPage &page) final { RPageAllocatorHeap::DeletePage(page); }
+};
+
+} // anonymous namespace
+
+ROOT::Experimental::RNTupleFillContext::RNTupleFillContext(std::unique_ptr<RNTupleModel> model,
+                                                           RNTupleParallelWriter &writer)
+   : fSink(std::make_unique<RPageSinkFillContext>(*writer.fSink, writer.fMutex, writer.fNEntries)),
+     fModel(std::move(model))
+{
+   fSink->Create(*fModel);
+   const auto topLevelFields = fModel->GetFieldZero()->GetSubFields();
+   if (!topLevelFields.empty())
+      fFirstField = topLevelFields[0];
+
+   const auto &writeOpts = fSink->GetWriteOptions();
+   fMaxUnzippedClusterSize = writeOpts.GetMaxUnzippedClusterSize();
+   // First estimate is a factor 2 compression if compression is used at all
+   const int scale = writeOpts.GetCompression() ? 2 : 1;
+   fUnzippedClusterSizeEst = scale * writeOpts.GetApproxZippedClusterSize();
+}
+
+ROOT::Experimental::RNTupleFillContext::~RNTupleFillContext()
+{
+   CommitCluster();
+}
+
+void ROOT::Experimental::RNTupleFillContext::CommitCluster()
+{
+   if (fNEntries == fLastCommitted)
+      return;
+   for (auto &field : *fModel->GetFieldZero()) {
+      field.Flush();
+      field.CommitCluster();
+   }
+   fNBytesCommitted += fSink->CommitCluster(fNEntries);
+   fNBytesFilled += fUnzippedClusterSize;
+
+   // Cap the compression factor at 1000 to prevent overflow of fUnzippedClusterSizeEst
+   const float compressionFactor =
+      std::min(1000.f, static_cast<float>(fNBytesFilled) / static_cast<float>(fNBytesCommitted));
+   fUnzippedClusterSizeEst =
+      compressionFactor * static_cast<float>(fSink->GetWriteOptions().GetApproxZippedClusterSize());
+
+   fLastCommitted = fNEntries;
+   fUnzippedClusterSize = 0;
+}
+
+//------------------------------------------------------------------------------
+
+ROOT::Experimental::RNTupleParallelWriter::RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model,
+                                                                 std::unique_ptr<Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model)), fMetrics("RNTupleParallelWriter")
+{
+   if (!fModel) {
+      throw RException(R__FAIL("null model"));
+   }
+   if (!fSink) {
+      throw RException(R__FAIL("null sink"));
+   }
+   if (dynamic_cast<Detail::RPageSinkBuf *>(fSink.get())) {
+      throw RException(R__FAIL("the parallel writer requires an unbuffered sink"));
+   }
+   fModel->Freeze();
+   fSink->Create(*fModel);
+   fMetrics.ObserveMetrics(fSink->GetMetrics());
+}
+
+ROOT::Experimental::RNTupleParallelWriter::~RNTupleParallelWriter()
+{
+   std::lock_guard<std::mutex> guard(fMutex);
+   if (fNEntries > 0)
+      fSink->CommitClusterGroup();
+   fSink->CommitDataset();
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter>
+ROOT::Experimental::RNTupleParallelWriter::Recreate(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName,
+                                                    std::string_view storage, const RNTupleWriteOptions &options)
+{
+   // Buffering is done by the fill contexts; the shared sink writes the sealed clusters directly
+   auto sink = std::make_unique<Detail::RPageSinkFile>(ntupleName, storage, options);
+   return std::make_unique<RNTupleParallelWriter>(std::move(model), std::move(sink));
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter>
+ROOT::Experimental::RNTupleParallelWriter::Append(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName,
+                                                  TFile &file, const RNTupleWriteOptions &options)
+{
+   auto sink = std::make_unique<Detail::RPageSinkFile>(ntupleName, file, options);
+   return std::make_unique<RNTupleParallelWriter>(std::move(model), std::move(sink));
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleFillContext>
+ROOT::Experimental::RNTupleParallelWriter::CreateFillContext()
+{
+   // Cloning preserves the model id and the on-disk ids of the fields.  The column ids assigned by the context's
+   // sink match the ones of the shared sink because page sinks connect the fields in the model's iteration order.
+   std::unique_ptr<RNTupleModel> model;
+   {
+      std::lock_guard<std::mutex> guard(fMutex);
+      model = fModel->Clone();
+   }
+   return std::unique_ptr<RNTupleFillContext>(new RNTupleFillContext(std::move(model), *this));
+}
+
+ROOT::Experimental::NTupleSize_t ROOT::Experimental::RNTupleParallelWriter::GetNEntries()
+{
+   std::lock_guard<std::mutex> guard(fMutex);
+   return fNEntries;
+}
@@ -22,6 +22,7 @@
 #include <RVersion.h>
 #include <RZip.h> // for R__crc32
 
+#include <algorithm>
 #include <cstring> // for memcpy
 #include <deque>
 #include <set>
@@ -195,7 +196,8 @@ std::uint32_t SerializeColumnListV1(
          if (c.GetModel().GetIsSorted())
             flags |= RNTupleSerializer::kFlagSortAscColumn;
          // TODO(jblomer): fix for unsigned integer types
-         if (type == ROOT::Experimental::EColumnType::kIndex)
+         if ((type == ROOT::Experimental::EColumnType::kIndex) ||
+             (type == ROOT::Experimental::EColumnType::kSplitIndex32))
             flags |= RNTupleSerializer::kFlagNonNegativeColumn;
          pos += RNTupleSerializer::SerializeUInt32(flags, *where);
 
@@ -382,6 +384,22 @@ std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::DeserializeUInt64
    return DeserializeInt64(buffer, *reinterpret_cast<std::int64_t *>(&val));
 }
 
+std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeDouble(double val, void *buffer)
+{
+   static_assert(sizeof(double) == sizeof(std::uint64_t), "unsupported double representation");
+   std::uint64_t bits;
+   memcpy(&bits, &val, sizeof(bits));
+   return SerializeUInt64(bits, buffer);
+}
+
+std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::DeserializeDouble(const void *buffer, double &val)
+{
+   std::uint64_t bits;
+   auto nbytes = DeserializeUInt64(buffer, bits);
+   memcpy(&val, &bits, sizeof(val));
+   return nbytes;
+}
+
 std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeString(const std::string &val, void *buffer)
 {
    if (buffer) {
@@ -441,6 +459,18 @@ std::uint16_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeColumnTy
          return SerializeUInt16(0x0C, buffer);
       case EColumnType::kInt8:
          return SerializeUInt16(0x0D, buffer);
+      case EColumnType::kSplitIndex32:
+         return SerializeUInt16(0x0F, buffer);
+      case EColumnType::kSplitReal64:
+         return SerializeUInt16(0x10, buffer);
+      case EColumnType::kSplitReal32:
+         return SerializeUInt16(0x11, buffer);
+      case EColumnType::kSplitInt64:
+         return SerializeUInt16(0x13, buffer);
+      case EColumnType::kSplitInt32:
+         return SerializeUInt16(0x14, buffer);
+      case EColumnType::kSplitInt16:
+         return SerializeUInt16(0x15, buffer);
       default:
          throw RException(R__FAIL("ROOT bug: unexpected column type"));
    }
@@ -490,6 +520,24 @@ RResult<std::uint16_t> ROOT::Experimental::Internal::RNTupleSerializer::Deserial
       case 0x0D:
          type = EColumnType::kInt8;
          break;
+      case 0x0F:
+         type = EColumnType::kSplitIndex32;
+         break;
+      case 0x10:
+         type = EColumnType::kSplitReal64;
+         break;
+      case 0x11:
+         type = EColumnType::kSplitReal32;
+         break;
+      case 0x13:
+         type = EColumnType::kSplitInt64;
+         break;
+      case 0x14:
+         type = EColumnType::kSplitInt32;
+         break;
+      case 0x15:
+         type = EColumnType::kSplitInt16;
+         break;
       default:
          return R__FAIL("unexpected on-disk column type");
    }
@@ -1004,6 +1052,18 @@ std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializePageList
          pos += SerializeUInt64(columnRange.fFirstElementIndex, *where);
          pos += SerializeUInt32(columnRange.fCompressionSettings, *where);
 
+         // Optional trailing value statistics; older readers skip them because they jump to the end of the frame
+         const bool hasValueRanges =
+            std::all_of(pageRange.fPageInfos.begin(), pageRange.fPageInfos.end(),
+                        [](const RClusterDescriptor::RPageRange::RPageInfo &pi) { return pi.fValueRange.fIsValid; });
+         if (!pageRange.fPageInfos.empty() && hasValueRanges) {
+            pos += SerializeUInt32(kFlagPageValueRanges, *where);
+            for (const auto &pi : pageRange.fPageInfos) {
+               pos += SerializeDouble(pi.fValueRange.fMin, *where);
+               pos += SerializeDouble(pi.fValueRange.fMax, *where);
+            }
+         }
+
          pos += SerializeFramePostscript(buffer ? innerFrame : nullptr, pos - innerFrame);
       }
       pos += SerializeFramePostscript(buffer ? outerFrame : nullptr, pos - outerFrame);
@@ -1394,6 +1454,23 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::Internal::RNTupleSerialize
          std::uint32_t compressionSettings;
          bytes += DeserializeUInt32(bytes, compressionSettings);
 
+         if (fnInnerFrameSizeLeft() >= static_cast<int>(sizeof(std::uint32_t))) {
+            std::uint32_t flags;
+            bytes += DeserializeUInt32(bytes, flags);
+            if (flags & kFlagPageValueRanges) {
+               // non-negative after the flags check; compare in 64 bit as the product may overflow an int
+               if (static_cast<std::uint64_t>(fnInnerFrameSizeLeft()) < 2 * sizeof(double) * std::uint64_t(nPages))
+                  return R__FAIL("page value ranges too short");
+               for (auto &pi : pageRange.fPageInfos) {
+                  double min;
+                  double max;
+                  bytes += DeserializeDouble(bytes, min);
+                  bytes += DeserializeDouble(bytes, max);
+                  pi.fValueRange = RClusterDescriptor::RValueRange(min, max);
+               }
+            }
+         }
+
          clusters[i].CommitColumnRange(j, columnOffset, compressionSettings, pageRange);
          bytes = innerFrame + innerFrameSize;
       }
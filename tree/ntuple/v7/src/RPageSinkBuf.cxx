@@ -66,8 +66,10 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitPageImpl(ColumnHandle_t columnHa
    R__ASSERT(zipItem->fBuf);
    auto sealedPage = fBufferedColumns.at(columnHandle.fId).RegisterSealedPage();
    fTaskScheduler->AddTask([this, zipItem, sealedPage, colId = columnHandle.fId] {
-      *sealedPage = SealPage(zipItem->fPage, *fBufferedColumns.at(colId).GetHandle().fColumn->GetElement(),
-                             GetWriteOptions().GetCompression(), zipItem->fBuf.get());
+      const auto &handle = fBufferedColumns.at(colId).GetHandle();
+      *sealedPage = SealPage(zipItem->fPage, *handle.fColumn->GetElement(), GetWriteOptions().GetCompression(),
+                             zipItem->fBuf.get());
+      sealedPage->fValueRange = GetValueRange(handle, zipItem->fPage);
       zipItem->fSealedPage = &(*sealedPage);
    });
 
@@ -108,29 +110,33 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(ROOT::Experimental::
 
       for (auto &bufColumn : fBufferedColumns)
          bufColumn.DrainBufferedPages();
-      return fInnerSink->CommitCluster(nEntries);
-   }
-
-   // Otherwise, try to do it per column
-   for (auto &bufColumn : fBufferedColumns) {
-      // In practice, either all (see above) or none of the buffered pages have been sealed, depending on whether
-      // a task scheduler is available. The rare condition of a few columns consisting only of sealed pages should
-      // not happen unless the API is misused.
-      if (bufColumn.HasSealedPagesOnly())
-         throw RException(R__FAIL("only a few columns have all pages sealed"));
-
-      // Slow path: if the buffered column contains both sealed and unsealed pages, commit them one by one.
-      // TODO(jalopezg): coalesce contiguous sealed pages and commit via `CommitSealedPageV()`.
-      auto drained = bufColumn.DrainBufferedPages();
-      for (auto &bufPage : std::get<std::deque<RColumnBuf::RPageZipItem>>(drained)) {
-         if (bufPage.IsSealed()) {
-            fInnerSink->CommitSealedPage(bufColumn.GetHandle().fId, *bufPage.fSealedPage);
-         } else {
-            fInnerSink->CommitPage(bufColumn.GetHandle(), bufPage.fPage);
+   } else {
+      // Otherwise, try to do it per column
+      for (auto &bufColumn : fBufferedColumns) {
+         // In practice, either all (see above) or none of the buffered pages have been sealed, depending on whether
+         // a task scheduler is available. The rare condition of a few columns consisting only of sealed pages should
+         // not happen unless the API is misused.
+         if (bufColumn.HasSealedPagesOnly())
+            throw RException(R__FAIL("only a few columns have all pages sealed"));
+
+         // Slow path: if the buffered column contains both sealed and unsealed pages, commit them one by one.
+         // TODO(jalopezg): coalesce contiguous sealed pages and commit via `CommitSealedPageV()`.
+         auto drained = bufColumn.DrainBufferedPages();
+         for (auto &bufPage : std::get<std::deque<RColumnBuf::RPageZipItem>>(drained)) {
+            if (bufPage.IsSealed()) {
+               fInnerSink->CommitSealedPage(bufColumn.GetHandle().fId, *bufPage.fSealedPage);
+            } else {
+               fInnerSink->CommitPage(bufColumn.GetHandle(), bufPage.fPage);
+            }
+            ReleasePage(bufPage.fPage);
          }
-         ReleasePage(bufPage.fPage);
       }
    }
+
+   // The compressed size of the pages is only known to the inner sink; it is needed to adapt the page sizes of
+   // the columns, which are connected to this sink
+   for (std::size_t i = 0; i < fColumnWriteStats.size(); ++i)
+      fColumnWriteStats[i].fNBytesZipped = fInnerSink->GetColumnWriteStats(i).fNBytesZipped;
    return fInnerSink->CommitCluster(nEntries);
 }
 
@@ -31,6 +31,10 @@
 #include <Compression.h>
 #include <TError.h>
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <utility>
 
 
@@ -105,10 +109,101 @@ ROOT::Experimental::ColumnId_t ROOT::Experimental::Detail::RPageSource::GetColum
    return columnHandle.fId;
 }
 
-void ROOT::Experimental::Detail::RPageSource::UnzipCluster(RCluster *cluster)
+void ROOT::Experimental::Detail::RPageSource::StreamClusters(std::span<RCluster::RKey> clusterKeys,
+                                                            const ClusterCallback_t &callback)
 {
-   if (fTaskScheduler)
-      UnzipClusterImpl(cluster);
+   auto clusters = LoadClusters(clusterKeys);
+   for (std::size_t i = 0; i < clusters.size(); ++i)
+      callback(i, std::move(clusters[i]));
+}
+
+namespace {
+
+/// Used by RPageSource::UnzipClusters() in front of the actual task scheduler: counts the unfinished unzip tasks of
+/// every cluster in order to report a cluster as soon as its last task is done.
+class RUnzipTaskCounter final : public ROOT::Experimental::Detail::RPageStorage::RTaskScheduler {
+   RTaskScheduler &fScheduler;
+   const std::function<void(std::size_t)> &fOnClusterUnzipped;
+   /// Per cluster: the number of unfinished tasks, plus one while the tasks of the cluster are being added
+   std::unique_ptr<std::atomic<std::size_t>[]> fNPending;
+   /// The cluster whose tasks are currently being added
+   std::size_t fCurrent = 0;
+
+   void Done(std::size_t idx)
+   {
+      if (--fNPending[idx] == 0)
+         fOnClusterUnzipped(idx);
+   }
+
+public:
+   RUnzipTaskCounter(RTaskScheduler &scheduler, const std::function<void(std::size_t)> &onClusterUnzipped,
+                     std::size_t nClusters)
+      : fScheduler(scheduler), fOnClusterUnzipped(onClusterUnzipped), fNPending(new std::atomic<std::size_t>[nClusters])
+   {
+   }
+
+   void BeginCluster(std::size_t idx)
+   {
+      fCurrent = idx;
+      fNPending[idx] = 1;
+   }
+   void EndCluster() { Done(fCurrent); }
+
+   void Reset() final { fScheduler.Reset(); }
+   void AddTask(const std::function<void(void)> &taskFunc) final
+   {
+      const auto idx = fCurrent;
+      ++fNPending[idx];
+      fScheduler.AddTask([this, idx, taskFunc] {
+         taskFunc();
+         Done(idx);
+      });
+   }
+   void Wait() final { fScheduler.Wait(); }
+};
+
+} // anonymous namespace
+
+void ROOT::Experimental::Detail::RPageSource::UnzipClusters(std::span<RCluster *> clusters,
+                                                           const UnzipCallback_t &onClusterUnzipped)
+{
+   if (!fTaskScheduler || clusters.empty()) {
+      if (onClusterUnzipped) {
+         for (std::size_t i = 0; i < clusters.size(); ++i)
+            onClusterUnzipped(i);
+      }
+      return;
+   }
+
+   std::unique_ptr<RNTupleAtomicTimer> timer;
+   if (fCounters)
+      timer = std::make_unique<RNTupleAtomicTimer>(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
+   fTaskScheduler->Reset();
+   if (!onClusterUnzipped) {
+      for (auto cluster : clusters)
+         UnzipClusterImpl(cluster);
+      fTaskScheduler->Wait();
+      return;
+   }
+
+   // The implementations add their tasks to fTaskScheduler, which is routed through the counter for the duration
+   // of the call.  Only the unzip thread of the cluster pool uses the task scheduler of a page source.
+   auto scheduler = fTaskScheduler;
+   RUnzipTaskCounter counter(*scheduler, onClusterUnzipped, clusters.size());
+   fTaskScheduler = &counter;
+   try {
+      for (std::size_t i = 0; i < clusters.size(); ++i) {
+         counter.BeginCluster(i);
+         UnzipClusterImpl(clusters[i]);
+         counter.EndCluster();
+      }
+   } catch (...) {
+      fTaskScheduler = scheduler;
+      scheduler->Wait();
+      throw;
+   }
+   fTaskScheduler = scheduler;
+   scheduler->Wait();
 }
 
 
@@ -273,9 +368,55 @@ ROOT::Experimental::Detail::RPageSink::AddColumn(DescriptorId_t fieldId, const R
 {
    auto columnId = fDescriptorBuilder.GetDescriptor().GetNColumns();
    fDescriptorBuilder.AddColumn(columnId, fieldId, column.GetModel(), column.GetIndex());
+   fColumnWriteStats.emplace_back();
+   fUnzippedPageSizes.emplace_back(GetWriteOptions().GetApproxUnzippedPageSize());
    return ColumnHandle_t{columnId, &column};
 }
 
+std::uint32_t ROOT::Experimental::Detail::RPageSink::GetApproxNElementsPerPage(ColumnHandle_t columnHandle) const
+{
+   const auto nElements = fUnzippedPageSizes.at(columnHandle.fId) / columnHandle.fColumn->GetElement()->GetSize();
+   return std::max<std::size_t>(2, std::min<std::size_t>(nElements, ClusterSize_t(-1) / 2));
+}
+
+void ROOT::Experimental::Detail::RPageSink::UpdatePageSizes()
+{
+   const auto &options = GetWriteOptions();
+   const auto defaultPageSize = options.GetApproxUnzippedPageSize();
+   const auto maxPageSize = std::max(defaultPageSize, options.GetMaxUnzippedPageSize());
+
+   for (std::size_t i = 0; i < fUnzippedPageSizes.size(); ++i) {
+      if (!options.GetUseAdaptivePageSize()) {
+         fUnzippedPageSizes[i] = defaultPageSize;
+         continue;
+      }
+      const auto &stats = fColumnWriteStats[i];
+      // Columns without (unsealed) data in the last cluster keep their page size
+      if (stats.fNBytesUnzipped == 0)
+         continue;
+      // Pages of well-compressible columns grow such that their compressed size approaches the default page size.
+      // A page does not need to be larger than what the column fills into a cluster, though.
+      const double compressionFactor =
+         (stats.fNBytesZipped > 0) ? static_cast<double>(stats.fNBytesUnzipped) / stats.fNBytesZipped : 1.0;
+      auto pageSize = static_cast<std::size_t>(std::max(1.0, compressionFactor) * defaultPageSize);
+      pageSize = std::min<std::uint64_t>({pageSize, maxPageSize, stats.fNBytesUnzipped});
+      fUnzippedPageSizes[i] = pageSize;
+   }
+
+   const auto budget = options.GetPageBufferBudget();
+   if (budget == 0)
+      return;
+   // Every column uses two write pages that are 50% larger than the target page size
+   std::uint64_t nBytesWritePages = 0;
+   for (auto pageSize : fUnzippedPageSizes)
+      nBytesWritePages += 3 * pageSize;
+   if (nBytesWritePages <= budget)
+      return;
+   const double scale = static_cast<double>(budget) / nBytesWritePages;
+   for (auto &pageSize : fUnzippedPageSizes)
+      pageSize = std::max<std::size_t>(1, scale * pageSize);
+}
+
 
 void ROOT::Experimental::Detail::RPageSink::Create(RNTupleModel &model)
 {
@@ -305,6 +446,11 @@ void ROOT::Experimental::Detail::RPageSink::Create(RNTupleModel &model)
       pageRange.fColumnId = i;
       fOpenPageRanges.emplace_back(std::move(pageRange));
    }
+   // Now that the number of columns is known, apply the page buffer budget. The columns have reserved their write
+   // pages on connection, with the default page size: they need to reserve them again.
+   UpdatePageSizes();
+   for (auto &f : fieldZero)
+      f.UpdateWritePageSizes();
 
    fSerializationContext = Internal::RNTupleSerializer::SerializeHeaderV1(nullptr, descriptor);
    auto buffer = std::make_unique<unsigned char[]>(fSerializationContext.GetHeaderSize());
@@ -320,8 +466,14 @@ void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHand
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = page.GetNElements();
+   pageInfo.fValueRange = GetValueRange(columnHandle, page);
    pageInfo.fLocator = CommitPageImpl(columnHandle, page);
    fOpenPageRanges.at(columnHandle.fId).fPageInfos.emplace_back(pageInfo);
+
+   auto &stats = fColumnWriteStats.at(columnHandle.fId);
+   stats.fNElements += page.GetNElements();
+   stats.fNBytesUnzipped += page.GetNBytes();
+   stats.fNBytesZipped += pageInfo.fLocator.fBytesOnStorage;
 }
 
 
@@ -333,8 +485,13 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPage(
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = sealedPage.fNElements;
+   pageInfo.fValueRange = sealedPage.fValueRange;
    pageInfo.fLocator = CommitSealedPageImpl(columnId, sealedPage);
    fOpenPageRanges.at(columnId).fPageInfos.emplace_back(pageInfo);
+
+   auto &stats = fColumnWriteStats.at(columnId);
+   stats.fNElements += sealedPage.fNElements;
+   stats.fNBytesZipped += sealedPage.fSize;
 }
 
 std::vector<ROOT::Experimental::RNTupleLocator>
@@ -359,8 +516,13 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPageV(std::span<RPageSto
 
          RClusterDescriptor::RPageRange::RPageInfo pageInfo;
          pageInfo.fNElements = sealedPageIt->fNElements;
+         pageInfo.fValueRange = sealedPageIt->fValueRange;
          pageInfo.fLocator = locators[i++];
          fOpenPageRanges.at(range.fColumnId).fPageInfos.emplace_back(pageInfo);
+
+         auto &stats = fColumnWriteStats.at(range.fColumnId);
+         stats.fNElements += sealedPageIt->fNElements;
+         stats.fNBytesZipped += sealedPageIt->fSize;
       }
    }
 }
@@ -384,6 +546,9 @@ std::uint64_t ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experim
    }
    fDescriptorBuilder.AddClusterWithDetails(clusterBuilder.MoveDescriptor().Unwrap());
    fPrevClusterNEntries = nEntries;
+
+   UpdatePageSizes();
+   std::fill(fColumnWriteStats.begin(), fColumnWriteStats.end(), RColumnWriteStats());
    return nbytes;
 }
 
@@ -464,6 +629,19 @@ ROOT::Experimental::Detail::RPageSink::SealPage(
    return SealPage(page, element, compressionSetting, fCompressor->GetZipBuffer());
 }
 
+ROOT::Experimental::RClusterDescriptor::RValueRange
+ROOT::Experimental::Detail::RPageSink::GetValueRange(ColumnHandle_t columnHandle, const RPage &page) const
+{
+   if (!GetWriteOptions().GetEnablePageStatistics())
+      return RClusterDescriptor::RValueRange();
+
+   double min;
+   double max;
+   if (!columnHandle.fColumn->GetElement()->GetValueRange(page.GetBuffer(), page.GetNElements(), min, max))
+      return RClusterDescriptor::RValueRange();
+   return RClusterDescriptor::RValueRange(min, max);
+}
+
 void ROOT::Experimental::Detail::RPageSink::EnableDefaultMetrics(const std::string &prefix)
 {
    fMetrics = RNTupleMetrics(prefix);
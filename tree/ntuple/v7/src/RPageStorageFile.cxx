@@ -31,6 +31,7 @@
 #include <TError.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
@@ -97,12 +98,15 @@ void ROOT::Experimental::Detail::RPageSinkFile::CreateImpl(const RNTupleModel &
 
 inline ROOT::Experimental::RNTupleLocator
 ROOT::Experimental::Detail::RPageSinkFile::WriteSealedPage(
-   const RPageStorage::RSealedPage &sealedPage, std::size_t bytesPacked)
+   const RPageStorage::RSealedPage &sealedPage, std::size_t bytesPacked, std::size_t alignment)
 {
+   // Compressed pages are never mapped
+   if (sealedPage.fSize != bytesPacked)
+      alignment = 1;
    std::uint64_t offsetData;
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallWrite, fCounters->fTimeCpuWrite);
-      offsetData = fWriter->WriteBlob(sealedPage.fBuffer, sealedPage.fSize, bytesPacked);
+      offsetData = fWriter->WriteBlob(sealedPage.fBuffer, sealedPage.fSize, bytesPacked, alignment);
    }
 
    RNTupleLocator result;
@@ -126,7 +130,8 @@ ROOT::Experimental::Detail::RPageSinkFile::CommitPageImpl(ColumnHandle_t columnH
    }
 
    fCounters->fSzZip.Add(page.GetNBytes());
-   return WriteSealedPage(sealedPage, element->GetPackedSize(page.GetNElements()));
+   return WriteSealedPage(sealedPage, element->GetPackedSize(page.GetNElements()),
+                          element->IsMappable() ? element->GetSize() : 1);
 }
 
 
@@ -138,7 +143,8 @@ ROOT::Experimental::Detail::RPageSinkFile::CommitSealedPageImpl(
       fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(columnId).GetModel().GetType());
    const auto bytesPacked = (bitsOnStorage * sealedPage.fNElements + 7) / 8;
 
-   return WriteSealedPage(sealedPage, bytesPacked);
+   // The in-memory type of the column is unknown here; align uncompressed pages to their element size on storage
+   return WriteSealedPage(sealedPage, bytesPacked, (bitsOnStorage % 8 == 0) ? bitsOnStorage / 8 : 1);
 }
 
 
@@ -215,7 +221,8 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
    : RPageSource(ntupleName, options)
    , fPageAllocator(std::make_unique<RPageAllocatorFile>())
    , fPagePool(std::make_shared<RPagePool>())
-   , fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize()))
+   , fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize(),
+                                                 options.GetClusterPrefetchDepth()))
 {
    fDecompressor = std::make_unique<RNTupleDecompressor>();
    EnableDefaultMetrics("RPageSourceFile");
@@ -260,6 +267,12 @@ ROOT::Experimental::Detail::RPageSourceFile::CreateFromAnchor(const Internal::RF
 
 ROOT::Experimental::Detail::RPageSourceFile::~RPageSourceFile() = default;
 
+ROOT::Experimental::Detail::RPageSourceFile::RFileMapping::~RFileMapping()
+{
+   if (fAddress)
+      fFile->Unmap(fAddress, fSize);
+}
+
 
 ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFile::AttachImpl()
 {
@@ -287,6 +300,16 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFil
       }
    }
 
+   // Without mmap support by the raw file, fall back silently to regular reads
+   if (fOptions.GetUseMmap() && (fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasMmap)) {
+      fMapping = std::make_unique<RFileMapping>();
+      fMapping->fFile = fFile.get();
+      fMapping->fSize = fFile->GetSize();
+      std::uint64_t mapdOffset;
+      fMapping->fAddress = static_cast<unsigned char *>(fFile->Map(fMapping->fSize, 0, mapdOffset));
+      R__ASSERT(mapdOffset == 0);
+   }
+
    return ntplDesc;
 }
 
@@ -327,12 +350,16 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
    std::unique_ptr<unsigned char []> directReadBuffer; // only used if cluster pool is turned off
 
    if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
-      directReadBuffer = std::make_unique<unsigned char[]>(bytesOnStorage);
-      fReader.ReadBuffer(directReadBuffer.get(), bytesOnStorage, pageInfo.fLocator.fPosition);
       fCounters->fNPageLoaded.Inc();
-      fCounters->fNRead.Inc();
-      fCounters->fSzReadPayload.Add(bytesOnStorage);
-      sealedPageBuffer = directReadBuffer.get();
+      if (fMapping) {
+         sealedPageBuffer = fMapping->fAddress + pageInfo.fLocator.fPosition;
+      } else {
+         directReadBuffer = std::make_unique<unsigned char[]>(bytesOnStorage);
+         fReader.ReadBuffer(directReadBuffer.get(), bytesOnStorage, pageInfo.fLocator.fPosition);
+         fCounters->fNRead.Inc();
+         fCounters->fSzReadPayload.Add(bytesOnStorage);
+         sealedPageBuffer = directReadBuffer.get();
+      }
    } else {
       if (!fCurrentCluster || (fCurrentCluster->GetId() != clusterId) || !fCurrentCluster->ContainsColumn(columnId))
          fCurrentCluster = fClusterPool->GetCluster(clusterId, fActiveColumns);
@@ -348,25 +375,50 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
       sealedPageBuffer = onDiskPage->GetAddress();
    }
 
-   std::unique_ptr<unsigned char []> pageBuffer;
-   {
-      RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
-      pageBuffer = UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element);
-      fCounters->fSzUnzip.Add(elementSize * pageInfo.fNElements);
+   auto newPage = MapSealedPage(columnId, {sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element);
+   const bool isMapped = !newPage.IsNull();
+   if (!isMapped) {
+      std::unique_ptr<unsigned char []> pageBuffer;
+      {
+         RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
+         pageBuffer = UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element);
+         fCounters->fSzUnzip.Add(elementSize * pageInfo.fNElements);
+      }
+      newPage = fPageAllocator->NewPage(columnId, pageBuffer.release(), elementSize, pageInfo.fNElements);
    }
 
-   auto newPage = fPageAllocator->NewPage(columnId, pageBuffer.release(), elementSize, pageInfo.fNElements);
    newPage.SetWindow(clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
                      RPage::RClusterInfo(clusterId, clusterInfo.fColumnOffset));
    fPagePool->RegisterPage(newPage,
-      RPageDeleter([](const RPage &page, void * /*userData*/)
+      RPageDeleter([](const RPage &page, void *userData)
       {
-         RPageAllocatorFile::DeletePage(page);
-      }, nullptr));
+         // Mapped pages are owned by the file mapping
+         if (!userData)
+            RPageAllocatorFile::DeletePage(page);
+      }, isMapped ? fMapping.get() : nullptr));
    fCounters->fNPagePopulated.Inc();
    return newPage;
 }
 
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSourceFile::MapSealedPage(ColumnId_t columnId, const RSealedPage &sealedPage,
+                                                           const RColumnElementBase &element)
+{
+   if (!fMapping || !element.IsMappable())
+      return RPage();
+   // Compressed pages are smaller than their packed size
+   if (sealedPage.fSize != element.GetPackedSize(sealedPage.fNElements))
+      return RPage();
+   // The on-disk position of a page is arbitrary; we only expose properly aligned values
+   const auto elementSize = element.GetSize();
+   if (reinterpret_cast<std::uintptr_t>(sealedPage.fBuffer) % elementSize != 0)
+      return RPage();
+
+   // The mapping is read-only; pages of a page source are never written to
+   return fPageAllocator->NewPage(columnId, const_cast<void *>(sealedPage.fBuffer), elementSize,
+                                  sealedPage.fNElements);
+}
+
 
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::PopulatePage(
    ColumnHandle_t columnHandle, NTupleSize_t globalIndex)
@@ -548,12 +600,52 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
    return cluster;
 }
 
+std::unique_ptr<ROOT::Experimental::Detail::RCluster>
+ROOT::Experimental::Detail::RPageSourceFile::PrepareMappedCluster(const RCluster::RKey &clusterKey)
+{
+   // The page map does not own the memory of the pages: the file mapping outlives the cluster pool
+   auto pageMap = std::make_unique<ROnDiskPageMap>();
+   std::size_t nPages = 0;
+   {
+      auto descriptorGuard = GetSharedDescriptorGuard();
+      const auto &clusterDesc = descriptorGuard->GetClusterDescriptor(clusterKey.fClusterId);
+
+      for (auto columnId : clusterKey.fColumnSet) {
+         const auto &pageRange = clusterDesc.GetPageRange(columnId);
+         NTupleSize_t pageNo = 0;
+         for (const auto &pageInfo : pageRange.fPageInfos) {
+            const auto &pageLocator = pageInfo.fLocator;
+            R__ASSERT(std::uint64_t(pageLocator.fPosition) + pageLocator.fBytesOnStorage <= fMapping->fSize);
+            ROnDiskPage::Key key(columnId, pageNo);
+            pageMap->Register(key,
+                              ROnDiskPage(fMapping->fAddress + pageLocator.fPosition, pageLocator.fBytesOnStorage));
+            ++pageNo;
+         }
+         nPages += pageNo;
+      }
+   }
+   fCounters->fNPageLoaded.Add(nPages);
+
+   auto cluster = std::make_unique<RCluster>(clusterKey.fClusterId);
+   cluster->Adopt(std::move(pageMap));
+   for (auto colId : clusterKey.fColumnSet)
+      cluster->SetColumnAvailable(colId);
+   return cluster;
+}
+
 std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>>
 ROOT::Experimental::Detail::RPageSourceFile::LoadClusters(std::span<RCluster::RKey> clusterKeys)
 {
    fCounters->fNClusterLoaded.Add(clusterKeys.size());
 
    std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>> clusters;
+   if (fMapping) {
+      // The operating system pages in the data on first access
+      for (auto key : clusterKeys)
+         clusters.emplace_back(PrepareMappedCluster(key));
+      return clusters;
+   }
+
    std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
 
    for (auto key: clusterKeys) {
@@ -571,23 +663,53 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadClusters(std::span<RCluster::RK
    return clusters;
 }
 
+void ROOT::Experimental::Detail::RPageSourceFile::StreamClusters(std::span<RCluster::RKey> clusterKeys,
+                                                                const ClusterCallback_t &callback)
+{
+   if (fMapping || !(fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasAsyncIo)) {
+      RPageSource::StreamClusters(clusterKeys, callback);
+      return;
+   }
+
+   fCounters->fNClusterLoaded.Add(clusterKeys.size());
+
+   // One vector read per cluster, all of them in flight at the same time.  The handles are declared last so that
+   // on an exception, the in-flight reads are drained before the cluster buffers are released.
+   const auto nClusters = clusterKeys.size();
+   std::vector<std::unique_ptr<RCluster>> clusters;
+   std::vector<std::vector<ROOT::Internal::RRawFile::RIOVec>> readRequests(nClusters);
+   std::vector<ROOT::Internal::RRawFile::RAsyncReadV> handles(nClusters);
+   for (std::size_t i = 0; i < nClusters; ++i)
+      clusters.emplace_back(PrepareSingleCluster(clusterKeys[i], readRequests[i]));
+
+   for (std::size_t i = 0; i < nClusters; ++i) {
+      RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
+      fFile->SubmitReadV(readRequests[i].data(), readRequests[i].size(), handles[i]);
+   }
+
+   for (std::size_t i = 0; i < nClusters; ++i) {
+      {
+         RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
+         fFile->WaitReadV(handles[i]);
+      }
+      fCounters->fNReadV.Inc();
+      fCounters->fNRead.Add(readRequests[i].size());
+      callback(i, std::move(clusters[i]));
+   }
+}
 
 void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *cluster)
 {
-   RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
-   fTaskScheduler->Reset();
-
    const auto clusterId = cluster->GetId();
    auto descriptorGuard = GetSharedDescriptorGuard();
    const auto &clusterDescriptor = descriptorGuard->GetClusterDescriptor(clusterId);
 
-   std::vector<std::unique_ptr<RColumnElementBase>> allElements;
-
    const auto &columnsInCluster = cluster->GetAvailColumns();
    for (const auto columnId : columnsInCluster) {
       const auto &columnDesc = descriptorGuard->GetColumnDescriptor(columnId);
 
-      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel().GetType()));
+      // Shared by the unzip tasks of the column's pages, which outlive this method
+      std::shared_ptr<RColumnElementBase> element = RColumnElementBase::Generate(columnDesc.GetModel().GetType());
 
       const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
       std::uint64_t pageNo = 0;
@@ -599,20 +721,27 @@ void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *clu
 
          auto taskFunc =
             [this, columnId, clusterId, firstInPage, onDiskPage,
-             element = allElements.back().get(),
+             element,
              nElements = pi.fNElements,
              indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex
             ] () {
-               auto pageBuffer = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element);
-               fCounters->fSzUnzip.Add(element->GetSize() * nElements);
+               const RSealedPage sealedPage{onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements};
+               auto newPage = MapSealedPage(columnId, sealedPage, *element);
+               const bool isMapped = !newPage.IsNull();
+               if (!isMapped) {
+                  auto pageBuffer = UnsealPage(sealedPage, *element);
+                  fCounters->fSzUnzip.Add(element->GetSize() * nElements);
+                  newPage = fPageAllocator->NewPage(columnId, pageBuffer.release(), element->GetSize(), nElements);
+               }
 
-               auto newPage = fPageAllocator->NewPage(columnId, pageBuffer.release(), element->GetSize(), nElements);
                newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
                fPagePool->PreloadPage(newPage,
-                  RPageDeleter([](const RPage &page, void * /*userData*/)
+                  RPageDeleter([](const RPage &page, void *userData)
                   {
-                     RPageAllocatorFile::DeletePage(page);
-                  }, nullptr));
+                     // Mapped pages are owned by the file mapping
+                     if (!userData)
+                        RPageAllocatorFile::DeletePage(page);
+                  }, isMapped ? fMapping.get() : nullptr));
             };
 
          fTaskScheduler->AddTask(taskFunc);
@@ -623,6 +752,4 @@ void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *clu
    } // for all columns in cluster
 
    fCounters->fNPagePopulated.Add(cluster->GetNOnDiskPages());
-
-   fTaskScheduler->Wait();
 }
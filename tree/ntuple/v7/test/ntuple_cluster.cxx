@@ -15,7 +15,9 @@
 #include <ROOT/RStringView.hxx>
 
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -94,6 +96,40 @@ public:
    }
 };
 
+/**
+ * Runs the scheduled tasks only on Wait(), the last added task first
+ */
+class RTaskSchedulerMock : public ROOT::Experimental::Detail::RPageStorage::RTaskScheduler {
+public:
+   std::vector<std::function<void(void)>> fTasks;
+
+   void Reset() final { fTasks.clear(); }
+   void AddTask(const std::function<void(void)> &taskFunc) final { fTasks.emplace_back(taskFunc); }
+   void Wait() final
+   {
+      while (!fTasks.empty()) {
+         auto task = std::move(fTasks.back());
+         fTasks.pop_back();
+         task();
+      }
+   }
+};
+
+/**
+ * Schedules one unzip task per column of a cluster and logs their execution
+ */
+class RPageSourceUnzipMock : public RPageSourceMock {
+protected:
+   void UnzipClusterImpl(RCluster *cluster) final
+   {
+      for (std::size_t i = 0; i < cluster->GetAvailColumns().size(); ++i)
+         fTaskScheduler->AddTask([this, id = cluster->GetId()] { fLog.emplace_back("unzip " + std::to_string(id)); });
+   }
+
+public:
+   std::vector<std::string> fLog;
+};
+
 } // anonymous namespace
 
 
@@ -263,6 +299,46 @@ TEST(ClusterPool, GetClusterBasics)
 }
 
 
+TEST(ClusterPool, GetClusterPrefetchDepth)
+{
+   RPageSourceMock p1;
+   {
+      RClusterPool c1(p1, 1, 3);
+      c1.GetCluster(1, {0});
+      c1.WaitForInFlightClusters();
+   }
+   ASSERT_EQ(4U, p1.fReqsClusterIds.size());
+   EXPECT_EQ(1U, p1.fReqsClusterIds[0]);
+   EXPECT_EQ(2U, p1.fReqsClusterIds[1]);
+   EXPECT_EQ(3U, p1.fReqsClusterIds[2]);
+   EXPECT_EQ(4U, p1.fReqsClusterIds[3]);
+
+   RPageSourceMock p2;
+   {
+      RClusterPool c2(p2, 2, 2);
+      c2.GetCluster(0, {0});
+      c2.WaitForInFlightClusters();
+      // All the clusters are already in the pool or in flight
+      c2.GetCluster(1, {0});
+      c2.WaitForInFlightClusters();
+   }
+   ASSERT_EQ(6U, p2.fReqsClusterIds.size());
+   for (unsigned i = 0; i < 6; ++i)
+      EXPECT_EQ(i, p2.fReqsClusterIds[i]);
+
+   // No prefetching beyond the bunch of the requested cluster
+   RPageSourceMock p3;
+   {
+      RClusterPool c3(p3, 2, 0);
+      c3.GetCluster(0, {0});
+      c3.WaitForInFlightClusters();
+   }
+   ASSERT_EQ(2U, p3.fReqsClusterIds.size());
+   EXPECT_EQ(0U, p3.fReqsClusterIds[0]);
+   EXPECT_EQ(1U, p3.fReqsClusterIds[1]);
+}
+
+
 TEST(ClusterPool, GetClusterIncrementally)
 {
    RPageSourceMock p1;
@@ -281,6 +357,29 @@ TEST(ClusterPool, GetClusterIncrementally)
 }
 
 
+TEST(ClusterPool, UnzipClustersIndividually)
+{
+   RTaskSchedulerMock scheduler;
+   RPageSourceUnzipMock source;
+   source.SetTaskScheduler(&scheduler);
+   std::vector<RCluster::RKey> keys{{0, {0, 1}}, {1, {}}, {2, {0}}};
+   auto clusters = source.LoadClusters(keys);
+   std::vector<RCluster *> clusterPtrs;
+   for (const auto &c : clusters)
+      clusterPtrs.emplace_back(c.get());
+
+   // Every cluster is reported as soon as its own tasks are done; cluster 1 has no pages to unzip
+   source.UnzipClusters(clusterPtrs,
+                        [&source](std::size_t i) { source.fLog.emplace_back("ready " + std::to_string(i)); });
+   const std::vector<std::string> expected{"ready 1", "unzip 2", "ready 2", "unzip 0", "unzip 0", "ready 0"};
+   EXPECT_EQ(expected, source.fLog);
+
+   source.fLog.clear();
+   source.UnzipClusters(clusterPtrs);
+   EXPECT_EQ(3U, source.fLog.size());
+}
+
+
 TEST(PageStorageFile, LoadClusters)
 {
    FileRaii fileGuard("test_pagestoragefile_loadclusters.root");
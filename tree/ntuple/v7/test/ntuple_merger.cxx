@@ -1,5 +1,7 @@
 #include "ntuple_test.hxx"
 
+#include <TFileMerger.h>
+
 namespace {
 
 // Reads an integer from a little-endian 4 byte buffer
@@ -15,6 +17,41 @@ std::int32_t ReadRawInt(const void *ptr)
 #endif
 }
 
+// Writes nEntries entries with pt = offset + i and i % 10 jets into the given file, in two clusters
+void WriteInput(const std::string &path, float offset, int compression, int nEntries = 10)
+{
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   auto fieldJets = model->MakeField<std::vector<std::int32_t>>("jets");
+   RNTupleWriteOptions options;
+   options.SetCompression(compression);
+   auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", path, options);
+   for (int i = 0; i < nEntries; ++i) {
+      *fieldPt = offset + i;
+      fieldJets->assign(i % 10, i % 10);
+      ntuple->Fill();
+      if (i == 4)
+         ntuple->CommitCluster();
+   }
+}
+
+// Checks the merge of an input written with offset 0 and nEntries1 entries and an input written with offset 100
+// and nEntries2 entries
+void CheckMerged(const std::string &path, int nEntries1 = 10, int nEntries2 = 10)
+{
+   auto ntuple = RNTupleReader::Open("ntpl", path);
+   EXPECT_EQ(static_cast<ROOT::Experimental::NTupleSize_t>(nEntries1 + nEntries2), ntuple->GetNEntries());
+   EXPECT_EQ(4U, ntuple->GetDescriptor()->GetNClusters());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewJets = ntuple->GetView<std::vector<std::int32_t>>("jets");
+   for (auto i : ntuple->GetEntryRange()) {
+      const bool isFirst = i < static_cast<ROOT::Experimental::NTupleSize_t>(nEntries1);
+      const int idx = isFirst ? i : (i - nEntries1);
+      EXPECT_FLOAT_EQ(isFirst ? idx : (100 + idx), viewPt(i));
+      EXPECT_EQ(std::vector<std::int32_t>(idx % 10, idx % 10), viewJets(i));
+   }
+}
+
 } // anonymous namespace
 
 TEST(RPageStorage, ReadSealedPages)
@@ -80,3 +117,107 @@ TEST(RFieldMerger, Merge)
    auto mergeResult = RFieldMerger::Merge(RFieldDescriptor(), RFieldDescriptor());
    EXPECT_FALSE(mergeResult);
 }
+
+TEST(RNTupleMerger, Merge)
+{
+   FileRaii fileGuard1("test_ntuple_merge_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_in_2.root");
+   FileRaii fileGuard3("test_ntuple_merge_out.root");
+   WriteInput(fileGuard1.GetPath(), 0, 505);
+   // The pages of the second input need to be recompressed
+   WriteInput(fileGuard2.GetPath(), 100, 0);
+
+   {
+      RPageSourceFile source1("ntpl", fileGuard1.GetPath(), RNTupleReadOptions());
+      RPageSourceFile source2("ntpl", fileGuard2.GetPath(), RNTupleReadOptions());
+      source1.Attach();
+      source2.Attach();
+      std::vector<ROOT::Experimental::Detail::RPageSource *> sources{&source1, &source2};
+      RNTupleWriteOptions options;
+      options.SetCompression(505);
+      RPageSinkFile destination("ntpl", fileGuard3.GetPath(), options);
+      RNTupleMerger merger;
+      merger.Merge(sources, destination);
+   }
+   CheckMerged(fileGuard3.GetPath());
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard3.GetPath());
+   const auto &desc = *ntuple->GetDescriptor();
+   const auto columnId = desc.FindColumnId(desc.FindFieldId("pt"), 0);
+   for (const auto &clusterDesc : desc.GetClusterIterable())
+      EXPECT_EQ(505, clusterDesc.GetColumnRange(columnId).fCompressionSettings);
+}
+
+TEST(RNTupleMerger, MergeIncompatible)
+{
+   FileRaii fileGuard1("test_ntuple_merge_incompatible_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_incompatible_in_2.root");
+   FileRaii fileGuard3("test_ntuple_merge_incompatible_out.root");
+   WriteInput(fileGuard1.GetPath(), 0, 505);
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = model->MakeField<double>("pt");
+      auto fieldJets = model->MakeField<std::vector<std::int32_t>>("jets");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard2.GetPath());
+      ntuple->Fill();
+   }
+
+   RPageSourceFile source1("ntpl", fileGuard1.GetPath(), RNTupleReadOptions());
+   RPageSourceFile source2("ntpl", fileGuard2.GetPath(), RNTupleReadOptions());
+   source1.Attach();
+   source2.Attach();
+   std::vector<ROOT::Experimental::Detail::RPageSource *> sources{&source1, &source2};
+   RPageSinkFile destination("ntpl", fileGuard3.GetPath(), RNTupleWriteOptions());
+   RNTupleMerger merger;
+   try {
+      merger.Merge(sources, destination);
+      FAIL() << "merging RNTuples with different field types should throw";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("field 'pt' has type double instead of float"));
+   }
+}
+
+TEST(RNTupleMerger, TFileMerger)
+{
+   FileRaii fileGuard1("test_ntuple_hadd_in_1.root");
+   FileRaii fileGuard2("test_ntuple_hadd_in_2.root");
+   FileRaii fileGuard3("test_ntuple_hadd_out.root");
+   WriteInput(fileGuard1.GetPath(), 0, 505);
+   WriteInput(fileGuard2.GetPath(), 100, 505, 1000);
+
+   {
+      TFileMerger fileMerger(kFALSE, kFALSE);
+      fileMerger.OutputFile(fileGuard3.GetPath().c_str(), "RECREATE");
+      fileMerger.AddFile(fileGuard1.GetPath().c_str());
+      fileMerger.AddFile(fileGuard2.GetPath().c_str());
+      EXPECT_TRUE(fileMerger.Merge());
+   }
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard3.GetPath());
+   EXPECT_EQ(1010U, ntuple->GetNEntries());
+   ntuple.reset();
+   CheckMerged(fileGuard3.GetPath(), 10, 1000);
+}
+
+TEST(RNTupleMerger, TFileMergerAppend)
+{
+   FileRaii fileGuard1("test_ntuple_hadd_append_in_1.root");
+   FileRaii fileGuard2("test_ntuple_hadd_append_in_2.root");
+   FileRaii fileGuard3("test_ntuple_hadd_append_out.root");
+   WriteInput(fileGuard1.GetPath(), 0, 505);
+   WriteInput(fileGuard2.GetPath(), 100, 505);
+
+   {
+      TFileMerger fileMerger(kFALSE, kFALSE);
+      fileMerger.OutputFile(fileGuard3.GetPath().c_str(), "RECREATE");
+      fileMerger.AddFile(fileGuard1.GetPath().c_str());
+      EXPECT_TRUE(fileMerger.Merge());
+   }
+   // Like hadd -a
+   {
+      TFileMerger fileMerger(kFALSE, kFALSE);
+      fileMerger.OutputFile(fileGuard3.GetPath().c_str(), "UPDATE");
+      fileMerger.AddFile(fileGuard2.GetPath().c_str());
+      EXPECT_TRUE(fileMerger.PartialMerge(TFileMerger::kIncremental | TFileMerger::kAll));
+   }
+   CheckMerged(fileGuard3.GetPath());
+}
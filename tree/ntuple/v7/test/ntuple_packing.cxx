@@ -1,5 +1,9 @@
 #include "ntuple_test.hxx"
 
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
 TEST(Packing, Bitfield)
 {
    ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit> element(nullptr);
@@ -50,3 +54,110 @@ TEST(Packing, RColumnSwitch)
    EXPECT_EQ(0xaa, s2.GetIndex());
    EXPECT_EQ(0x55, s2.GetTag());
 }
+
+TEST(Packing, SplitReal32)
+{
+   ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32> element(nullptr);
+   EXPECT_FALSE(element.IsMappable());
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   float mem[] = {1.0, 2.0, -3.5, 0.0, std::numeric_limits<float>::max()};
+   unsigned char packed[sizeof(mem)];
+   element.Pack(packed, mem, 5);
+   // The first byte stream contains the least significant bytes
+   std::uint32_t bits;
+   std::memcpy(&bits, &mem[2], sizeof(bits));
+   EXPECT_EQ(bits & 0xff, packed[2]);
+   EXPECT_EQ(bits >> 24, packed[3 * 5 + 2]);
+
+   float unpacked[5];
+   element.Unpack(unpacked, packed, 5);
+   for (unsigned i = 0; i < 5; ++i) {
+      EXPECT_EQ(mem[i], unpacked[i]);
+   }
+}
+
+TEST(Packing, SplitReal64)
+{
+   ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64> element(nullptr);
+   double mem[] = {1.0, 2.0, -3.5, 0.0, std::numeric_limits<double>::lowest()};
+   unsigned char packed[sizeof(mem)];
+   element.Pack(packed, mem, 5);
+   double unpacked[5];
+   element.Unpack(unpacked, packed, 5);
+   for (unsigned i = 0; i < 5; ++i) {
+      EXPECT_EQ(mem[i], unpacked[i]);
+   }
+}
+
+TEST(Packing, SplitInt)
+{
+   ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32> element(
+      nullptr);
+   std::int32_t mem[] = {0, -1, 1, -2, std::numeric_limits<std::int32_t>::min(),
+                         std::numeric_limits<std::int32_t>::max()};
+   unsigned char packed[sizeof(mem)];
+   element.Pack(packed, mem, 6);
+   // Zigzag encoding: 0 --> 0, -1 --> 1, 1 --> 2, -2 --> 3
+   for (unsigned i = 0; i < 4; ++i) {
+      EXPECT_EQ(i, packed[i]);
+      EXPECT_EQ(0, packed[6 + i]);
+   }
+   std::int32_t unpacked[6];
+   element.Unpack(unpacked, packed, 6);
+   for (unsigned i = 0; i < 6; ++i) {
+      EXPECT_EQ(mem[i], unpacked[i]);
+   }
+
+   ROOT::Experimental::Detail::RColumnElement<std::uint16_t, ROOT::Experimental::EColumnType::kSplitInt16> element16(
+      nullptr);
+   std::uint16_t mem16[] = {0, 1, 0x7fff, 0x8000, 0xffff};
+   unsigned char packed16[sizeof(mem16)];
+   element16.Pack(packed16, mem16, 5);
+   // No zigzag encoding for unsigned integers
+   EXPECT_EQ(1, packed16[1]);
+   EXPECT_EQ(0, packed16[5 + 1]);
+   EXPECT_EQ(0, packed16[3]);
+   EXPECT_EQ(0x80, packed16[5 + 3]);
+   std::uint16_t unpacked16[5];
+   element16.Unpack(unpacked16, packed16, 5);
+   for (unsigned i = 0; i < 5; ++i) {
+      EXPECT_EQ(mem16[i], unpacked16[i]);
+   }
+
+   ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64> element64(
+      nullptr);
+   std::int64_t mem64[] = {0, -42, 42, std::numeric_limits<std::int64_t>::min(),
+                           std::numeric_limits<std::int64_t>::max()};
+   unsigned char packed64[sizeof(mem64)];
+   element64.Pack(packed64, mem64, 5);
+   std::int64_t unpacked64[5];
+   element64.Unpack(unpacked64, packed64, 5);
+   for (unsigned i = 0; i < 5; ++i) {
+      EXPECT_EQ(mem64[i], unpacked64[i]);
+   }
+}
+
+TEST(Packing, SplitIndex)
+{
+   ROOT::Experimental::Detail::RColumnElement<ClusterSize_t, ROOT::Experimental::EColumnType::kSplitIndex32> element(
+      nullptr);
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   ClusterSize_t mem[] = {ClusterSize_t{1}, ClusterSize_t{1}, ClusterSize_t{3}, ClusterSize_t{1000},
+                          ClusterSize_t{2}};
+   unsigned char packed[sizeof(mem)];
+   element.Pack(packed, mem, 5);
+   // Delta encoding: the first byte stream holds the differences to the previous element
+   EXPECT_EQ(1, packed[0]);
+   EXPECT_EQ(0, packed[1]);
+   EXPECT_EQ(2, packed[2]);
+
+   ClusterSize_t unpacked[5];
+   element.Unpack(unpacked, packed, 5);
+   for (unsigned i = 0; i < 5; ++i) {
+      EXPECT_EQ(static_cast<ClusterSize_t::ValueType>(mem[i]), static_cast<ClusterSize_t::ValueType>(unpacked[i]));
+   }
+}
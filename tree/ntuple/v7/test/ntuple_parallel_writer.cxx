@@ -0,0 +1,155 @@
+#include "ntuple_test.hxx"
+
+TEST(RNTupleParallelWriter, Basics)
+{
+   FileRaii fileGuard("test_ntuple_parallel_basics.root");
+
+   auto model = RNTupleModel::Create();
+   model->MakeField<float>("pt");
+   model->MakeField<std::vector<std::int32_t>>("vec");
+
+   {
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      auto context1 = writer->CreateFillContext();
+      auto context2 = writer->CreateFillContext();
+
+      auto entry1 = context1->CreateEntry();
+      *entry1->Get<float>("pt") = 1.0;
+      *entry1->Get<std::vector<std::int32_t>>("vec") = {1, 2};
+      context1->Fill(*entry1);
+
+      // The default entry of the context's model
+      *context2->GetModel()->GetDefaultEntry()->Get<float>("pt") = 2.0;
+      *context2->GetModel()->GetDefaultEntry()->Get<std::vector<std::int32_t>>("vec") = {3};
+      context2->Fill();
+      context2->CommitCluster();
+      EXPECT_EQ(1U, writer->GetNEntries());
+
+      context1->CommitCluster();
+      EXPECT_EQ(2U, writer->GetNEntries());
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   EXPECT_EQ(2U, ntuple->GetNEntries());
+   EXPECT_EQ(2U, ntuple->GetDescriptor()->GetNClusters());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewVec = ntuple->GetView<std::vector<std::int32_t>>("vec");
+   // The cluster of the second context was committed first
+   EXPECT_FLOAT_EQ(2.0, viewPt(0));
+   EXPECT_EQ(std::vector<std::int32_t>({3}), viewVec(0));
+   EXPECT_FLOAT_EQ(1.0, viewPt(1));
+   EXPECT_EQ(std::vector<std::int32_t>({1, 2}), viewVec(1));
+}
+
+TEST(RNTupleParallelWriter, Options)
+{
+   FileRaii fileGuard("test_ntuple_parallel_options.root");
+
+   // The fill contexts buffer the pages in any case
+   RNTupleWriteOptions options;
+   options.SetUseBufferedWrite(false);
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<float>("pt");
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      auto context = writer->CreateFillContext();
+      auto entry = context->CreateEntry();
+      *entry->Get<float>("pt") = 42.0;
+      context->Fill(*entry);
+
+      auto otherModel = RNTupleModel::Create();
+      otherModel->MakeField<float>("pt");
+      otherModel->Freeze();
+      auto otherEntry = otherModel->CreateEntry();
+      EXPECT_THROW(context->Fill(*otherEntry), RException);
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   EXPECT_EQ(1U, ntuple->GetNEntries());
+   EXPECT_FLOAT_EQ(42.0, ntuple->GetView<float>("pt")(0));
+}
+
+TEST(RNTupleParallelWriter, EntryOfOtherContext)
+{
+   FileRaii fileGuard("test_ntuple_parallel_other_context.root");
+
+   auto model = RNTupleModel::Create();
+   model->MakeField<float>("pt");
+   {
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      auto context1 = writer->CreateFillContext();
+      auto context2 = writer->CreateFillContext();
+      // The models of both contexts have the same id, but the entry is bound to the fields of context2
+      auto entry2 = context2->CreateEntry();
+      *entry2->Get<float>("pt") = 1.0;
+      EXPECT_THROW(context1->Fill(*entry2), RException);
+      EXPECT_THROW(context1->Fill(*context2->GetModel()->GetDefaultEntry()), RException);
+      context2->Fill(*entry2);
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   EXPECT_EQ(1U, ntuple->GetNEntries());
+}
+
+TEST(RNTupleParallelWriter, MultiThreaded)
+{
+   FileRaii fileGuard("test_ntuple_parallel_mt.root");
+
+   constexpr int kNThreads = 4;
+   constexpr int kNEntriesPerThread = 25000;
+
+   auto model = RNTupleModel::Create();
+   model->MakeField<std::int32_t>("thread");
+   model->MakeField<std::int32_t>("i");
+   model->MakeField<std::vector<float>>("vec");
+
+   RNTupleWriteOptions options;
+   // Force many small clusters
+   options.SetApproxZippedClusterSize(4 * 1024);
+   {
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      std::vector<std::thread> threads;
+      for (int t = 0; t < kNThreads; ++t) {
+         threads.emplace_back([&writer, t] {
+            auto context = writer->CreateFillContext();
+            auto entry = context->CreateEntry();
+            auto thread = entry->Get<std::int32_t>("thread");
+            auto i = entry->Get<std::int32_t>("i");
+            auto vec = entry->Get<std::vector<float>>("vec");
+            for (int n = 0; n < kNEntriesPerThread; ++n) {
+               *thread = t;
+               *i = n;
+               vec->assign(n % 5, static_cast<float>(n));
+               context->Fill(*entry);
+            }
+         });
+      }
+      for (auto &t : threads)
+         t.join();
+      EXPECT_EQ(static_cast<NTupleSize_t>(kNThreads * kNEntriesPerThread), writer->GetNEntries());
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   EXPECT_EQ(static_cast<NTupleSize_t>(kNThreads * kNEntriesPerThread), ntuple->GetNEntries());
+   EXPECT_GT(ntuple->GetDescriptor()->GetNClusters(), static_cast<std::size_t>(kNThreads));
+
+   auto viewThread = ntuple->GetView<std::int32_t>("thread");
+   auto viewI = ntuple->GetView<std::int32_t>("i");
+   auto viewVec = ntuple->GetView<std::vector<float>>("vec");
+   // Within every thread, entries are written in order, possibly interleaved with clusters of other threads
+   std::vector<std::int32_t> next(kNThreads, 0);
+   for (auto idx : ntuple->GetEntryRange()) {
+      auto t = viewThread(idx);
+      ASSERT_GE(t, 0);
+      ASSERT_LT(t, kNThreads);
+      auto n = viewI(idx);
+      EXPECT_EQ(next[t], n);
+      next[t] = n + 1;
+      const auto &vec = viewVec(idx);
+      ASSERT_EQ(static_cast<std::size_t>(n % 5), vec.size());
+      for (auto v : vec)
+         EXPECT_FLOAT_EQ(static_cast<float>(n), v);
+   }
+   for (auto n : next)
+      EXPECT_EQ(kNEntriesPerThread, n);
+}
@@ -120,6 +120,195 @@ TEST(RNTuple, Extended)
    EXPECT_EQ(chksumRead, chksumWrite);
 }
 
+TEST(RNTuple, Mmap)
+{
+   FileRaii fileGuard("test_ntuple_mmap.root");
+
+   auto model = RNTupleModel::Create();
+   auto wrByte = model->MakeField<std::uint8_t>("byte");
+   {
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (unsigned int i = 0; i < 10000; ++i) {
+         *wrByte = i % 256;
+         ntuple->Fill();
+         if (i % 1000 == 0)
+            ntuple->CommitCluster();
+      }
+   }
+
+   for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOn, RNTupleReadOptions::EClusterCache::kOff}) {
+      RNTupleReadOptions options;
+      options.SetUseMmap(true);
+      options.SetClusterCache(clusterCache);
+      auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+      ntuple->EnableMetrics();
+      auto viewByte = ntuple->GetView<std::uint8_t>("byte");
+      for (auto i : ntuple->GetEntryRange()) {
+         EXPECT_EQ(i % 256, viewByte(i));
+      }
+      // Uncompressed byte pages are used in place
+      auto szUnzip = ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.szUnzip");
+      ASSERT_NE(nullptr, szUnzip);
+      EXPECT_EQ(0, szUnzip->GetValueAsInt());
+   }
+}
+
+TEST(RNTuple, MmapFloatingPoint)
+{
+   FileRaii fileGuard("test_ntuple_mmap_floatingpoint.root");
+
+   for (bool useSplitEncoding : {true, false}) {
+      auto model = RNTupleModel::Create();
+      auto wrFloat = model->MakeField<float>("float");
+      auto wrDouble = model->MakeField<double>("double");
+      {
+         RNTupleWriteOptions options;
+         options.SetCompression(0);
+         options.SetUseSplitEncoding(useSplitEncoding);
+         auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+         for (unsigned int i = 0; i < 10000; ++i) {
+            *wrFloat = i + 0.5f;
+            *wrDouble = -2. * i;
+            ntuple->Fill();
+            if (i % 1000 == 0)
+               ntuple->CommitCluster();
+         }
+      }
+
+      for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOn, RNTupleReadOptions::EClusterCache::kOff}) {
+         RNTupleReadOptions options;
+         options.SetUseMmap(true);
+         options.SetClusterCache(clusterCache);
+         auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+         ntuple->EnableMetrics();
+         auto viewFloat = ntuple->GetView<float>("float");
+         auto viewDouble = ntuple->GetView<double>("double");
+         for (auto i : ntuple->GetEntryRange()) {
+            EXPECT_FLOAT_EQ(i + 0.5f, viewFloat(i));
+            EXPECT_DOUBLE_EQ(-2. * i, viewDouble(i));
+         }
+         // Uncompressed pages in plain encoding are used in place; split pages need to be unsplit
+         auto szUnzip = ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.szUnzip");
+         ASSERT_NE(nullptr, szUnzip);
+         if (useSplitEncoding)
+            EXPECT_GT(szUnzip->GetValueAsInt(), 0);
+         else
+            EXPECT_EQ(0, szUnzip->GetValueAsInt());
+      }
+   }
+}
+
+TEST(RNTuple, MmapCompressed)
+{
+   FileRaii fileGuard("test_ntuple_mmap_compressed.root");
+
+   auto model = RNTupleModel::Create();
+   auto wrVector = model->MakeField<std::vector<double>>("vector");
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      for (unsigned int i = 0; i < 1000; ++i) {
+         wrVector->assign(i % 10, i);
+         ntuple->Fill();
+      }
+   }
+
+   // Compressed pages fall back to unzipping from the mapped file
+   RNTupleReadOptions options;
+   options.SetUseMmap(true);
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+   auto viewVector = ntuple->GetView<std::vector<double>>("vector");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(std::vector<double>(i % 10, i), viewVector(i));
+   }
+}
+
+TEST(RNTuple, PageStatistics)
+{
+   FileRaii fileGuard("test_ntuple_page_statistics.root");
+
+   auto model = RNTupleModel::Create();
+   auto wrPt = model->MakeField<float>("pt");
+   auto wrId = model->MakeField<std::int64_t>("id");
+   auto wrTag = model->MakeField<std::string>("tag");
+   {
+      RNTupleWriteOptions options;
+      options.SetEnablePageStatistics(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (unsigned int i = 0; i < 1000; ++i) {
+         // Cluster c contains values in [100 * c, 100 * c + 99]
+         *wrPt = i;
+         *wrId = -static_cast<std::int64_t>(i);
+         *wrTag = "x";
+         ntuple->Fill();
+         if (i % 100 == 99)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   const auto *desc = ntuple->GetDescriptor();
+   EXPECT_EQ(10U, desc->GetNClusters());
+   const auto ptColumnId = desc->FindColumnId(desc->FindFieldId("pt"), 0);
+   const auto &clusterDesc = desc->GetClusterDescriptor(desc->FindClusterId(ptColumnId, 250));
+   const auto &columnRange = clusterDesc.GetColumnRange(ptColumnId);
+   EXPECT_TRUE(columnRange.fValueRange.fIsValid);
+   EXPECT_EQ(200.0, columnRange.fValueRange.fMin);
+   EXPECT_EQ(299.0, columnRange.fValueRange.fMax);
+   // No statistics for the offset column of the string
+   const auto tagColumnId = desc->FindColumnId(desc->FindFieldId("tag"), 0);
+   EXPECT_FALSE(
+      desc->GetClusterDescriptor(desc->FindClusterId(tagColumnId, 0)).GetColumnRange(tagColumnId).fValueRange.fIsValid);
+
+   auto fnGetEntries = [](std::vector<RNTupleGlobalRange> ranges) {
+      std::vector<NTupleSize_t> entries;
+      for (auto range : ranges) {
+         for (auto i : range)
+            entries.emplace_back(i);
+      }
+      return entries;
+   };
+
+   auto entries = fnGetEntries(ntuple->GetEntryRanges("pt", 250, 350));
+   ASSERT_EQ(200U, entries.size());
+   EXPECT_EQ(200U, entries.front());
+   EXPECT_EQ(399U, entries.back());
+   EXPECT_EQ(100U, fnGetEntries(ntuple->GetEntryRanges("id", -50, -10)).size());
+   EXPECT_EQ(200U, fnGetEntries(ntuple->GetEntryRanges("pt", 0, 99.5)).size() +
+                      fnGetEntries(ntuple->GetEntryRanges("pt", 950, 2000)).size());
+   EXPECT_TRUE(ntuple->GetEntryRanges("pt", 1000, 2000).empty());
+   EXPECT_EQ(1000U, fnGetEntries(ntuple->GetEntryRanges("tag", 1000, 2000)).size());
+   EXPECT_THROW(ntuple->GetEntryRanges("nonexistent", 0, 1), RException);
+}
+
+TEST(RNTuple, PageStatisticsDisabled)
+{
+   FileRaii fileGuard("test_ntuple_page_statistics_disabled.root");
+
+   auto model = RNTupleModel::Create();
+   auto wrPt = model->MakeField<double>("pt");
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      for (unsigned int i = 0; i < 10; ++i) {
+         *wrPt = i;
+         ntuple->Fill();
+         ntuple->CommitCluster();
+      }
+   }
+
+   // Without statistics, no cluster is skipped
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   auto ranges = ntuple->GetEntryRanges("pt", 1000, 2000);
+   ASSERT_EQ(1U, ranges.size());
+   NTupleSize_t nEntries = 0;
+   for (auto i : ranges[0]) {
+      EXPECT_EQ(nEntries, i);
+      nEntries++;
+   }
+   EXPECT_EQ(10U, nEntries);
+}
+
 TEST(RNTuple, InvalidWriteOptions) {
    RNTupleWriteOptions options;
    try {
@@ -268,6 +457,110 @@ TEST(RNTuple, PageFillingString) {
    EXPECT_EQ(8u, pr4.fPageInfos[1].fNElements);
 }
 
+TEST(RNTuple, AdaptivePageSize)
+{
+   FileRaii fileGuard("test_ntuple_adaptive_page_size.root");
+
+   auto model = RNTupleModel::Create();
+   auto fldFlag = model->MakeField<std::uint8_t>("flag");
+   auto fldNoise = model->MakeField<std::uint64_t>("noise");
+
+   RNTupleWriteOptions options;
+   options.SetApproxUnzippedPageSize(4096);
+   options.SetMaxUnzippedPageSize(64 * 1024);
+   options.SetUseAdaptivePageSize(true);
+   options.SetCompression(505);
+
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      std::uint64_t state = 137;
+      for (unsigned i = 0; i < 60000; ++i) {
+         // xorshift: incompressible data
+         state ^= state << 13;
+         state ^= state >> 7;
+         state ^= state << 17;
+         *fldFlag = 1;
+         *fldNoise = state;
+         ntuple->Fill();
+         if ((i + 1) % 20000 == 0)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   const auto desc = ntuple->GetDescriptor();
+   EXPECT_EQ(3u, desc->GetNClusters());
+   const auto flagColumnId = desc->FindColumnId(desc->FindFieldId("flag"), 0);
+   const auto noiseColumnId = desc->FindColumnId(desc->FindFieldId("noise"), 0);
+
+   // The first cluster is written with the default page size
+   const auto &cd1 = desc->GetClusterDescriptor(desc->FindClusterId(flagColumnId, 0));
+   EXPECT_EQ(4096u, cd1.GetPageRange(flagColumnId).fPageInfos[0].fNElements);
+   EXPECT_EQ(512u, cd1.GetPageRange(noiseColumnId).fPageInfos[0].fNElements);
+
+   // The constant column compresses very well; its pages grow up to the volume of the column in a cluster
+   const auto &cd3 = desc->GetClusterDescriptor(desc->FindClusterId(flagColumnId, 40000));
+   const auto &flagPages = cd3.GetPageRange(flagColumnId).fPageInfos;
+   ASSERT_EQ(1u, flagPages.size());
+   EXPECT_EQ(20000u, flagPages[0].fNElements);
+   // The incompressible column keeps approximately the default page size
+   const auto &noisePages = cd3.GetPageRange(noiseColumnId).fPageInfos;
+   EXPECT_GT(noisePages.size(), 30u);
+   for (std::size_t i = 0; i + 1 < noisePages.size(); ++i)
+      EXPECT_EQ(512u, noisePages[i].fNElements);
+
+   auto viewNoise = ntuple->GetView<std::uint64_t>("noise");
+   std::uint64_t state = 137;
+   for (auto i : ntuple->GetEntryRange()) {
+      state ^= state << 13;
+      state ^= state >> 7;
+      state ^= state << 17;
+      ASSERT_EQ(state, viewNoise(i));
+   }
+}
+
+TEST(RNTuple, PageBufferBudget)
+{
+   FileRaii fileGuard("test_ntuple_page_buffer_budget.root");
+
+   auto model = RNTupleModel::Create();
+   std::vector<std::shared_ptr<float>> fields;
+   for (int i = 0; i < 10; ++i)
+      fields.emplace_back(model->MakeField<float>("f" + std::to_string(i), i));
+
+   RNTupleWriteOptions options;
+   options.SetApproxUnzippedPageSize(64 * 1024);
+   // Every column gets two write pages of 1.5 times the page size: the budget is sufficient for 8 kB pages
+   options.SetPageBufferBudget(10 * 3 * 8 * 1024);
+
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (unsigned i = 0; i < 50000; ++i) {
+         ntuple->Fill();
+         if (i == 19999)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   const auto desc = ntuple->GetDescriptor();
+   EXPECT_EQ(50000u, ntuple->GetNEntries());
+   EXPECT_EQ(2u, desc->GetNClusters());
+   for (int i = 0; i < 10; ++i) {
+      const auto columnId = desc->FindColumnId(desc->FindFieldId("f" + std::to_string(i)), 0);
+      // The budget applies from the very first page on
+      for (NTupleSize_t index : {0, 20000}) {
+         const auto &cd = desc->GetClusterDescriptor(desc->FindClusterId(columnId, index));
+         const auto &pageInfos = cd.GetPageRange(columnId).fPageInfos;
+         EXPECT_GT(pageInfos.size(), index == 0 ? 6u : 10u);
+         for (const auto &pi : pageInfos)
+            EXPECT_LE(pi.fNElements, 3u * 1024u);
+      }
+   }
+   auto viewF9 = ntuple->GetView<float>("f9");
+   EXPECT_FLOAT_EQ(9.0, viewF9(49999));
+}
+
 TEST(RPageSinkBuf, Basics)
 {
    struct TestModel {
@@ -93,6 +93,51 @@ TEST(RNTuple, BulkView)
    }
 }
 
+TEST(RNTuple, BulkViewSpan)
+{
+   FileRaii fileGuard("test_ntuple_bulk_view_span.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   auto eltsPerPage = 1000;
+   {
+      RNTupleWriteOptions opt;
+      opt.SetApproxUnzippedPageSize(eltsPerPage * sizeof(float));
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), opt);
+      for (int i = 0; i < 10'000; i++) {
+         *fieldPt = i;
+         ntuple->Fill();
+      }
+   }
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   auto viewPt = ntuple->GetView<float>("pt");
+
+   EXPECT_TRUE(viewPt.GetSpan(0, 0).empty());
+
+   // Within a single page, the span points into the page buffer
+   NTupleSize_t nPageItems = 0;
+   const float *buf = viewPt.MapV(10, nPageItems);
+   auto span = viewPt.GetSpan(10, 100);
+   EXPECT_EQ(buf, span.data());
+   ASSERT_EQ(100U, span.size());
+   for (std::size_t i = 0; i < span.size(); i++) {
+      EXPECT_FLOAT_EQ(10.0 + i, span[i]) << i;
+   }
+
+   // Across page boundaries, the values are gathered
+   auto gathered = viewPt.GetSpan(eltsPerPage - 5, 2 * eltsPerPage + 10);
+   ASSERT_EQ(static_cast<std::size_t>(2 * eltsPerPage + 10), gathered.size());
+   for (std::size_t i = 0; i < gathered.size(); i++) {
+      EXPECT_FLOAT_EQ(eltsPerPage - 5.0 + i, gathered[i]) << i;
+   }
+
+   auto all = viewPt.GetSpan(0, ntuple->GetNEntries());
+   ASSERT_EQ(ntuple->GetNEntries(), all.size());
+   EXPECT_FLOAT_EQ(9999.0, all.back());
+
+   EXPECT_THROW(viewPt.GetSpan(9'990, 11), RException);
+}
+
 TEST(RNTuple, BulkViewCollection)
 {
    FileRaii fileGuard("test_ntuple_bulk_view_collection.root");
@@ -44,6 +44,7 @@ private:
 
    // Helper for managing the compressed buffer.
    void InitializeCompressedBuffer(Int_t len, TFile* file);
+   void UseOwnCompressedBuffer();
 
    // Handles special logic around deleting / reseting the entry offset pointer.
    void ResetEntryOffset();
@@ -58,6 +59,10 @@ private:
    void   DisownBuffer();
    void   AdoptBuffer(TBuffer *user_buffer);
 
+   // The two stages of WriteBuffer; TBranch runs the compression stage asynchronously during TTree::Fill.
+   Int_t  CompressBuffer(TFile *file);
+   Int_t  WriteCompressedBuffer(Int_t nout, TFile *file);
+
 protected:
    Int_t       fBufferSize{0};                    ///< fBuffer length in bytes
    Int_t       fNevBufSize{0};                    ///< Length in Int_t of fEntryOffset OR fixed length of each entry if fEntryOffset is null!
@@ -64,6 +64,7 @@ class TEntryList: public TNamed
    virtual void        Add(const TEntryList *elist);
    void                AddSubList(TEntryList *elist);
    virtual Int_t       Contains(Long64_t entry, TTree *tree = nullptr);
+   virtual Bool_t      ContainsRange(Long64_t entrymin, Long64_t entrymax);
    virtual void        DirectoryAutoAdd(TDirectory *);
    virtual Bool_t      Enter(Long64_t entry, TTree *tree = nullptr);
    virtual Bool_t      Enter(Long64_t localentry, const char *treename, const char *filename);
@@ -27,6 +27,7 @@
 
 class TTree;
 class TBranch;
+class TEntryList;
 class TObjArray;
 
 class TTreeCache : public TFileCacheRead {
@@ -104,6 +105,8 @@ protected:
 
    std::unique_ptr<MissCache> fMissCache; ///<! Cache contents for misses
 
+   TEntryList *GetLocalEntryList() const; ///< Entry list of the current tree, in local entry numbers, if any.
+
 private:
    TTreeCache(const TTreeCache &) = delete; ///< this class cannot be copied
    TTreeCache &operator=(const TTreeCache &) = delete;
@@ -17,6 +17,8 @@
 #include "TTreeCache.h"
 #include <atomic>
 #include <memory>
+#include <mutex>
+#include <utility>
 #include <vector>
 
 class TBasket;
@@ -77,6 +79,21 @@ protected:
    typedef struct UnzipState UnzipState_t;
    UnzipState_t fUnzipState;
 
+   // Recycled buffers for reading and inflating baskets, shared by the unzipping tasks
+   struct UnzipBufferPool {
+      std::mutex fMutex;
+      std::vector<std::pair<Int_t, std::unique_ptr<char[]>>> fFree; ///<! Idle buffers and their capacity
+      Long64_t fFreeBytes = 0;  ///<! Summed capacity of the idle buffers
+      Long64_t fMaxBytes = 0;   ///<! Max summed capacity of the idle buffers
+      Int_t    fNReused = 0;    ///<! Number of requests served by an idle buffer
+      Int_t    fNAllocated = 0; ///<! Number of requests that needed a new allocation
+
+      char  *Acquire(Int_t len, Int_t maxlen, Int_t &capacity);
+      void   Clear();
+      void   Release(char *buf, Int_t capacity);
+   };
+   UnzipBufferPool fUnzipPool;
+
    // Members for paral. managing
    Bool_t      fAsyncReading;
    Bool_t      fEmpty;
@@ -96,6 +113,8 @@ protected:
    Int_t       fNseekMax;         ///<!  fNseek can change so we need to know its max size
    Int_t       fUnzipGroupSize;   ///<!  Min accumulated size of a group of baskets ready to be unzipped by a IMT task
    Long64_t    fUnzipBufferSize;  ///<!  Max Size for the ready unzipped blocks (default is 2*fBufferSize)
+   Int_t       fUnzipAheadClusters; ///<! Number of clusters after the current one prefetched and unzipped ahead
+   std::vector<Long64_t> fSeekEntry; ///<! [fNseek] First entry of the prefetched baskets, to unzip them in entry order
 
    static Double_t fgRelBuffSize; ///< This is the percentage of the TTreeCacheUnzip that will be used
 
@@ -114,6 +133,7 @@ private:
 
    // Private methods
    void  Init();
+   Long64_t PrefetchBaskets(Long64_t first, Long64_t last, Bool_t lookahead, Long64_t maxbytes);
 
 public:
    TTreeCacheUnzip();
@@ -139,9 +159,11 @@ public:
 #endif
    Int_t          GetRecordHeader(char *buf, Int_t maxbytes, Int_t &nbytes, Int_t &objlen, Int_t &keylen);
    Int_t          GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_t *free) override;
+   Int_t          GetUnzipAheadClusters() const { return fUnzipAheadClusters; }
    Int_t          GetUnzipGroupSize() { return fUnzipGroupSize; }
    void           ResetCache() override;
    Int_t          SetBufferSize(Int_t buffersize) override;
+   void           SetUnzipAheadClusters(Int_t nclusters);
    void           SetUnzipBufferSize(Long64_t bufferSize);
    void           SetUnzipGroupSize(Int_t groupSize) { fUnzipGroupSize = groupSize; }
    static void    SetUnzipRelBufferSize(Float_t relbufferSize);
@@ -438,6 +438,19 @@ void inline TBasket::InitializeCompressedBuffer(Int_t len, TFile* file)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compress into a buffer owned by this basket instead of the buffer shared by all baskets
+/// of the branch (see the constructor), so that this basket can be compressed while other
+/// baskets of the same branch are compressed or written, see TBranch::WriteBasketAsync.
+
+void TBasket::UseOwnCompressedBuffer()
+{
+   if (fOwnsCompressedBuffer)
+      return;
+   fCompressedBufferRef = new TBufferFile(TBuffer::kRead, fBufferSize);
+   fOwnsCompressedBuffer = kTRUE;
+}
+
 void TBasket::ResetEntryOffset()
 {
    if (fEntryOffset != reinterpret_cast<Int_t *>(-1)) {
@@ -1170,6 +1183,30 @@ Int_t TBasket::WriteBuffer()
       return nBytes>0 ? fKeylen+nout : -1;
    }
 
+   fCycle = fBranch->GetWriteBasket();
+#ifdef R__USE_IMT
+   // Compression does not touch the file; we allow multiple TBasket compressions to occur at once for a given
+   // TFile since the compression buffer is owned by the basket.
+   sentry.unlock();
+#endif  // R__USE_IMT
+
+   Int_t nout = CompressBuffer(file);
+   if (nout < 0)
+      return -1;
+   return WriteCompressedBuffer(nout, file);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// First stage of WriteBuffer: transfer the entry offsets to the end of the basket buffer
+/// and compress the basket payload into the compressed buffer.
+///
+/// This stage does not access the file and can run concurrently with the filling of
+/// other baskets, see TBranch::WriteBasketAsync. Returns the size of the payload to write,
+/// which is the uncompressed size if compression is disabled or does not pay off,
+/// or -1 in case of error.
+
+Int_t TBasket::CompressBuffer(TFile *file)
+{
    // Transfer fEntryOffset table at the end of fBuffer.
    fLast = fBufferRef->Length();
    Int_t *entryOffset = GetEntryOffset();
@@ -1208,8 +1245,6 @@ Int_t TBasket::WriteBuffer()
 
    fObjlen = fBufferRef->Length() - fKeylen;
 
-   fHeaderOnly = kTRUE;
-   fCycle = fBranch->GetWriteBasket();
    Int_t cxlevel = fBranch->GetCompressionLevel();
    if (cxlevel == ROOT::RCompressionSetting::ELevel::kInherit)
       cxlevel = file->GetCompressionLevel();
@@ -1233,19 +1268,12 @@ Int_t TBasket::WriteBuffer()
       for (Int_t i = 0; i < nbuffers; ++i) {
          if (i == nbuffers - 1) bufmax = fObjlen - nzip;
          else bufmax = kMAXZIPBUF;
-         // Compress the buffer.  Note that we allow multiple TBasket compressions to occur at once
-         // for a given TFile: that's because the compression buffer when we use IMT is no longer
-         // shared amongst several threads.
-#ifdef R__USE_IMT
-         sentry.unlock();
-#endif  // R__USE_IMT
+         // Compress the buffer.
          // NOTE this is declared with C linkage, so it shouldn't except.  Also, when
-         // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch.
-         // (see fCompressedBufferRef in constructor).
+         // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch
+         // (see fCompressedBufferRef in constructor), or per-basket if several baskets of the branch
+         // are compressed concurrently (see UseOwnCompressedBuffer).
          R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
-#ifdef R__USE_IMT
-         sentry.lock();
-#endif  // R__USE_IMT
 
          // test if buffer has really been compressed. In case of small buffers
          // when the buffer contains random data, it may happen that the compressed
@@ -1255,15 +1283,11 @@ Int_t TBasket::WriteBuffer()
             // We used to delete fBuffer here, we no longer want to since
             // the buffer (held by fCompressedBufferRef) might be re-used later.
             fBuffer = fBufferRef->Buffer();
-            Create(fObjlen,file);
-            fBufferRef->SetBufferOffset(0);
-
-            Streamer(*fBufferRef);         //write key itself again
             if ((nout+fKeylen)>buflen) {
                Warning("WriteBuffer","Possible memory corruption due to compression algorithm, wrote %d bytes past the end of a block of %d bytes. fNbytes=%d, fObjLen=%d, fKeylen=%d",
                   (nout+fKeylen-buflen),buflen,fNbytes,fObjlen,fKeylen);
             }
-            goto WriteFile;
+            return nout;
          }
          bufcur += nout;
          noutot += nout;
@@ -1271,21 +1295,33 @@ Int_t TBasket::WriteBuffer()
          nzip   += kMAXZIPBUF;
       }
       nout = noutot;
-      Create(noutot,file);
-      fBufferRef->SetBufferOffset(0);
-
-      Streamer(*fBufferRef);         //write key itself again
-      memcpy(fBuffer,fBufferRef->Buffer(),fKeylen);
    } else {
       fBuffer = fBufferRef->Buffer();
-      Create(fObjlen,file);
-      fBufferRef->SetBufferOffset(0);
-
-      Streamer(*fBufferRef);         //write key itself again
       nout = fObjlen;
    }
+   return nout;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Second stage of WriteBuffer: reserve the space for the basket key of a payload of
+/// nout bytes, which was prepared by CompressBuffer, and write key and payload to the file.
+///
+/// Returns the number of bytes written or -1 in case of error.
+
+Int_t TBasket::WriteCompressedBuffer(Int_t nout, TFile *file)
+{
+#ifdef R__USE_IMT
+   std::lock_guard<std::mutex> sentry(file->fWriteMutex);
+#endif  // R__USE_IMT
+
+   fHeaderOnly = kTRUE;
+   Create(nout,file);
+   fBufferRef->SetBufferOffset(0);
+
+   Streamer(*fBufferRef);         //write key itself again
+   if (fBuffer != fBufferRef->Buffer())
+      memcpy(fBuffer,fBufferRef->Buffer(),fKeylen);
 
-WriteFile:
    Int_t nBytes = WriteFileKeepBuffer();
    fHeaderOnly = kFALSE;
    return nBytes>0 ? fKeylen+nout : -1;
@@ -17,6 +17,7 @@
 #include "Compression.h"
 #include "TBasket.h"
 #include "TBranchBrowsable.h"
+#include "TBranchElement.h"
 #include "TBrowser.h"
 #include "TBuffer.h"
 #include "TClass.h"
@@ -43,6 +44,7 @@
 #include "TTree.h"
 #include "TTreeCache.h"
 #include "TTreeCacheUnzip.h"
+#include "TVirtualCollectionProxy.h"
 #include "TVirtualMutex.h"
 #include "TVirtualPad.h"
 #include "TVirtualPerfStats.h"
@@ -53,6 +55,7 @@
 
 #include "ROOT/TIOFeatures.hxx"
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstring>
@@ -464,6 +467,12 @@ TBranch::~TBranch()
    delete [] fBasketBytes;
    fBasketBytes = 0;
 
+   // The baskets still being compressed are owned by fBaskets.
+   if (fCompressionQueue)
+      fCompressionQueue->Clear();
+   delete fCompressionQueue;
+   fCompressionQueue = nullptr;
+
    if (fExtraBasket && !fBaskets.Remove(fExtraBasket))
       delete fExtraBasket;
    fBaskets.Delete();
@@ -848,6 +857,9 @@ void TBranch::ExpandBasketArrays()
 /// If TBranchIMTHelper is non-null and it is time to WriteBasket, then we will
 /// use TBB to compress in parallel.
 ///
+/// If the tree has asynchronous basket compression enabled (see TTree::SetAsyncBasketCompression),
+/// full baskets are instead handed to the implicit-MT pool and written later, see WriteBasketAsync.
+///
 /// The function returns the number of bytes committed to the memory basket.
 /// If a write error occurs, the number of bytes returned is -1.
 /// If no data are written, because e.g. the branch is disabled,
@@ -859,6 +871,10 @@ Int_t TBranch::FillImpl(ROOT::Internal::TBranchIMTHelper *imtHelper)
       return 0;
    }
 
+   // Write out the baskets whose asynchronous compression is done; this may also return
+   // a basket for reuse as the write basket.
+   Bool_t pendingError = fCompressionQueue && WritePendingBaskets(kFALSE) < 0;
+
    TBasket* basket = (TBasket*)fBaskets.UncheckedAt(fWriteBasket);
    if (!basket) {
       basket = fTree->CreateBasket(this); //  create a new basket
@@ -922,11 +938,16 @@ Int_t TBranch::FillImpl(ROOT::Internal::TBranchIMTHelper *imtHelper)
    if (noFlushAtCluster && !fTree->TestBit(TTree::kCircular) &&
        ((fSkipZip && (lnew >= TBuffer::kMinimalSize)) || (buf->TestBit(TBufferFile::kNotDecompressed)) ||
         ((lnew + (2 * nsize) + nbytes) >= fBasketSize))) {
-      Int_t nout = WriteBasketImpl(basket, fWriteBasket, imtHelper);
+      Int_t nout;
+      if (fTree->GetAsyncBasketCompression() && !fSkipZip) {
+         nout = WriteBasketAsync(basket);
+      } else {
+         nout = WriteBasketImpl(basket, fWriteBasket, imtHelper);
+      }
       if (nout < 0) Error("TBranch::Fill", "Failed to write out basket.\n");
-      return (nout >= 0) ? nbytes : -1;
+      return (nout >= 0 && !pendingError) ? nbytes : -1;
    }
-   return nbytes;
+   return pendingError ? -1 : nbytes;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1138,6 +1159,16 @@ Int_t TBranch::FlushBaskets()
    UInt_t nerror = 0;
    Int_t nbytes = 0;
 
+   // Baskets handed over for asynchronous compression come first, in fill order.
+   if (fCompressionQueue) {
+      Int_t nwrite = WritePendingBaskets(kTRUE);
+      if (nwrite < 0) {
+         ++nerror;
+      } else {
+         nbytes += nwrite;
+      }
+   }
+
    Int_t maxbasket = fWriteBasket + 1;
    // The following protection is not necessary since we should always
    // have fWriteBasket < fBasket.GetSize()
@@ -1233,6 +1264,8 @@ TBasket* TBranch::GetBasketImpl(Int_t basketnumber, TBuffer *user_buffer)
 
       // reference to an existing basket in memory ?
    if (basketnumber <0 || basketnumber > fWriteBasket) return 0;
+   // A basket still being compressed cannot be read; write it out first.
+   if (R__unlikely(fCompressionQueue && !fCompressionQueue->Empty())) WritePendingBaskets(kTRUE);
    TBasket *basket = (TBasket*)fBaskets.UncheckedAt(basketnumber);
    if (basket) return basket;
    if (basketnumber == fWriteBasket) return 0;
@@ -1433,6 +1466,24 @@ Bool_t TBranch::SupportsBulkRead() const {
           (static_cast<TLeaf*>(fLeaves.UncheckedAt(0))->GetDeserializeType() != TLeaf::DeserializeType::kExternal);
 }
 
+namespace {
+
+/// Restores the read entry of a branch on destruction.  The bulk reads only use the read entry to locate the
+/// basket; entry-wise readers of the same branch (TTreeFormula, TBranchProxy, ...) compare it to the entry they
+/// need in order to decide whether the branch buffers have to be reloaded.
+class TReadEntryRestorer {
+   Long64_t &fReadEntry;
+   const Long64_t fOldReadEntry;
+
+public:
+   explicit TReadEntryRestorer(Long64_t &readEntry) : fReadEntry(readEntry), fOldReadEntry(readEntry) {}
+   TReadEntryRestorer(const TReadEntryRestorer &) = delete;
+   TReadEntryRestorer &operator=(const TReadEntryRestorer &) = delete;
+   ~TReadEntryRestorer() { fReadEntry = fOldReadEntry; }
+};
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read as many events as possible into the given buffer, using zero-copy
 /// mechanisms.
@@ -1451,6 +1502,10 @@ Bool_t TBranch::SupportsBulkRead() const {
 /// - This interface is meant to be used by higher-level, type-safe wrappers, not
 ///   by end-users.
 /// - This only returns events
+/// - The read entry of the branch is left unchanged and the leaves are not filled, such
+///   that entry-wise readers of the branch can be interleaved with bulk reads.  The basket
+///   may be handed over to user_buf, though: if it is the current basket, the next
+///   GetEntry() reads it again from storage.
 ///
 
 Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf)
@@ -1462,7 +1517,8 @@ Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf)
       return -1;
    }
 
-   // Remember which entry we are reading.
+   // GetBasketAndFirst() locates the basket of the read entry
+   TReadEntryRestorer readEntryRestorer(fReadEntry);
    fReadEntry = entry;
 
    Bool_t enabled = !TestBit(kDoNotProcess);
@@ -1630,6 +1686,215 @@ Int_t TBranch::GetEntriesSerialized(Long64_t entry, TBuffer &user_buf, TBuffer *
    return N;
 }
 
+namespace {
+
+/// Returns the size of the fundamental type if the type can be read in bulk from variable-size branches, or 0.
+/// Types with a different in-memory and on-disk representation (e.g. Double32_t, Long_t) are excluded.
+Int_t GetJaggedTypeSize(Int_t type)
+{
+   switch (type) {
+   case kChar_t:
+   case kUChar_t:
+   case kBool_t: return 1;
+   case kShort_t:
+   case kUShort_t: return 2;
+   case kInt_t:
+   case kUInt_t:
+   case kFloat_t: return 4;
+   case kDouble_t:
+   case kLong64_t:
+   case kULong64_t: return 8;
+   default: return 0;
+   }
+}
+
+/// Moves `n` big-endian values of type T from `src` to `dst`, converting them to the host byte order.
+/// The destination may overlap the source as long as it does not come after it.
+template <typename T>
+void CompactFromBuf(char *&dst, char *src, Int_t n)
+{
+   for (Int_t i = 0; i < n; ++i) {
+      T value;
+      frombuf(src, &value);
+      memcpy(dst, &value, sizeof(T));
+      dst += sizeof(T);
+   }
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the size of the elements of a variable-size branch that can be read with GetEntriesJagged(), or 0 if
+/// the branch does not support jagged bulk reads.
+///
+/// Supported are counted arrays of fundamental types (e.g. `x[n]/F`), split members of fundamental type
+/// of STL collections of objects, and top-level, non-split `std::vector`s of fundamental types.  For the latter,
+/// every entry starts with a collection header (byte count, version and size) that hasCollectionHeader
+/// is set for.
+
+Int_t TBranch::GetJaggedElementSize(Bool_t *hasCollectionHeader) const
+{
+   if (hasCollectionHeader)
+      *hasCollectionHeader = kFALSE;
+   if (fNleaves != 1)
+      return 0;
+
+   if (IsA() == TBranch::Class()) {
+      auto leaf = static_cast<TLeaf *>(fLeaves.UncheckedAt(0));
+      if (!leaf->GetLeafCount())
+         return 0;
+      const auto leafClass = leaf->IsA();
+      if (leafClass == TLeafB::Class() || leafClass == TLeafO::Class() || leafClass == TLeafS::Class() ||
+          leafClass == TLeafI::Class() || leafClass == TLeafF::Class() || leafClass == TLeafD::Class() ||
+          leafClass == TLeafL::Class()) {
+         return leaf->GetLenType();
+      }
+      return 0;
+   }
+
+   if (IsA() == TBranchElement::Class()) {
+      auto branchElement = static_cast<const TBranchElement *>(this);
+      if (branchElement->GetType() == TBranchElement::kSTLMemberNode)
+         return GetJaggedTypeSize(branchElement->GetStreamerType());
+
+      if (branchElement->GetID() >= 0 || fBranches.GetEntriesFast() > 0)
+         return 0;
+      auto cl = branchElement->GetClass();
+      auto proxy = cl ? cl->GetCollectionProxy() : nullptr;
+      if (!proxy || proxy->GetCollectionType() != ROOT::kSTLvector || proxy->GetValueClass() ||
+          proxy->GetType() == kBool_t) {
+         return 0;
+      }
+      if (hasCollectionHeader)
+         *hasCollectionHeader = kTRUE;
+      return GetJaggedTypeSize(proxy->GetType());
+   }
+
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read all the entries of the basket that starts at the given entry of a variable-size branch (see
+/// GetJaggedElementSize() for the supported branches) into user_buf.
+///
+/// Returns -1 in case of a failure; callers are expected to fall back to reading entry by entry.  On success,
+/// returns the number of entries N.  The values of all the entries are then stored contiguously and in host
+/// byte order in user_buf, starting at user_buf.GetCurrent(); offsets contains N+1 elements such that the
+/// elements of entry i are at the element indexes [offsets[i], offsets[i + 1]).
+///
+/// The collection headers of `std::vector` branches and the big-endian encoding are removed in place, such that
+/// no copy of the basket is necessary.
+///
+/// The read entry of the branch is left unchanged and the leaves are not filled, such that entry-wise readers of
+/// the branch can be interleaved with jagged bulk reads.  A basket that is read in bulk is handed over to user_buf,
+/// though: if it is the current basket, the next GetEntry() reads it again from storage.
+
+Int_t TBranch::GetEntriesJagged(Long64_t entry, TBuffer &user_buf, std::vector<Int_t> &offsets)
+{
+   Bool_t hasCollectionHeader;
+   const Int_t elementSize = GetJaggedElementSize(&hasCollectionHeader);
+   if (R__unlikely(elementSize == 0)) { return -1; }
+   if (R__unlikely(TestBit(kDoNotProcess))) { return -1; }
+   if (R__unlikely(entry < fFirstEntry || entry >= fEntryNumber)) { return -1; }
+
+   // Baskets that are only in memory are still being written; only read baskets from storage
+   Int_t basketIdx = TMath::BinarySearch(fWriteBasket + 1, fBasketEntry, entry);
+   if (R__unlikely(basketIdx < 0 || fBasketEntry[basketIdx] != entry || !fBasketSeek[basketIdx])) { return -1; }
+
+   // GetBasketAndFirst() locates the basket of the read entry
+   TReadEntryRestorer readEntryRestorer(fReadEntry);
+   fReadEntry = entry;
+
+   TBasket *basket = nullptr;
+   Long64_t first;
+   Int_t result = GetBasketAndFirst(basket, first, &user_buf);
+   if (R__unlikely(result < 0)) { return -1; }
+   R__ASSERT(first == entry);
+
+   basket->PrepareBasket(entry);
+   TBuffer* buf = basket->GetBufferRef();
+
+   // Test for very old ROOT files.
+   if (R__unlikely(!buf)) {
+      Error("GetEntriesJagged", "Failed to get a new buffer.\n");
+      return -1;
+   }
+   // Test for displacements, which aren't supported in fast mode.
+   if (R__unlikely(basket->GetDisplacement())) {
+      Error("GetEntriesJagged", "Basket has displacement.\n");
+      return -1;
+   }
+
+   if (&user_buf != buf) {
+      // The basket was already in memory and it is backed by persistent storage, so we can be destructive
+      R__ASSERT(result == fReadBasket);
+      user_buf.SetBuffer(buf->Buffer(), buf->BufferSize());
+      buf->ResetBit(TBufferIO::kIsOwner);
+      fCurrentBasket = nullptr;
+      fBaskets[fReadBasket] = nullptr;
+   }
+
+   Int_t N = ((fNextBasketEntry < 0) ? fEntryNumber : fNextBasketEntry) - first;
+   Int_t *entryOffset = basket->GetEntryOffset();
+   Int_t bufbegin = basket->GetKeylen();
+   Bool_t success = entryOffset && (basket->GetNevBuf() == N);
+
+   char *base = user_buf.Buffer();
+   char *dst = base + bufbegin;
+   offsets.resize(N + 1);
+   offsets[0] = 0;
+   for (Int_t i = 0; success && (i < N); ++i) {
+      const Int_t entryBegin = entryOffset[i];
+      const Int_t entryEnd = (i + 1 < N) ? entryOffset[i + 1] : basket->GetLast();
+      Int_t headerSize = 0;
+      Int_t nElements = 0;
+      if (hasCollectionHeader) {
+         // byte count (with the kByteCountMask bit set), version, and number of elements
+         const UInt_t kByteCountMask = 0x40000000;
+         headerSize = sizeof(UInt_t) + sizeof(Version_t) + sizeof(Int_t);
+         if (entryEnd - entryBegin < headerSize) {
+            success = kFALSE;
+            break;
+         }
+         char *header = base + entryBegin;
+         UInt_t byteCount;
+         frombuf(header, &byteCount);
+         header += sizeof(Version_t);
+         frombuf(header, &nElements);
+         success = (byteCount & kByteCountMask) && (nElements >= 0) &&
+                   (headerSize + Long64_t(nElements) * elementSize == entryEnd - entryBegin);
+      } else {
+         nElements = (entryEnd - entryBegin) / elementSize;
+         success = (entryEnd >= entryBegin) && (nElements * elementSize == entryEnd - entryBegin);
+      }
+      if (!success)
+         break;
+
+      char *src = base + entryBegin + headerSize;
+      switch (elementSize) {
+      case 1: memmove(dst, src, nElements); dst += nElements; break;
+      case 2: CompactFromBuf<UShort_t>(dst, src, nElements); break;
+      case 4: CompactFromBuf<UInt_t>(dst, src, nElements); break;
+      case 8: CompactFromBuf<ULong64_t>(dst, src, nElements); break;
+      default: success = kFALSE;
+      }
+      offsets[i + 1] = offsets[i] + nElements;
+   }
+   if (R__unlikely(!success)) {
+      Error("GetEntriesJagged", "Unexpected entry layout in basket %d of branch %s.\n", fReadBasket, GetName());
+      N = -1;
+   }
+   user_buf.SetBufferOffset(bufbegin);
+
+   if (fCurrentBasket == nullptr) {
+      R__ASSERT(fExtraBasket == nullptr && "fExtraBasket should have been set to nullptr by GetFreshBasket");
+      fExtraBasket = basket;
+      basket->DisownBuffer();
+   }
+
+   return N;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read all leaves of entry and return total number of bytes read.
 ///
@@ -2479,6 +2744,7 @@ void TBranch::Refresh(TBranch* b)
       fBasketEntry[i] = b->fBasketEntry[i];
       fBasketSeek[i]  = b->fBasketSeek[i];
    }
+   if (fCompressionQueue) fCompressionQueue->Clear();
    fBaskets.Delete();
    Int_t nbaskets = b->fBaskets.GetSize();
    fBaskets.Expand(nbaskets);
@@ -2502,6 +2768,7 @@ void TBranch::Refresh(TBranch* b)
 
 void TBranch::Reset(Option_t*)
 {
+   if (fCompressionQueue) fCompressionQueue->Clear();
    fReadBasket = 0;
    fReadEntry = -1;
    fFirstBasketEntry = -1;
@@ -2543,6 +2810,7 @@ void TBranch::Reset(Option_t*)
 
 void TBranch::ResetAfterMerge(TFileMergeInfo *)
 {
+   if (fCompressionQueue) fCompressionQueue->Clear();
    fReadBasket       = 0;
    fReadEntry        = -1;
    fFirstBasketEntry = -1;
@@ -3219,6 +3487,128 @@ Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBr
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Hand the full write basket over to a task of the implicit-MT pool for compression
+/// and continue filling into a fresh basket.
+///
+/// The compressed baskets are written to the file, in the order in which they were
+/// filled, by WritePendingBaskets: without waiting on every Fill, and waiting for all of
+/// them when the baskets are flushed. At most as many baskets as there are threads in the
+/// pool are in flight per branch; beyond that, the filling thread waits for them.
+/// Returns 0 or -1 if the writing of earlier baskets failed.
+
+Int_t TBranch::WriteBasketAsync(TBasket* basket)
+{
+   constexpr Int_t kWrite = 1;
+
+   TFile *file = GetFile(kWrite);
+   if (!ROOT::IsImplicitMTEnabled() || !file || !file->IsWritable() ||
+       basket->GetBufferRef()->TestBit(TBufferFile::kNotDecompressed)) {
+      return WriteBasketImpl(basket, fWriteBasket, nullptr);
+   }
+
+   Int_t nerror = 0;
+   if (!fCompressionQueue) {
+      fCompressionQueue = new CompressionQueue_t();
+   } else if (fCompressionQueue->Size() >= std::max(1u, ROOT::GetThreadPoolSize())) {
+      if (WritePendingBaskets(kTRUE) < 0) ++nerror;
+   }
+
+   Int_t nevbuf = basket->GetNevBuf();
+   if (fEntryOffsetLen > 10 &&  (4*nevbuf) < fEntryOffsetLen ) {
+      // Make sure that the fEntryOffset array does not stay large unnecessarily.
+      fEntryOffsetLen = nevbuf < 3 ? 10 : 4*nevbuf; // assume some fluctuations.
+   } else if (fEntryOffsetLen && nevbuf > fEntryOffsetLen) {
+      // Increase the array ...
+      fEntryOffsetLen = 2*nevbuf; // assume some fluctuations.
+   }
+
+   // Several baskets of this branch can be in flight at once: they must not share the
+   // branch's compression buffer, which CompressBuffer might reallocate.
+   basket->UseOwnCompressedBuffer();
+   // The key identity is fixed now, the key itself is created when the basket is written.
+   basket->fMotherDir = file;
+   basket->fCycle = fWriteBasket;
+   fCompressionQueue->Push(basket, fWriteBasket, [basket, file]() { return basket->CompressBuffer(file); });
+
+   // The pending basket stays in fBaskets[where] until it is written; the next one is either
+   // created by FillImpl or recycled by WritePendingBaskets.
+   ++fWriteBasket;
+   if (fWriteBasket >= fMaxBaskets) {
+      ExpandBasketArrays();
+   }
+   fBaskets.AddAtAndExpand(nullptr, fWriteBasket);
+   fBasketEntry[fWriteBasket] = fEntryNumber;
+
+   return nerror ? -1 : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the baskets whose asynchronous compression is done to the file, in the order in
+/// which they were handed over by WriteBasketAsync, and update the basket bookkeeping as
+/// WriteBasketImpl does. If wait is true, all pending baskets are waited for and written.
+/// Return the number of bytes written or -1 in case of write error.
+
+Int_t TBranch::WritePendingBaskets(Bool_t wait)
+{
+   constexpr Int_t kWrite = 1;
+
+   if (!fCompressionQueue || fCompressionQueue->Empty())
+      return 0;
+   if (wait)
+      fCompressionQueue->Wait();
+
+   TFile *file = GetFile(kWrite);
+   Int_t nbytes = 0;
+   Int_t nerror = 0;
+   while (auto pending = fCompressionQueue->Front()) {
+      TBasket *basket = pending->fBasket;
+      const Int_t where = pending->fWhere;
+      Int_t nout = pending->fNout;
+      fCompressionQueue->Pop();
+
+      if (nout >= 0)
+         nout = file ? basket->WriteCompressedBuffer(nout, file) : -1;
+      if (nout < 0) {
+         Error("WritePendingBaskets", "basket's WriteBuffer failed.");
+         ++nerror;
+      }
+      fBasketBytes[where] = basket->GetNbytes();
+      fBasketSeek[where]  = basket->GetSeekKey();
+      if (nout <= 0)
+         continue;
+
+      Int_t addbytes = basket->GetObjlen() + basket->GetKeylen();
+      // The Basket was written so we can now safely reuse it.
+      fBaskets[where] = 0;
+      basket->WriteReset();
+
+      fZipBytes += nout;
+      fTotBytes += addbytes;
+      fTree->AddTotBytes(addbytes);
+      fTree->AddZipBytes(nout);
+#ifdef R__TRACK_BASKET_ALLOC_TIME
+      fTree->AddAllocationTime(basket->GetResetAllocationTime());
+#endif
+      fTree->AddAllocationCount(basket->GetResetAllocationCount());
+      nbytes += nout;
+
+      if (basket == fCurrentBasket) {
+         fCurrentBasket    = 0;
+         fFirstBasketEntry = -1;
+         fNextBasketEntry  = -1;
+      }
+      if (!fBaskets.UncheckedAt(fWriteBasket)) {
+         fBaskets.AddAt(basket, fWriteBasket);
+      } else {
+         --fNBaskets;
+         basket->DropBuffers();
+         delete basket;
+      }
+   }
+   return nerror ? -1 : nbytes;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///set the first entry number (case of TBranchSTL)
 
@@ -18,6 +18,12 @@
 #include "ROOT/TTaskGroup.hxx"
 #endif
 
+#include <atomic>
+#include <deque>
+#include <memory>
+
+class TBasket;
+
 /** \class ROOT::Internal::TBranchIMTHelper
  A helper class for managing IMT work during TTree:Fill operations.
 */
@@ -65,6 +71,71 @@ private:
 #endif
 };
 
+/** \class ROOT::Internal::TBranchCompressionQueue
+ The baskets of a branch that were handed over for asynchronous compression during TTree::Fill,
+ in the order in which they were filled. The compression runs in tasks of the implicit-MT pool; the
+ owner of the queue writes the baskets in order once their compression is done (see TBranch::WriteBasketAsync).
+*/
+
+class TBranchCompressionQueue {
+
+#ifdef R__USE_IMT
+using TaskGroup_t = ROOT::Experimental::TTaskGroup;
+#endif
+
+public:
+   struct TPending {
+      TBasket *fBasket = nullptr;     ///< The basket being compressed, still owned by the branch
+      Int_t fWhere = 0;               ///< Index of the basket in the branch's basket arrays
+      Int_t fNout = 0;                ///< Size of the payload to write, or -1 if the compression failed
+      std::atomic<bool> fDone{false}; ///< Set by the compression task once fNout is valid
+   };
+
+   /// Hand over a basket; `compress` is run in a task and returns the size of the payload to write.
+   template<typename FN> void Push(TBasket *basket, Int_t where, const FN &compress) {
+      fPending.emplace_back(new TPending());
+      TPending *pending = fPending.back().get();
+      pending->fBasket = basket;
+      pending->fWhere = where;
+#ifdef R__USE_IMT
+      if (!fGroup) { fGroup.reset(new TaskGroup_t()); }
+      fGroup->Run( [=]() {
+         pending->fNout = compress();
+         pending->fDone = true;
+      });
+#else
+      pending->fNout = compress();
+      pending->fDone = true;
+#endif
+   }
+
+   /// The oldest pending basket if its compression is done, nullptr otherwise.
+   TPending *Front() { return (!fPending.empty() && fPending.front()->fDone) ? fPending.front().get() : nullptr; }
+   void Pop() { fPending.pop_front(); }
+
+   /// Wait for all compression tasks; the baskets remain queued.
+   void Wait() {
+#ifdef R__USE_IMT
+      if (fGroup) fGroup->Wait();
+#endif
+   }
+
+   /// Wait for all compression tasks and forget about their baskets.
+   void Clear() {
+      Wait();
+      fPending.clear();
+   }
+
+   bool Empty() const { return fPending.empty(); }
+   std::size_t Size() const { return fPending.size(); }
+
+private:
+   std::deque<std::unique_ptr<TPending>> fPending;
+#ifdef R__USE_IMT
+   std::unique_ptr<TaskGroup_t> fGroup;
+#endif
+};
+
 } // Internal
 } // ROOT
 
@@ -609,6 +609,37 @@ Int_t TEntryList::Contains(Long64_t entry, TTree *tree)
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if at least one of the entries in [entrymin, entrymax] is in the list.
+/// As for Contains() without a tree, the entries are looked up in the current
+/// sub-list if this list has sub-lists. Only the blocks overlapping the range are
+/// inspected; this is used by TTreeCache to skip the baskets without selected entries.
+
+Bool_t TEntryList::ContainsRange(Long64_t entrymin, Long64_t entrymax)
+{
+   if (entrymin < 0) entrymin = 0;
+   if (entrymin > entrymax) return kFALSE;
+   if (fBlocks) {
+      Int_t first = entrymin/kBlockSize;
+      if (first >= fNBlocks) return kFALSE;
+      Int_t last = (entrymax/kBlockSize < fNBlocks) ? Int_t(entrymax/kBlockSize) : fNBlocks-1;
+      for (Int_t i = first; i <= last; i++) {
+         TEntryListBlock *block = (TEntryListBlock*)fBlocks->UncheckedAt(i);
+         Long64_t offset = Long64_t(i)*kBlockSize;
+         Int_t bmin = (i == first) ? Int_t(entrymin - offset) : 0;
+         Int_t bmax = (i == last && entrymax - offset < kBlockSize) ? Int_t(entrymax - offset) : kBlockSize - 1;
+         if (block && block->ContainsRange(bmin, bmax))
+            return kTRUE;
+      }
+      return kFALSE;
+   }
+   if (fLists) {
+      if (!fCurrent) fCurrent = (TEntryList*)fLists->First();
+      return fCurrent->ContainsRange(entrymin, entrymax);
+   }
+   return kFALSE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Called by TKey and others to automatically add us to a directory when we are read from a file.
 
@@ -46,6 +46,8 @@ End_Macro
 #include "TEntryListBlock.h"
 #include "TString.h"
 
+#include <algorithm>
+
 ClassImp(TEntryListBlock);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -236,6 +238,54 @@ Int_t TEntryListBlock::Contains(Int_t entry)
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// True if at least one entry in [entrymin, entrymax] belongs to the block.
+/// In bits mode whole 16 bit words are tested at once, in list mode the sorted
+/// indices are searched with a binary search.
+
+Bool_t TEntryListBlock::ContainsRange(Int_t entrymin, Int_t entrymax)
+{
+   if (entrymin < 0)
+      entrymin = 0;
+   if (entrymax >= kBlockSize*16)
+      entrymax = kBlockSize*16 - 1;
+   if (entrymin > entrymax)
+      return kFALSE;
+   if (!fIndices && fPassing)
+      return kFALSE;
+   if (fType==0 && fIndices){
+      //bits
+      Int_t imin = entrymin>>4;
+      Int_t imax = entrymax>>4;
+      for (Int_t i = imin; i<=imax; i++){
+         UInt_t mask = 0xffff;
+         if (i == imin)
+            mask &= 0xffff << (entrymin & 15);
+         if (i == imax)
+            mask &= 0xffff >> (15 - (entrymax & 15));
+         if (fIndices[i] & mask)
+            return kTRUE;
+      }
+      return kFALSE;
+   }
+   //list
+   const UShort_t *begin = fIndices;
+   const UShort_t *end = fIndices+fNPassed;
+   if (fPassing){
+      const UShort_t *first = std::lower_bound(begin, end, entrymin);
+      return first != end && *first <= entrymax;
+   }
+   if (!fIndices || fNPassed==0){
+      //all entries pass
+      return kTRUE;
+   }
+   //the list holds the entries that don't pass: the range is covered only if
+   //all of its entries are listed
+   const UShort_t *first = std::lower_bound(begin, end, entrymin);
+   const UShort_t *last = std::upper_bound(first, end, entrymax);
+   return (last - first) < (entrymax - entrymin + 1);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Merge with the other block
 /// Returns the resulting number of entries in the block
@@ -8294,6 +8294,23 @@ Long64_t TTree::GetMedianClusterSize()
    return medianClusterSize;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable or disable the asynchronous compression of baskets during TTree::Fill.
+///
+/// When enabled and implicit multi-threading is on (see ROOT::EnableImplicitMT() and
+/// TTree::SetImplicitMT()), a basket that fills up is handed to the thread pool for
+/// compression and filling continues into a fresh basket; the filling thread writes the
+/// compressed baskets to the file in order. This lets trees with a few large branches use
+/// several cores for compression between flushes, at the cost of keeping in memory up to
+/// one basket per pool thread and branch. Since the compressed size of a basket is only
+/// known once it is written, a negative fAutoFlush (in bytes) triggers slightly later.
+/// Pending baskets are always written by the next FlushBaskets(), AutoSave() or Write().
+
+void TTree::SetAsyncBasketCompression(Bool_t enabled)
+{
+   fAsyncBasketCompression = enabled;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// In case of a program crash, it will be possible to recover the data in the
 /// tree up to the last AutoSave point.
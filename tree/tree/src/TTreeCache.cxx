@@ -85,9 +85,11 @@ The usage of TChain or TEventList have influence on the behaviour of the cache:
   Once the training is done on the first Tree, the list of branches
   in the cache is kept for the following files.
 
-- Special case of a TEventlist
-  if the Tree or TChain has a TEventlist, only the buffers
-  referenced by the list are put in the cache.
+- Special case of a TEventlist or TEntryList
+  if the Tree or TChain has a TEventlist or a TEntryList, only the buffers
+  containing at least one entry of the list are put in the cache. The
+  basket entry tables of the branches are used to skip the others, so
+  reading a sparse selection costs a fraction of the full cluster.
 
 The learning phase is started or restarted when:
    - TTree automatically creates a cache.
@@ -289,6 +291,7 @@ myTreeOrChain.GetTree()->PrintCacheStats();
 #include "TList.h"
 #include "TBranch.h"
 #include "TBranchElement.h"
+#include "TEntryList.h"
 #include "TEventList.h"
 #include "TObjArray.h"
 #include "TObjString.h"
@@ -1106,6 +1109,38 @@ struct BasketRanges {
 };
 } // Anonymous namespace.
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the TEntryList attached to the owner Tree or TChain that applies to
+/// the Tree currently read, with entries numbered locally to that Tree, or nullptr.
+///
+/// For a TChain this is the sub-list whose tree number matches the current
+/// tree; for a TTree it is the list itself or its current sub-list. If the
+/// sub-list cannot be identified unambiguously, no list is returned and all
+/// the baskets of the cluster are fetched.
+
+TEntryList *TTreeCache::GetLocalEntryList() const
+{
+   TEntryList *enlist = fTree->GetEntryList();
+   if (!enlist || enlist->GetN() == 0)
+      return nullptr;
+   TList *sublists = enlist->GetLists();
+   if (fTree->IsA() == TChain::Class()) {
+      if (!sublists)
+         return nullptr;
+      Int_t t = ((TChain*)fTree)->GetTreeNumber();
+      for (auto sublist : TRangeDynCast<TEntryList>(sublists)) {
+         if (sublist && sublist->GetTreeNumber() == t)
+            return sublist;
+      }
+      return nullptr;
+   }
+   if (!sublists)
+      return enlist;
+   if (sublists->GetSize() == 1)
+      return (TEntryList*)sublists->First();
+   return nullptr;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Fill the cache buffer with the branches in the cache.
 
@@ -1304,6 +1339,9 @@ Bool_t TTreeCache::FillBuffer()
          chainOffset = chain->GetTreeOffset()[t];
       }
    }
+   // Same for a TEntryList (which also exists when a TEventList was set, in
+   // which case the TEventList is used). Its entries are local to the tree.
+   TEntryList *enlist = elist ? nullptr : GetLocalEntryList();
 
    //clear cache buffer
    Int_t ntotCurrentBuf = 0;
@@ -1359,7 +1397,7 @@ Bool_t TTreeCache::FillBuffer()
          kRewind = 3
       };
 
-      auto CollectBaskets = [this, elist, chainOffset, entry, clusterIterations, resetBranchInfo, perfStats,
+      auto CollectBaskets = [this, elist, enlist, chainOffset, entry, clusterIterations, resetBranchInfo, perfStats,
        &cursor, &lowestMaxEntry, &maxReadEntry, &minEntry,
        &reachedEnd, &skippedFirst, &oncePerBranch, &nDistinctLoad, &progress,
        &ranges, &memRanges, &reqRanges,
@@ -1487,6 +1525,13 @@ Bool_t TTreeCache::FillBuffer()
                   if (!elist->ContainsRange(entries[j]+chainOffset,emax+chainOffset))
                      continue;
                }
+               if (enlist) {
+                  Long64_t emax = fEntryMax;
+                  if (j<nb-1)
+                     emax = entries[j + 1] - 1;
+                  if (!enlist->ContainsRange(entries[j], emax))
+                     continue;
+               }
 
                if (b->fCacheInfo.HasBeenUsed(j) || b->fCacheInfo.IsInCache(j) || b->fCacheInfo.IsVetoed(j)) {
                   // We already cached and used this basket during this cluster range,
@@ -22,6 +22,7 @@ A TTreeCache which exploits parallelized decompression of its own content.
 #include "TBranch.h"
 #include "TChain.h"
 #include "TEnv.h"
+#include "TEntryList.h"
 #include "TEventList.h"
 #include "TFile.h"
 #include "TMath.h"
@@ -33,7 +34,10 @@ A TTreeCache which exploits parallelized decompression of its own content.
 #include "ROOT/TTaskGroup.hxx"
 #endif
 
+#include <algorithm>
+#include <limits>
 #include <memory>
+#include <numeric>
 
 extern "C" void R__unzip(Int_t *nin, UChar_t *bufin, Int_t *lout, char *bufout, Int_t *nout);
 extern "C" int R__unzip_header(Int_t *nin, UChar_t *bufin, Int_t *lout);
@@ -154,6 +158,66 @@ Bool_t TTreeCacheUnzip::UnzipState::TryUnzipping(Int_t index) {
    return fUnzipStatus[index].compare_exchange_weak(oldValue, newValue, std::memory_order_release, std::memory_order_relaxed);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return a buffer of at least len bytes. An idle buffer whose capacity is
+/// not larger than maxlen is reused if available, the smallest one is preferred.
+/// Otherwise a new buffer of len bytes is allocated. The capacity of the
+/// returned buffer is stored in capacity.
+
+char *TTreeCacheUnzip::UnzipBufferPool::Acquire(Int_t len, Int_t maxlen, Int_t &capacity)
+{
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      auto best = fFree.end();
+      for (auto it = fFree.begin(); it != fFree.end(); ++it) {
+         if (it->first >= len && it->first <= maxlen && (best == fFree.end() || it->first < best->first))
+            best = it;
+      }
+      if (best != fFree.end()) {
+         capacity = best->first;
+         char *buf = best->second.release();
+         fFreeBytes -= capacity;
+         *best = std::move(fFree.back());
+         fFree.pop_back();
+         fNReused++;
+         return buf;
+      }
+      fNAllocated++;
+   }
+   capacity = len;
+   return new char[len];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Delete all the idle buffers.
+
+void TTreeCacheUnzip::UnzipBufferPool::Clear()
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   fFree.clear();
+   fFreeBytes = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Give back a buffer obtained from Acquire(), or an unzipped chunk that was
+/// never handed out. The buffer is kept for reuse unless the idle buffers
+/// would exceed fMaxBytes, in which case it is deleted.
+
+void TTreeCacheUnzip::UnzipBufferPool::Release(char *buf, Int_t capacity)
+{
+   if (!buf)
+      return;
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      if (fFreeBytes + capacity <= fMaxBytes) {
+         fFree.emplace_back(capacity, std::unique_ptr<char[]>(buf));
+         fFreeBytes += capacity;
+         return;
+      }
+   }
+   delete[] buf;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 TTreeCacheUnzip::TTreeCacheUnzip() : TTreeCache(),
@@ -163,6 +227,7 @@ TTreeCacheUnzip::TTreeCacheUnzip() : TTreeCache(),
    fNseekMax(0),
    fUnzipGroupSize(0),
    fUnzipBufferSize(0),
+   fUnzipAheadClusters(0),
    fNFound(0),
    fNMissed(0),
    fNStalls(0),
@@ -182,6 +247,7 @@ TTreeCacheUnzip::TTreeCacheUnzip(TTree *tree, Int_t buffersize) : TTreeCache(tre
    fNseekMax(0),
    fUnzipGroupSize(0),
    fUnzipBufferSize(0),
+   fUnzipAheadClusters(0),
    fNFound(0),
    fNMissed(0),
    fNStalls(0),
@@ -204,12 +270,16 @@ void TTreeCacheUnzip::Init()
    fCompBufferSize = 16384;
 
    fUnzipGroupSize = 102400; // Each task unzips at least 100 KB
+   fUnzipAheadClusters = gEnv->GetValue("TTreeCacheUnzip.AheadClusters", 1);
+   if (fUnzipAheadClusters < 0)
+      fUnzipAheadClusters = 0;
 
    if (fgParallel == kDisable) {
       fParallel = kFALSE;
    }
    else if(fgParallel == kEnable || fgParallel == kForce) {
       fUnzipBufferSize = Long64_t(fgRelBuffSize * GetBufferSize());
+      fUnzipPool.fMaxBytes = fUnzipBufferSize;
 
       if(gDebug > 0)
          Info("TTreeCacheUnzip", "Enabling Parallel Unzipping");
@@ -292,6 +362,47 @@ Bool_t TTreeCacheUnzip::FillBuffer()
    if (fEntryMax <= 0) fEntryMax = tree->GetEntries();
    if (fEntryNext > fEntryMax) fEntryNext = fEntryMax;
 
+   //clear cache buffer
+   TFileCacheRead::Prefetch(0,0);
+   fSeekEntry.clear();
+
+   //store baskets of the current cluster
+   PrefetchBaskets(entry, fEntryNext, kFALSE, 0);
+
+   // Extend the window over the next clusters, so that the unzipping tasks still have work
+   // when the event loop crosses the cluster boundary. Each additional cluster may use at
+   // most one more cache buffer worth of compressed data, otherwise the window stops there.
+   if (fParallel) {
+      for (Int_t i = 0; i < fUnzipAheadClusters && fEntryNext < fEntryMax; ++i) {
+         Long64_t first = clusterIter();
+         Long64_t last = std::min(clusterIter.GetNextEntry(), fEntryMax);
+         if (first != fEntryNext || last <= first)
+            break;
+         if (PrefetchBaskets(first, last, kTRUE, Long64_t(fBufferSizeMin) * (i + 2)) < 0)
+            break;
+         fEntryNext = last;
+      }
+   }
+
+   // Now fix the size of the status arrays
+   ResetCache();
+   fIsLearning = kFALSE;
+
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Register for prefetching the baskets of all the cached branches which hold
+/// entries in [first, last). The first entry of each registered basket is
+/// recorded in fSeekEntry.
+/// For the cluster being read, first is the entry being read and the basket
+/// containing it is included. For a look-ahead cluster, first is the start of
+/// the cluster, only baskets starting in it are considered, and nothing is
+/// registered if the cache would then hold more than maxbytes.
+/// Returns the number of bytes registered, or -1 if the cluster did not fit.
+
+Long64_t TTreeCacheUnzip::PrefetchBaskets(Long64_t first, Long64_t last, Bool_t lookahead, Long64_t maxbytes)
+{
    // Check if owner has a TEventList set. If yes we optimize for this
    // Special case reading only the baskets containing entries in the
    // list.
@@ -304,11 +415,16 @@ Bool_t TTreeCacheUnzip::FillBuffer()
          chainOffset = chain->GetTreeOffset()[t];
       }
    }
+   TEntryList *enlist = elist ? nullptr : GetLocalEntryList();
 
-   //clear cache buffer
-   TFileCacheRead::Prefetch(0,0);
+   struct Basket_t {
+      Long64_t fPos;
+      Int_t    fLen;
+      Long64_t fEntry;
+   };
+   std::vector<Basket_t> baskets;
+   Long64_t nbytes = 0;
 
-   //store baskets
    for (Int_t i = 0; i < fNbranches; i++) {
       TBranch *b = (TBranch*)fBranches->UncheckedAt(i);
       if (b->GetDirectory() == 0) continue;
@@ -327,26 +443,37 @@ Bool_t TTreeCacheUnzip::FillBuffer()
          Long64_t pos = b->GetBasketSeek(j);
          Int_t len = lbaskets[j];
          if (pos <= 0 || len <= 0) continue;
-         //important: do not try to read fEntryNext, otherwise you jump to the next autoflush
-         if (entries[j] >= fEntryNext) continue;
-         if (entries[j] < entry && (j < nb - 1 && entries[j+1] <= entry)) continue;
+         //important: do not try to read last, otherwise you jump to the next autoflush
+         if (entries[j] >= last) continue;
+         if (entries[j] < first && (lookahead || (j < nb - 1 && entries[j+1] <= first))) continue;
          if (elist) {
             Long64_t emax = fEntryMax;
             if (j < nb - 1) emax = entries[j+1] - 1;
             if (!elist->ContainsRange(entries[j] + chainOffset, emax + chainOffset)) continue;
          }
-         fNReadPref++;
-
-         TFileCacheRead::Prefetch(pos, len);
+         if (enlist) {
+            Long64_t emax = fEntryMax;
+            if (j < nb - 1) emax = entries[j+1] - 1;
+            if (!enlist->ContainsRange(entries[j], emax)) continue;
+         }
+         baskets.push_back({pos, len, entries[j]});
+         nbytes += len;
       }
-      if (gDebug > 0) printf("Entry: %lld, registering baskets branch %s, fEntryNext=%lld, fNseek=%d, fNtot=%d\n", entry, ((TBranch*)fBranches->UncheckedAt(i))->GetName(), fEntryNext, fNseek, fNtot);
    }
 
-   // Now fix the size of the status arrays
-   ResetCache();
-   fIsLearning = kFALSE;
+   if (lookahead && fNtot + nbytes > maxbytes)
+      return -1;
 
-   return kTRUE;
+   for (auto &basket : baskets) {
+      fNReadPref++;
+      TFileCacheRead::Prefetch(basket.fPos, basket.fLen);
+      fSeekEntry.push_back(basket.fEntry);
+   }
+   if (gDebug > 0)
+      printf("Entry: %lld, registering %d baskets up to entry %lld, fNseek=%d, fNtot=%d\n", first,
+             (Int_t)baskets.size(), last, fNseek, fNtot);
+
+   return nbytes;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -363,6 +490,7 @@ Int_t TTreeCacheUnzip::SetBufferSize(Int_t buffersize)
       return res;
    }
    fUnzipBufferSize = Long64_t(fgRelBuffSize * GetBufferSize());
+   fUnzipPool.fMaxBytes = fUnzipBufferSize;
    ResetCache();
    return 1;
 }
@@ -502,6 +630,11 @@ void TTreeCacheUnzip::ResetCache()
 {
    // Reset all the lists and wipe all the chunks
    fCycle++;
+   // The chunks which were unzipped but never requested are kept for reuse
+   for (Int_t i = 0; i < fNseekMax; i++) {
+      if (fUnzipState.IsUnzipped(i))
+         fUnzipPool.Release(fUnzipState.fUnzipChunks[i].release(), fUnzipState.fUnzipLen[i]);
+   }
    fUnzipState.Clear(fNseekMax);
 
    if(fNseekMax < fNseek){
@@ -549,21 +682,15 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
       return 1;
    }
 
-   // Prepare a memory buffer of adequate size
-   char* locbuff = 0;
-   if (rdlen > 16384) {
-      locbuff = new char[rdlen];
-   } else if (rdlen * 3 < 16384) {
-      locbuff = new char[rdlen * 2];
-   } else {
-      locbuff = new char[16384];
-   }
+   // Prepare a memory buffer of adequate size, any idle buffer of the pool will do
+   Int_t loccap = 0;
+   char *locbuff = fUnzipPool.Acquire(rdlen, std::numeric_limits<Int_t>::max(), loccap);
 
    readbuf = ReadBufferExt(locbuff, rdoffs, rdlen, loc);
 
    if (readbuf <= 0) {
       fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
-      if (locbuff) delete [] locbuff;
+      fUnzipPool.Release(locbuff, loccap);
       return -1;
    }
 
@@ -574,33 +701,37 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
    // I.e. mark it as done but set the pointer to 0
    // This block will be unzipped synchronously in the main thread
    // TODO: ROOT internally breaks zipped buffers into 16MB blocks, we can probably still unzip in parallel.
-   if (len > 4 * fUnzipBufferSize) {
+   if (len > 4 * fUnzipBufferSize || keylen + objlen <= 0) {
            if (gDebug > 0)
                    Info("UnzipCache", "Block %d is too big, skipping.", index);
 
            fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
-           if (locbuff) delete [] locbuff;
+           fUnzipPool.Release(locbuff, loccap);
            return 0;
    }
 
-   // Unzip it into a new blk
-   char *ptr = nullptr;
+   // Unzip it into a new blk. The basket adopts the blk once it is requested, hence an idle
+   // buffer is only reused if it is not much larger than needed.
+   Int_t chunklen = keylen + objlen;
+   Int_t chunkcap = 0;
+   char *chunk = fUnzipPool.Acquire(chunklen, chunklen + chunklen / 8, chunkcap);
+   char *ptr = chunk;
    Int_t loclen = UnzipBuffer(&ptr, locbuff);
    if ((loclen > 0) && (loclen == objlen + keylen)) {
       if ((myCycle != fCycle) || !fIsTransferred) {
          fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
-         if (locbuff) delete [] locbuff;
-         delete [] ptr;
+         fUnzipPool.Release(locbuff, loccap);
+         fUnzipPool.Release(chunk, chunkcap);
          return 1;
       }
-      fUnzipState.SetUnzipped(index, ptr, loclen); // Set it as done
+      fUnzipState.SetUnzipped(index, chunk, loclen); // Set it as done
       fNUnzip++;
    } else {
       fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
-      delete [] ptr;
+      fUnzipPool.Release(chunk, chunkcap);
    }
 
-   if (locbuff) delete [] locbuff;
+   fUnzipPool.Release(locbuff, loccap);
    return 0;
 }
 
@@ -609,6 +740,8 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
 /// We create a TTaskGroup and asynchronously maps each group of baskets(> 100 kB in total)
 /// to a task. In TTaskGroup, we use TThreadExecutor to do the actually work of unzipping
 /// a group of basket. The purpose of creating TTaskGroup is to avoid competing with main thread.
+/// The baskets are grouped in the order of their first entry, so that the baskets of the
+/// cluster being read are unzipped before the ones of the look-ahead clusters.
 
 Int_t TTreeCacheUnzip::CreateTasks()
 {
@@ -628,14 +761,21 @@ Int_t TTreeCacheUnzip::CreateTasks()
          return nullptr;
       };
 
+      std::vector<Int_t> order(fNseek);
+      std::iota(order.begin(), order.end(), 0);
+      if ((Int_t)fSeekEntry.size() == fNseek) {
+         std::stable_sort(order.begin(), order.end(),
+                          [this](Int_t a, Int_t b) { return fSeekEntry[a] < fSeekEntry[b]; });
+      }
+
       Int_t accusz = 0;
       std::vector<std::vector<Int_t>> basketIndices;
       std::vector<Int_t> indices;
       if (fUnzipGroupSize <= 0) fUnzipGroupSize = 102400;
       for (Int_t i = 0; i < fNseek; i++) {
          while (accusz < fUnzipGroupSize) {
-            accusz += fSeekLen[i];
-            indices.push_back(i);
+            accusz += fSeekLen[order[i]];
+            indices.push_back(order[i]);
             i++;
             if (i >= fNseek) break;
          }
@@ -832,13 +972,29 @@ void TTreeCacheUnzip::SetUnzipRelBufferSize(Float_t relbufferSize)
    fgRelBuffSize = relbufferSize;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the number of clusters after the one being read whose baskets are
+/// prefetched and unzipped ahead, so that the unzipping tasks stay busy when
+/// the event loop moves to the next cluster. The look-ahead is limited to one
+/// cache buffer worth of compressed data per additional cluster. Zero restricts
+/// the cache to the cluster being read. The default is taken from the
+/// TTreeCacheUnzip.AheadClusters resource (1 if unset).
+/// The new value is used from the next refill of the cache.
+
+void TTreeCacheUnzip::SetUnzipAheadClusters(Int_t nclusters)
+{
+   fUnzipAheadClusters = nclusters < 0 ? 0 : nclusters;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Sets the size for the unzipping cache... by default it should be
-/// two times the size of the prefetching cache
+/// two times the size of the prefetching cache.
+/// It also bounds the memory kept in idle buffers for reuse by the unzipping.
 
 void TTreeCacheUnzip::SetUnzipBufferSize(Long64_t bufferSize)
 {
    fUnzipBufferSize = bufferSize;
+   fUnzipPool.fMaxBytes = bufferSize;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -952,6 +1108,8 @@ void  TTreeCacheUnzip::Print(Option_t* option) const {
    printf("Number of hits: %d\n", fNFound);
    printf("Number of stalls: %d\n", fNStalls);
    printf("Number of misses: %d\n", fNMissed);
+   printf("Number of clusters unzipped ahead: %d\n", fUnzipAheadClusters);
+   printf("Number of reused/allocated unzip buffers: %d/%d\n", fUnzipPool.fNReused, fUnzipPool.fNAllocated);
 
    TTreeCache::Print(option);
 }
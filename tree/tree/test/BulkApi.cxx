@@ -1,5 +1,7 @@
 #include <stdio.h>
 
+#include <memory>
+
 #include "Bytes.h"
 #include "TBranch.h"
 #include "TBufferFile.h"
@@ -184,6 +186,35 @@ TEST_F(BulkApiTest, simpleBulkReadTrailingBasket)
    SimpleBulkReadFunc(fFileName.c_str(), "TwithBasket");
 }
 
+TEST_F(BulkApiTest, InterleavedEntryRead)
+{
+   std::unique_ptr<TFile> hfile(TFile::Open(fFileName.c_str()));
+   auto tree = hfile->Get<TTree>("T");
+   ASSERT_TRUE(tree);
+   TBranch *branchF = tree->GetBranch("myFloat");
+   ASSERT_TRUE(branchF);
+   float f = 0;
+   branchF->SetAddress(&f);
+   TBufferFile branchbuf(TBuffer::kWrite, 32 * 1024);
+
+   ASSERT_GT(branchF->GetEntry(5), 0);
+   EXPECT_EQ(7, f);
+   // Neither the read entry nor the value of the entry-wise reader change
+   const auto count = branchF->GetBulkRead().GetBulkEntries(0, branchbuf);
+   ASSERT_GT(count, 6);
+   EXPECT_EQ(5, branchF->GetReadEntry());
+   EXPECT_EQ(7, f);
+   EXPECT_EQ(7, reinterpret_cast<float *>(branchbuf.GetCurrent())[5]);
+
+   ASSERT_GT(branchF->GetEntry(6), 0);
+   EXPECT_EQ(8, f);
+   ASSERT_GT(branchF->GetBulkRead().GetBulkEntries(count, branchbuf), 0);
+   EXPECT_EQ(6, branchF->GetReadEntry());
+   ASSERT_GT(branchF->GetEntry(count), 0);
+   EXPECT_EQ(count + 2, f);
+   branchF->ResetAddress();
+}
+
 TEST_F(BulkApiTest, fastRead)
 {
    auto hfile = TFile::Open(fFileName.c_str());
@@ -236,3 +236,87 @@ TEST_F(BulkApiVariableTest, serializedRead)
    printf("Bulk Serialized API: Successful read of all events.\n");
    printf("Bulk Serialized API: Total elapsed time (seconds) for API: %.2f\n", sw.RealTime());
 }
+
+TEST_F(BulkApiVariableTest, jaggedRead)
+{
+   auto hfile = TFile::Open(fFileName.c_str());
+   printf("Starting read of file %s.\n", fFileName.c_str());
+   TStopwatch sw;
+
+   printf("Using jagged bulk APIs.\n");
+
+   auto tree = dynamic_cast<TTree*>(hfile->Get("T"));
+   ASSERT_TRUE(tree);
+   auto branchLen = tree->GetBranch("myLen");
+   ASSERT_TRUE(branchLen);
+   auto branchFloat = tree->GetBranch("f");
+   ASSERT_TRUE(branchFloat);
+   auto branchDouble = tree->GetBranch("d");
+   ASSERT_TRUE(branchDouble);
+
+   EXPECT_EQ(0, branchLen->GetBulkRead().GetJaggedElementSize());
+   EXPECT_EQ(4, branchFloat->GetBulkRead().GetJaggedElementSize());
+   EXPECT_EQ(8, branchDouble->GetBulkRead().GetJaggedElementSize());
+
+   float idx_f = 0;
+   double idx_d = 2;
+   Long64_t evt_idx = 0;
+   Int_t cluster_size = std::min(fClusterSize, fEventCount);
+   TBufferFile floatBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile doubleBuf(TBuffer::kWrite, 32*1024);
+   std::vector<Int_t> floatOffsets;
+   std::vector<Int_t> doubleOffsets;
+
+   // Bulk reads do not interfere with the entry-wise reading of the branch
+   float values[10];
+   branchFloat->SetAddress(values);
+   ASSERT_GT(branchLen->GetEntry(3), 0);
+   ASSERT_GT(branchFloat->GetEntry(3), 0);
+   ASSERT_EQ(3, branchFloat->GetReadEntry());
+
+   sw.Start();
+   while (evt_idx < fEventCount) {
+      auto count = branchFloat->GetBulkRead().GetEntriesJagged(evt_idx, floatBuf, floatOffsets);
+      ASSERT_EQ(3, branchFloat->GetReadEntry());
+      ASSERT_EQ(count, cluster_size);
+      count = branchDouble->GetBulkRead().GetEntriesJagged(evt_idx, doubleBuf, doubleOffsets);
+      ASSERT_EQ(count, cluster_size);
+      ASSERT_EQ(static_cast<std::size_t>(count + 1), floatOffsets.size());
+
+      for (Int_t idx = 0; idx < count; idx++) {
+         const Long64_t expected = (evt_idx + idx + 1) % 10;
+         ASSERT_EQ(expected, floatOffsets[idx + 1] - floatOffsets[idx]);
+         ASSERT_EQ(expected, doubleOffsets[idx + 1] - doubleOffsets[idx]);
+      }
+      // The values of all entries are contiguous and in host byte order
+      for (Int_t elem = 0; elem < floatOffsets[count]; elem++) {
+         float entry_f;
+         double entry_d;
+         memcpy(&entry_f, floatBuf.GetCurrent() + elem * sizeof(float), sizeof(float));
+         memcpy(&entry_d, doubleBuf.GetCurrent() + elem * sizeof(double), sizeof(double));
+         if (evt_idx < 1600000) {
+            ASSERT_EQ(idx_f, entry_f);
+            ASSERT_EQ(idx_d, entry_d);
+         }
+         idx_f++;
+         idx_d++;
+      }
+      evt_idx += count;
+   }
+   ASSERT_EQ(evt_idx, fEventCount);
+   // Only entries at the beginning of a basket can be read
+   EXPECT_EQ(-1, branchFloat->GetBulkRead().GetEntriesJagged(1, floatBuf, floatOffsets));
+
+   // Entries 0 to 3 hold the values 0 to 9, entry 4 holds the next 5 values
+   ASSERT_GT(branchLen->GetEntry(4), 0);
+   ASSERT_GT(branchFloat->GetEntry(4), 0);
+   EXPECT_EQ(4, branchFloat->GetReadEntry());
+   for (int i = 0; i < 5; ++i)
+      EXPECT_FLOAT_EQ(10 + i, values[i]);
+   branchFloat->ResetAddress();
+   delete hfile;
+
+   sw.Stop();
+   printf("Bulk Jagged API: Successful read of all events.\n");
+   printf("Bulk Jagged API: Total elapsed time (seconds) for API: %.2f\n", sw.RealTime());
+}
@@ -2,6 +2,7 @@
 #include "TROOT.h"
 #include "TSystem.h"
 #include "TTree.h"
+#include "TTreeCacheUnzip.h"
 
 #include "gtest/gtest.h"
 
@@ -28,4 +29,109 @@ TEST(TTreeImplicitMT, flushBaskets)
    gSystem->Unlink(ofileName);
 }
 
+TEST(TTreeImplicitMT, AsyncBasketCompression)
+{
+   ROOT::EnableImplicitMT();
+   const auto ofileName = "asyncBasketCompressionMT.root";
+   const Long64_t nEntries = 100000;
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetAsyncBasketCompression();
+      Long64_t i = 0;
+      double x = 0.;
+      int n = 0;
+      float v[10];
+      t.Branch("i", &i, 2000);
+      t.Branch("x", &x, 2000);
+      t.Branch("n", &n);
+      t.Branch("v", v, "v[n]/F", 4000);
+      for (; i < nEntries; ++i) {
+         x = 0.5 * i;
+         n = i % 10;
+         for (int j = 0; j < n; ++j)
+            v[j] = i + j;
+         t.Fill();
+         // Accessing a basket while baskets are pending writes them out first
+         if (i == nEntries / 2) {
+            EXPECT_NE(nullptr, t.GetBranch("i")->GetBasket(0));
+         }
+      }
+      EXPECT_LT(1, t.GetBranch("x")->GetWriteBasket());
+      t.Write();
+   }
+
+   TFile f(ofileName);
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(nullptr, t);
+   EXPECT_EQ(nEntries, t->GetEntries());
+   Long64_t i = -1;
+   double x = 0.;
+   int n = 0;
+   float v[10];
+   t->SetBranchAddress("i", &i);
+   t->SetBranchAddress("x", &x);
+   t->SetBranchAddress("n", &n);
+   t->SetBranchAddress("v", v);
+   for (Long64_t e = 0; e < nEntries; ++e) {
+      t->GetEntry(e);
+      ASSERT_EQ(e, i);
+      ASSERT_DOUBLE_EQ(0.5 * e, x);
+      ASSERT_EQ(e % 10, n);
+      for (int j = 0; j < n; ++j)
+         ASSERT_FLOAT_EQ(e + j, v[j]);
+   }
+   // Baskets of a branch are written in fill order
+   auto br = t->GetBranch("x");
+   for (Int_t b = 1; b < br->GetWriteBasket(); ++b)
+      EXPECT_LT(br->GetBasketSeek(b - 1), br->GetBasketSeek(b));
+
+   gSystem->Unlink(ofileName);
+}
+
+TEST(TTreeImplicitMT, UnzipAheadClusters)
+{
+   ROOT::EnableImplicitMT();
+   const auto ofileName = "unzipAheadClustersMT.root";
+   const Long64_t nEntries = 20000;
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetAutoFlush(1000);
+      Long64_t i = 0;
+      double x = 0.;
+      t.Branch("i", &i);
+      t.Branch("x", &x);
+      for (; i < nEntries; ++i) {
+         x = 0.5 * i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kEnable);
+   for (Int_t ahead : {0, 1, 3}) {
+      TFile f(ofileName);
+      auto t = f.Get<TTree>("t");
+      ASSERT_NE(nullptr, t);
+      t->SetCacheSize(10000000);
+      auto cache = dynamic_cast<TTreeCacheUnzip *>(t->GetReadCache(&f));
+      ASSERT_NE(nullptr, cache);
+      cache->SetUnzipAheadClusters(ahead);
+      EXPECT_EQ(ahead, cache->GetUnzipAheadClusters());
+      Long64_t i = -1;
+      double x = 0.;
+      t->SetBranchAddress("i", &i);
+      t->SetBranchAddress("x", &x);
+      for (Long64_t e = 0; e < nEntries; ++e) {
+         t->GetEntry(e);
+         ASSERT_EQ(e, i);
+         ASSERT_DOUBLE_EQ(0.5 * e, x);
+      }
+   }
+   TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kDisable);
+
+   gSystem->Unlink(ofileName);
+}
+
 #endif // R__USE_IMT
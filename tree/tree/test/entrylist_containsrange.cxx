@@ -0,0 +1,113 @@
+#include <memory>
+#include <vector>
+
+#include "TEntryList.h"
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+
+#include "gtest/gtest.h"
+
+namespace {
+
+// Checks TEntryList::ContainsRange against the reference selection for a set of ranges crossing
+// word and block boundaries
+void CheckRanges(TEntryList &elist, const std::vector<bool> &selected)
+{
+   const Long64_t n = selected.size();
+   for (Long64_t len : {1, 15, 17, 300, 5000, 70000}) {
+      for (Long64_t first = 0; first < n; first += 251) {
+         const Long64_t last = first + len - 1;
+         bool expected = false;
+         for (Long64_t i = first; i <= last && i < n && !expected; ++i)
+            expected = selected[i];
+         EXPECT_EQ(expected, elist.ContainsRange(first, last)) << "[" << first << ", " << last << "]";
+      }
+   }
+}
+
+} // anonymous namespace
+
+TEST(TEntryList, ContainsRange)
+{
+   const Long64_t n = 200000;
+   // Sparse, medium and dense selections, which end up in list, bits and inverted list storage
+   for (int mode = 0; mode < 3; ++mode) {
+      std::vector<bool> selected(n, false);
+      TEntryList elist;
+      for (Long64_t i = 0; i < n; ++i) {
+         bool sel = (mode == 0) ? (i % 1013 == 7) : (mode == 1) ? (i % 3 == 0) : (i % 997 != 5);
+         if (sel) {
+            elist.Enter(i);
+            selected[i] = true;
+         }
+      }
+      CheckRanges(elist, selected);
+      elist.OptimizeStorage();
+      CheckRanges(elist, selected);
+   }
+
+   TEntryList empty;
+   EXPECT_FALSE(empty.ContainsRange(0, 1000));
+   TEntryList one;
+   one.Enter(64000);
+   EXPECT_FALSE(one.ContainsRange(0, 63999));
+   EXPECT_TRUE(one.ContainsRange(63999, 64000));
+   EXPECT_FALSE(one.ContainsRange(64001, 1000000));
+   EXPECT_FALSE(one.ContainsRange(64000, 63999));
+}
+
+TEST(TEntryList, TTreeCacheSkipsBaskets)
+{
+   auto filename{"entrylist_containsrange.root"};
+   auto treename{"t"};
+   const int nentries = 200000;
+   {
+      TFile f{filename, "RECREATE"};
+      TTree t{treename, treename};
+      t.SetAutoFlush(0);
+      int x;
+      double y;
+      t.Branch("x", &x, 1000);
+      t.Branch("y", &y, 1000);
+      for (int i = 0; i < nentries; ++i) {
+         x = i;
+         y = 0.5 * i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   // Reads 0.1% of the entries, with and without the selection attached as entry list
+   auto readSelected = [&](bool useList) {
+      TFile f{filename};
+      std::unique_ptr<TTree> t{f.Get<TTree>(treename)};
+      t->SetCacheSize(10000000);
+      t->AddBranchToCache("*", true);
+      t->StopCacheLearningPhase();
+      int x = -1;
+      double y = -1;
+      t->SetBranchAddress("x", &x);
+      t->SetBranchAddress("y", &y);
+      TEntryList elist{t.get()};
+      for (int entry = 0; entry < nentries; entry += 1000)
+         elist.Enter(entry);
+      if (useList)
+         t->SetEntryList(&elist);
+      const auto bytesBefore = f.GetBytesRead();
+      for (int entry = 0; entry < nentries; entry += 1000) {
+         t->GetEntry(entry);
+         EXPECT_EQ(entry, x);
+         EXPECT_DOUBLE_EQ(0.5 * entry, y);
+      }
+      const auto bytesRead = f.GetBytesRead() - bytesBefore;
+      t->SetEntryList(nullptr);
+      return bytesRead;
+   };
+
+   const auto bytesAll = readSelected(false);
+   const auto bytesSelected = readSelected(true);
+   EXPECT_LT(10 * bytesSelected, bytesAll);
+
+   gSystem->Unlink(filename);
+}
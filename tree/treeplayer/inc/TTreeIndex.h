@@ -39,9 +39,12 @@ protected:
    TTreeFormula  *fMinorFormula;        ///<! Pointer to minor TreeFormula
    TTreeFormula  *fMajorFormulaParent;  ///<! Pointer to major TreeFormula in Parent tree (if any)
    TTreeFormula  *fMinorFormulaParent;  ///<! Pointer to minor TreeFormula in Parent tree (if any)
+   TString        fDetachedKey;         ///< Name of the key holding the index arrays, if written with WriteDetached
+   Long64_t       fBounds[4];           ///<! First and last (major, minor) pairs, known before the arrays are loaded
 
    TTreeFormula  *GetMajorFormulaParent(const TTree *parent);
    TTreeFormula  *GetMinorFormulaParent(const TTree *parent);
+   Bool_t         LoadDetached() const;
 
 private:
    TTreeIndex(const TTreeIndex&) = delete;            // Not implemented.
@@ -57,20 +60,23 @@ public:
    virtual Long64_t       GetEntryNumberFriend(const TTree *parent);
    virtual Long64_t       GetEntryNumberWithIndex(Long64_t major, Long64_t minor) const;
    virtual Long64_t       GetEntryNumberWithBestIndex(Long64_t major, Long64_t minor) const;
-   virtual Long64_t      *GetIndex()        const {return fIndex;}
-   virtual Long64_t      *GetIndexValues()  const {return fIndexValues;}
+   void                   GetBounds(Long64_t &minmaj, Long64_t &minmin, Long64_t &maxmaj, Long64_t &maxmin) const;
+   virtual Long64_t      *GetIndex()        const {LoadDetached(); return fIndex;}
+   virtual Long64_t      *GetIndexValues()  const {LoadDetached(); return fIndexValues;}
    virtual Long64_t      *GetIndexValuesMinor()  const;
    const char            *GetMajorName()    const {return fMajorName.Data();}
    const char            *GetMinorName()    const {return fMinorName.Data();}
    virtual Long64_t       GetN()            const {return fN;}
    virtual TTreeFormula  *GetMajorFormula();
    virtual TTreeFormula  *GetMinorFormula();
+   Bool_t                 IsDetached()      const {return !fDetachedKey.IsNull();}
    virtual Bool_t         IsValidFor(const TTree *parent);
    virtual void           Print(Option_t *option="") const;
    virtual void           UpdateFormulaLeaves(const TTree *parent);
    virtual void           SetTree(const TTree *T);
+   Int_t                  WriteDetached(const char *keyname = nullptr);
 
-   ClassDef(TTreeIndex,2);  //A Tree Index with majorname and minorname.
+   ClassDef(TTreeIndex,3);  //A Tree Index with majorname and minorname.
 };
 
 #endif
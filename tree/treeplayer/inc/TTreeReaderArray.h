@@ -34,6 +34,9 @@ Base class of TTreeReaderArray.
 
       std::size_t GetSize() const { return fImpl->GetSize(GetProxy()); }
       Bool_t IsEmpty() const { return !GetSize(); }
+      /// Returns true if the elements of the array are known to be adjacent in memory, e.g. because the branch
+      /// is read basket-wise through the bulk I/O interface
+      bool IsContiguous() const { return fImpl && fImpl->IsContiguous(); }
 
       virtual EReadStatus GetReadStatus() const { return fImpl ? fImpl->fReadStatus : kReadError; }
 
@@ -76,6 +76,8 @@ namespace Internal {
       virtual ~TVirtualCollectionReader();
       virtual size_t GetSize(Detail::TBranchProxy*) = 0;
       virtual void* At(Detail::TBranchProxy*, size_t /*idx*/) = 0;
+      /// Returns true if the elements of an entry are known to be adjacent in memory
+      virtual bool IsContiguous() const { return false; }
    };
 
 }
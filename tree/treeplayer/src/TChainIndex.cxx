@@ -33,10 +33,8 @@ and kept inside this chain index.
 
 void TChainIndex::TChainIndexEntry::SetMinMaxFrom(const TTreeIndex *index )
 {
-   fMinIndexValue    = index->GetIndexValues()[0];
-   fMinIndexValMinor = index->GetIndexValuesMinor()[0];
-   fMaxIndexValue    = index->GetIndexValues()[index->GetN() - 1];
-   fMaxIndexValMinor = index->GetIndexValuesMinor()[index->GetN() - 1];
+   // Does not read the arrays of a detached index
+   index->GetBounds(fMinIndexValue, fMinIndexValMinor, fMaxIndexValue, fMaxIndexValMinor);
 }
 
 ClassImp(TChainIndex);
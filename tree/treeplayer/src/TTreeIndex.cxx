@@ -18,7 +18,12 @@ A Tree Index with majorname and minorname.
 #include "TTreeFormula.h"
 #include "TTree.h"
 #include "TBuffer.h"
+#include "TBufferFile.h"
 #include "TMath.h"
+#include "TDirectory.h"
+#include "TFile.h"
+
+#include <memory>
 
 ClassImp(TTreeIndex);
 
@@ -57,6 +62,7 @@ TTreeIndex::TTreeIndex(): TVirtualIndex()
    fMinorFormula       = 0;
    fMajorFormulaParent = 0;
    fMinorFormulaParent = 0;
+   fBounds[0] = fBounds[1] = fBounds[2] = fBounds[3] = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -116,6 +122,15 @@ TTreeIndex::TTreeIndex(): TVirtualIndex()
 /// the filling process just before saving the Tree header.
 /// If a previous index was computed, it is redefined by this new call.
 ///
+/// For large trees, the index arrays can instead be written in their own key
+/// next to the Tree, see WriteDetached. Reading the Tree then only reads the
+/// index header and the arrays are read on the first lookup:
+/// ~~~{.cpp}
+///  tree.BuildIndex("Run","Event");
+///  static_cast<TTreeIndex*>(tree.GetTreeIndex())->WriteDetached();
+///  tree.Write();
+/// ~~~
+///
 /// Note that this function can also be applied to a TChain.
 ///
 /// The return value is the number of entries in the Index (< 0 indicates failure)
@@ -135,6 +150,7 @@ TTreeIndex::TTreeIndex(const TTree *T, const char *majorname, const char *minorn
    fMinorFormula       = 0;
    fMajorFormulaParent = 0;
    fMinorFormulaParent = 0;
+   fBounds[0] = fBounds[1] = fBounds[2] = fBounds[3] = 0;
    fMajorName          = majorname;
    fMinorName          = minorname;
    if (!T) return;
@@ -237,6 +253,9 @@ TTreeIndex::~TTreeIndex()
 
 void TTreeIndex::Append(const TVirtualIndex *add, Bool_t delaySort )
 {
+   // The stored arrays will not match the appended index anymore
+   LoadDetached();
+   fDetachedKey = "";
 
    if (add && add->GetN()) {
       // Create new buffer (if needed)
@@ -378,6 +397,7 @@ Long64_t TTreeIndex::GetEntryNumberFriend(const TTree *parent)
 
 Long64_t TTreeIndex::FindValues(Long64_t major, Long64_t minor) const
 {
+   if (!LoadDetached()) return fN;
    Long64_t mid, step, pos = 0, count = fN;
    // find lower bound using bisection
    while( count > 0 ) {
@@ -413,7 +433,7 @@ Long64_t TTreeIndex::FindValues(Long64_t major, Long64_t minor) const
 
 Long64_t TTreeIndex::GetEntryNumberWithBestIndex(Long64_t major, Long64_t minor) const
 {
-   if (fN == 0) return -1;
+   if (fN == 0 || !LoadDetached()) return -1;
 
    Long64_t pos = FindValues(major, minor);
    if( pos < fN && fIndexValues[pos] == major && fIndexValuesMinor[pos] == minor )
@@ -438,7 +458,7 @@ Long64_t TTreeIndex::GetEntryNumberWithBestIndex(Long64_t major, Long64_t minor)
 
 Long64_t TTreeIndex::GetEntryNumberWithIndex(Long64_t major, Long64_t minor) const
 {
-   if (fN == 0) return -1;
+   if (fN == 0 || !LoadDetached()) return -1;
 
    Long64_t pos = FindValues(major, minor);
    if( pos < fN && fIndexValues[pos] == major && fIndexValuesMinor[pos] == minor )
@@ -451,9 +471,34 @@ Long64_t TTreeIndex::GetEntryNumberWithIndex(Long64_t major, Long64_t minor) con
 
 Long64_t* TTreeIndex::GetIndexValuesMinor()  const
 {
+   LoadDetached();
    return fIndexValuesMinor;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the lowest and the highest (major, minor) pairs of the index.
+/// For a detached index whose arrays were not read yet, the values stored in
+/// the index header are returned and the arrays are not read.
+
+void TTreeIndex::GetBounds(Long64_t &minMajor, Long64_t &minMinor, Long64_t &maxMajor, Long64_t &maxMinor) const
+{
+   if (!fIndex && IsDetached()) {
+      minMajor = fBounds[0];
+      minMinor = fBounds[1];
+      maxMajor = fBounds[2];
+      maxMinor = fBounds[3];
+      return;
+   }
+   if (fN == 0 || !fIndexValues) {
+      minMajor = minMinor = maxMajor = maxMinor = 0;
+      return;
+   }
+   minMajor = fIndexValues[0];
+   minMinor = fIndexValuesMinor[0];
+   maxMajor = fIndexValues[fN - 1];
+   maxMinor = fIndexValuesMinor[fN - 1];
+}
+
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -518,6 +563,27 @@ TTreeFormula *TTreeIndex::GetMinorFormulaParent(const TTree *parent)
    return fMinorFormulaParent;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read the arrays of a detached index from their key, in the directory of the
+/// Tree, if this was not done yet. Return kFALSE if they cannot be read.
+
+Bool_t TTreeIndex::LoadDetached() const
+{
+   if (fIndex || fN == 0 || fDetachedKey.IsNull())
+      return kTRUE;
+   TDirectory *dir = fTree ? fTree->GetDirectory() : nullptr;
+   std::unique_ptr<TTreeIndex> stored(dir ? dir->Get<TTreeIndex>(fDetachedKey) : nullptr);
+   if (!stored || stored->fN != fN || !stored->fIndex) {
+      Error("LoadDetached", "Cannot read the index arrays from key %s", fDetachedKey.Data());
+      return kFALSE;
+   }
+   auto self = const_cast<TTreeIndex *>(this);
+   std::swap(self->fIndex, stored->fIndex);
+   std::swap(self->fIndexValues, stored->fIndexValues);
+   std::swap(self->fIndexValuesMinor, stored->fIndexValuesMinor);
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return kTRUE if index can be applied to the TTree
 
@@ -539,6 +605,7 @@ Bool_t TTreeIndex::IsValidFor(const TTree *parent)
 
 void TTreeIndex::Print(Option_t * option) const
 {
+   if (!LoadDetached()) return;
    TString opt = option;
    Bool_t printEntry = kFALSE;
    Long64_t n = fN;
@@ -587,6 +654,14 @@ void TTreeIndex::Streamer(TBuffer &R__b)
       fMajorName.Streamer(R__b);
       fMinorName.Streamer(R__b);
       R__b >> fN;
+      if (R__v > 2)
+         fDetachedKey.Streamer(R__b);
+      if (!fDetachedKey.IsNull()) {
+         // The arrays are read from their own key on first use
+         R__b.ReadFastArray(fBounds, 4);
+         R__b.CheckByteCount(R__s, R__c, TTreeIndex::IsA());
+         return;
+      }
       fIndexValues = new Long64_t[fN];
       R__b.ReadFastArray(fIndexValues,fN);
       if( R__v > 1 ) {
@@ -599,14 +674,40 @@ void TTreeIndex::Streamer(TBuffer &R__b)
       R__b.ReadFastArray(fIndex,fN);
       R__b.CheckByteCount(R__s, R__c, TTreeIndex::IsA());
    } else {
-      R__c = R__b.WriteVersion(TTreeIndex::IsA(), kTRUE);
+      Bool_t detached = IsDetached();
+      if (detached) {
+         // The key holding the arrays is only known in the file of the Tree: when the index is
+         // copied elsewhere, e.g. by CloneTree, hadd or TFileMerger, the arrays are written inline.
+         TDirectory *dir = fTree ? fTree->GetDirectory() : nullptr;
+         TFile *keyFile = dir ? dir->GetFile() : nullptr;
+         if ((!keyFile || R__b.GetParent() != keyFile) && LoadDetached())
+            detached = kFALSE;
+      }
+      // An index with inline arrays is written with the layout of version 2, which older releases
+      // can read. Text-based buffers always use the current version.
+      const Bool_t writeV2 = !detached && dynamic_cast<TBufferFile *>(&R__b);
+      if (writeV2) {
+         R__c = R__b.Length();
+         R__b << UInt_t(0); // room for the byte count, as reserved by TBufferFile::WriteVersion
+         R__b << Version_t(2);
+      } else {
+         R__c = R__b.WriteVersion(TTreeIndex::IsA(), kTRUE);
+      }
       TVirtualIndex::Streamer(R__b);
       fMajorName.Streamer(R__b);
       fMinorName.Streamer(R__b);
       R__b << fN;
-      R__b.WriteFastArray(fIndexValues, fN);
-      R__b.WriteFastArray(fIndexValuesMinor, fN);
-      R__b.WriteFastArray(fIndex, fN);
+      if (!writeV2) {
+         TString detachedKey = detached ? fDetachedKey : TString();
+         detachedKey.Streamer(R__b);
+      }
+      if (detached) {
+         R__b.WriteFastArray(fBounds, 4);
+      } else {
+         R__b.WriteFastArray(fIndexValues, fN);
+         R__b.WriteFastArray(fIndexValuesMinor, fN);
+         R__b.WriteFastArray(fIndex, fN);
+      }
       R__b.SetByteCount(R__c, kTRUE);
    }
 }
@@ -638,3 +739,34 @@ void TTreeIndex::SetTree(const TTree *T)
    fTree = (TTree*)T;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Write the index arrays in their own key, by default named "<tree>_index",
+/// in the directory of the Tree.
+///
+/// When the Tree is written afterwards, only the index header (names, number
+/// of entries, first and last values and the key name) is stored with it.
+/// Opening the Tree does then not read the arrays: they are read with the
+/// first lookup, e.g. by TTree::GetEntryWithIndex. This makes opening large
+/// indexed trees (event pickers, event display servers) cheap.
+/// The key is dropped again if the index is changed with Append.
+///
+/// Return the number of bytes written, 0 in case of error.
+
+Int_t TTreeIndex::WriteDetached(const char *keyname)
+{
+   TDirectory *dir = fTree ? fTree->GetDirectory() : nullptr;
+   if (!dir || !dir->IsWritable()) {
+      Error("WriteDetached", "The Tree of the index is not in a writable directory");
+      return 0;
+   }
+   if (!LoadDetached())
+      return 0;
+   TString name = keyname ? TString(keyname) : TString::Format("%s_index", fTree->GetName());
+   fDetachedKey = "";
+   Int_t nbytes = dir->WriteTObject(this, name, "WriteDelete");
+   if (nbytes <= 0)
+      return 0;
+   GetBounds(fBounds[0], fBounds[1], fBounds[2], fBounds[3]);
+   fDetachedKey = name;
+   return nbytes;
+}
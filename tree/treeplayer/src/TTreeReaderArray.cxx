@@ -17,11 +17,13 @@
 #include "TBranchSTL.h"
 #include "TBranchObject.h"
 #include "TBranchProxyDirector.h"
+#include "TBufferFile.h"
 #include "TClassEdit.h"
 #include "TFriendElement.h"
 #include "TFriendProxy.h"
 #include "TLeaf.h"
 #include "TList.h"
+#include "TMath.h"
 #include "TROOT.h"
 #include "TStreamerInfo.h"
 #include "TStreamerElement.h"
@@ -29,7 +31,10 @@
 #include "TGenCollectionProxy.h"
 #include "TRegexp.h"
 
+#include <cstdint> // std::uintptr_t
+#include <cstring> // std::memcpy
 #include <memory>
+#include <vector>
 
 // pin vtable
 ROOT::Internal::TVirtualCollectionReader::~TVirtualCollectionReader() {}
@@ -374,6 +379,114 @@ namespace {
       }
    };
 
+   // Reader for variable-size arrays of fundamental types (counted arrays, split STL members, std::vector) that
+   // decodes entire baskets through TBranch's bulk I/O interface and serves the entries from the decoded basket.
+   // If the branch cannot be read in bulk, it permanently falls back to the regular, entry-wise reader.
+   class TBulkJaggedArrayReader final : public TVirtualCollectionReader {
+   private:
+      TTreeReader *fTreeReader;
+      TBranchProxyDirector *fDirector;
+      TString fBranchName;
+      std::unique_ptr<TVirtualCollectionReader> fFallback;
+      bool fUseFallback = false;
+
+      /// The tree and the branch of the currently decoded basket
+      TTree *fTree = nullptr;
+      Int_t fTreeNumber = -1;
+      TBranch *fBranch = nullptr;
+      /// The decoded basket: the values of entries [fFirstEntry, fFirstEntry + fNEntries)
+      TBufferFile fBuffer{TBuffer::kRead, 10000};
+      /// The values of the decoded basket: they point into fBuffer, or into fAlignedValues if the values in fBuffer
+      /// are not suitably aligned for their type (the position of the data in the basket buffer is arbitrary)
+      char *fValues = nullptr;
+      std::vector<Long64_t> fAlignedValues;
+      std::vector<Int_t> fOffsets;
+      Long64_t fFirstEntry = -1;
+      Long64_t fNEntries = 0;
+      Int_t fElementSize;
+
+      /// Returns the index of the current entry in the decoded basket, or -1 if the fallback has to be used
+      Long64_t LoadEntry(ROOT::Detail::TBranchProxy *proxy)
+      {
+         if (fUseFallback)
+            return -1;
+
+         TTree *tree = fTreeReader->GetTree()->GetTree();
+         const auto treeNumber = fTreeReader->GetTree()->GetTreeNumber();
+         if (tree != fTree || treeNumber != fTreeNumber) {
+            fTree = tree;
+            fTreeNumber = treeNumber;
+            fBranch = tree ? tree->GetBranch(fBranchName) : nullptr;
+            fFirstEntry = -1;
+            fNEntries = 0;
+         }
+         const auto entry = fDirector->GetReadEntry();
+         if (entry < 0)
+            return -1;
+         if (entry >= fFirstEntry && entry < fFirstEntry + fNEntries)
+            return entry - fFirstEntry;
+
+         Int_t nEntries = -1;
+         if (fBranch && fBranch->GetBulkRead().GetJaggedElementSize() == fElementSize) {
+            auto basketIdx = TMath::BinarySearch(fBranch->GetWriteBasket() + 1, fBranch->GetBasketEntry(), entry);
+            if (basketIdx >= 0) {
+               fFirstEntry = fBranch->GetBasketEntry()[basketIdx];
+               nEntries = fBranch->GetBulkRead().GetEntriesJagged(fFirstEntry, fBuffer, fOffsets);
+            }
+         }
+         if (nEntries <= 0 || entry >= fFirstEntry + nEntries) {
+            fUseFallback = true;
+            fNEntries = 0;
+            // Make sure the proxy reads the entry
+            fFallback->GetSize(proxy);
+            return -1;
+         }
+         fNEntries = nEntries;
+         fValues = fBuffer.GetCurrent();
+         // Fundamental types are aligned to (at most) their size; copy misaligned values once per basket
+         if (reinterpret_cast<std::uintptr_t>(fValues) % fElementSize != 0) {
+            const std::size_t nBytes = std::size_t(fOffsets[nEntries]) * fElementSize;
+            fAlignedValues.resize((nBytes + sizeof(Long64_t) - 1) / sizeof(Long64_t));
+            std::memcpy(fAlignedValues.data(), fValues, nBytes);
+            fValues = reinterpret_cast<char *>(fAlignedValues.data());
+         }
+         fReadStatus = TTreeReaderValueBase::kReadSuccess;
+         return entry - fFirstEntry;
+      }
+
+   public:
+      TBulkJaggedArrayReader(TTreeReader *treeReader, TBranchProxyDirector *director, const char *branchName,
+                             Int_t elementSize, std::unique_ptr<TVirtualCollectionReader> fallback)
+         : fTreeReader(treeReader), fDirector(director), fBranchName(branchName), fFallback(std::move(fallback)),
+           fElementSize(elementSize)
+      {
+      }
+
+      size_t GetSize(ROOT::Detail::TBranchProxy *proxy) override
+      {
+         const auto idx = LoadEntry(proxy);
+         if (idx < 0) {
+            auto size = fFallback->GetSize(proxy);
+            fReadStatus = fFallback->fReadStatus;
+            return size;
+         }
+         return fOffsets[idx + 1] - fOffsets[idx];
+      }
+
+      void *At(ROOT::Detail::TBranchProxy *proxy, size_t idx) override
+      {
+         const auto entryIdx = LoadEntry(proxy);
+         if (entryIdx < 0) {
+            auto address = fFallback->At(proxy, idx);
+            fReadStatus = fFallback->fReadStatus;
+            return address;
+         }
+         return fValues + (fOffsets[entryIdx] + idx) * fElementSize;
+      }
+
+      bool IsContiguous() const override { return !fUseFallback || fFallback->IsContiguous(); }
+   };
+
    class TLeafParameterSizeReader : public TDynamicArrayReader<TLeafReader> {
    public:
       TLeafParameterSizeReader(TTreeReader *treeReader, const char *leafName, TTreeReaderValueBase *valueReaderArg)
@@ -762,6 +875,17 @@ void ROOT::Internal::TTreeReaderArrayBase::SetImpl(TBranch* branch, TLeaf* myLea
       Error("TTreeReaderArrayBase::SetImpl", "Support for branches of type TBranchRef not implemented");
       fSetupStatus = kSetupInternalError;
    }
+
+   // Variable-size arrays of fundamental types in the main tree are read basket-wise through the bulk I/O
+   // interface. Friend trees are excluded because their entry numbers are not necessarily the ones of the main tree.
+   if (fImpl && !myLeaf && fDict && fDict->IsA() == TDataType::Class() &&
+       branch->GetTree() == fTreeReader->GetTree()->GetTree()) {
+      const auto elementSize = branch->GetBulkRead().GetJaggedElementSize();
+      if (elementSize > 0 && elementSize == static_cast<TDataType *>(fDict)->Size()) {
+         fImpl = std::make_unique<TBulkJaggedArrayReader>(fTreeReader, fTreeReader->fDirector, branch->GetName(),
+                                                          elementSize, std::move(fImpl));
+      }
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -7,6 +7,8 @@
 
 #include "gtest/gtest.h"
 
+#include <cstdint>
+
 TEST(TTreeReaderArray, Vector)
 {
    TTree *tree = new TTree("TTreeReaderArrayTree", "In-memory test tree");
@@ -29,6 +31,54 @@ TEST(TTreeReaderArray, Vector)
    EXPECT_FLOAT_EQ(17.f, vec[0]);
 }
 
+TEST(TTreeReaderArray, BulkJagged)
+{
+   const auto fileName = "TTreeReaderArrayBulkJagged.root";
+   {
+      TFile f(fileName, "RECREATE");
+      TTree tree("t", "t");
+      std::vector<float> vec;
+      int n = 0;
+      double arr[10];
+      // Small baskets such that the readers cross basket boundaries
+      tree.Branch("vec", &vec, 1000);
+      tree.Branch("n", &n, "n/I");
+      tree.Branch("arr", arr, "arr[n]/D", 1000);
+      for (int i = 0; i < 1000; ++i) {
+         n = i % 10;
+         vec.assign(n, i);
+         for (int j = 0; j < n; ++j)
+            arr[j] = i + j;
+         tree.Fill();
+      }
+      f.Write();
+   }
+
+   TFile f(fileName);
+   TTreeReader tr("t", &f);
+   TTreeReaderArray<float> vec(tr, "vec");
+   TTreeReaderArray<double> arr(tr, "arr");
+   while (tr.Next()) {
+      const auto i = tr.GetCurrentEntry();
+      ASSERT_EQ(static_cast<std::size_t>(i % 10), vec.GetSize());
+      ASSERT_EQ(static_cast<std::size_t>(i % 10), arr.GetSize());
+      for (std::size_t j = 0; j < vec.GetSize(); ++j) {
+         EXPECT_FLOAT_EQ(i, vec[j]);
+         EXPECT_DOUBLE_EQ(i + j, arr[j]);
+      }
+      if (vec.GetSize() > 1) {
+         EXPECT_EQ(&vec[0] + 1, &vec[1]);
+         EXPECT_EQ(&arr[0] + 1, &arr[1]);
+         // the values start at an arbitrary offset of the basket buffer, but must be aligned for their type
+         EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(&vec[0]) % alignof(float));
+         EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(&arr[0]) % alignof(double));
+      }
+   }
+   EXPECT_TRUE(vec.IsContiguous());
+   EXPECT_TRUE(arr.IsContiguous());
+   gSystem->Unlink(fileName);
+}
+
 TEST(TTreeReaderArray, MultiReaders)
 {
    // See https://root.cern.ch/phpBB3/viewtopic.php?f=3&t=22790
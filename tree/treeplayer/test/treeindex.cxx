@@ -0,0 +1,160 @@
+#include "TBufferFile.h"
+#include "TChain.h"
+#include "TFile.h"
+#include "TKey.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeIndex.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+namespace {
+
+void WriteIndexedTree(const char *fname, int run, bool detached)
+{
+   TFile f(fname, "RECREATE");
+   TTree t("events", "events");
+   int r = run;
+   int e;
+   t.Branch("run", &r);
+   t.Branch("event", &e);
+   // Events filled in reverse order, so that the index is not trivial
+   for (e = 999; e >= 0; --e)
+      t.Fill();
+   t.BuildIndex("run", "event");
+   if (detached) {
+      auto index = dynamic_cast<TTreeIndex *>(t.GetTreeIndex());
+      ASSERT_NE(nullptr, index);
+      EXPECT_GT(index->WriteDetached(), 0);
+      EXPECT_TRUE(index->IsDetached());
+   }
+   t.Write();
+}
+
+} // anonymous namespace
+
+TEST(TTreeIndex, WriteDetached)
+{
+   const auto fnameAttached = "treeindex_attached.root";
+   const auto fnameDetached = "treeindex_detached.root";
+   WriteIndexedTree(fnameAttached, 1, false);
+   WriteIndexedTree(fnameDetached, 1, true);
+
+   Int_t treeBytesAttached = 0;
+   {
+      TFile f(fnameAttached);
+      treeBytesAttached = f.GetKey("events")->GetNbytes();
+      EXPECT_EQ(nullptr, f.GetKey("events_index"));
+   }
+
+   TFile f(fnameDetached);
+   ASSERT_NE(nullptr, f.GetKey("events_index"));
+   EXPECT_LT(f.GetKey("events")->GetNbytes(), treeBytesAttached);
+
+   std::unique_ptr<TTree> t(f.Get<TTree>("events"));
+   auto index = dynamic_cast<TTreeIndex *>(t->GetTreeIndex());
+   ASSERT_NE(nullptr, index);
+   EXPECT_TRUE(index->IsDetached());
+   EXPECT_EQ(1000, index->GetN());
+
+   Long64_t minMajor, minMinor, maxMajor, maxMinor;
+   index->GetBounds(minMajor, minMinor, maxMajor, maxMinor);
+   EXPECT_EQ(1, minMajor);
+   EXPECT_EQ(0, minMinor);
+   EXPECT_EQ(1, maxMajor);
+   EXPECT_EQ(999, maxMinor);
+
+   int e = -1;
+   t->SetBranchAddress("event", &e);
+   for (int event : {0, 1, 500, 999}) {
+      EXPECT_EQ(999 - event, t->GetEntryNumberWithIndex(1, event));
+      EXPECT_GT(t->GetEntryWithIndex(1, event), 0);
+      EXPECT_EQ(event, e);
+   }
+   EXPECT_EQ(-1, t->GetEntryNumberWithIndex(2, 0));
+
+   gSystem->Unlink(fnameAttached);
+   gSystem->Unlink(fnameDetached);
+}
+
+TEST(TTreeIndex, WriteDetachedChain)
+{
+   const auto fname1 = "treeindex_detached_chain1.root";
+   const auto fname2 = "treeindex_detached_chain2.root";
+   WriteIndexedTree(fname1, 1, true);
+   WriteIndexedTree(fname2, 2, true);
+
+   TChain c("events");
+   c.Add(fname1);
+   c.Add(fname2);
+   c.BuildIndex("run", "event");
+   int e = -1;
+   int r = -1;
+   c.SetBranchAddress("run", &r);
+   c.SetBranchAddress("event", &e);
+   EXPECT_GT(c.GetEntryWithIndex(2, 10), 0);
+   EXPECT_EQ(2, r);
+   EXPECT_EQ(10, e);
+   EXPECT_GT(c.GetEntryWithIndex(1, 990), 0);
+   EXPECT_EQ(1, r);
+   EXPECT_EQ(990, e);
+
+   gSystem->Unlink(fname1);
+   gSystem->Unlink(fname2);
+}
+
+TEST(TTreeIndex, StreamedVersion)
+{
+   const auto fname = "treeindex_version.root";
+   WriteIndexedTree(fname, 1, true);
+   TFile f(fname);
+   std::unique_ptr<TTree> t(f.Get<TTree>("events"));
+   auto index = dynamic_cast<TTreeIndex *>(t->GetTreeIndex());
+   ASSERT_NE(nullptr, index);
+
+   auto streamedVersion = [index](TFile *parent) {
+      TBufferFile buf(TBuffer::kWrite);
+      buf.SetParent(parent);
+      index->Streamer(buf);
+      buf.SetReadMode();
+      buf.SetBufferOffset(0);
+      UInt_t start, count;
+      return buf.ReadVersion(&start, &count);
+   };
+   // in the file of the tree, only the header of the detached index is written
+   EXPECT_EQ(3, streamedVersion(&f));
+   // anywhere else, the arrays are written inline with the layout of version 2, readable by older releases
+   EXPECT_EQ(2, streamedVersion(nullptr));
+
+   gSystem->Unlink(fname);
+}
+
+TEST(TTreeIndex, CloneDetached)
+{
+   const auto fname = "treeindex_clone_in.root";
+   const auto fnameClone = "treeindex_clone_out.root";
+   WriteIndexedTree(fname, 1, true);
+   {
+      TFile f(fname);
+      std::unique_ptr<TTree> t(f.Get<TTree>("events"));
+      TFile fclone(fnameClone, "RECREATE");
+      auto clone = t->CloneTree(-1, "fast");
+      clone->Write();
+   }
+
+   TFile f(fnameClone);
+   EXPECT_EQ(nullptr, f.GetKey("events_index"));
+   std::unique_ptr<TTree> t(f.Get<TTree>("events"));
+   auto index = dynamic_cast<TTreeIndex *>(t->GetTreeIndex());
+   ASSERT_NE(nullptr, index);
+   EXPECT_FALSE(index->IsDetached());
+   int e = -1;
+   t->SetBranchAddress("event", &e);
+   EXPECT_GT(t->GetEntryWithIndex(1, 10), 0);
+   EXPECT_EQ(10, e);
+
+   gSystem->Unlink(fname);
+   gSystem->Unlink(fnameClone);
+}